@@ -0,0 +1,140 @@
+/*****************************************************************************
+* \file      BenchMain.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Benchmark runner for ADT data structures
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <string.h>
+#include "bench_util.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+typedef struct bench_entry_tag
+{
+   const char *name;
+   const char *usage;
+   bench_func_t *func;
+} bench_entry_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void bench_ary_search(int argc, char **argv);
+void bench_ary_select(int argc, char **argv);
+void bench_ary_sort_parallel(int argc, char **argv);
+void bench_ary_sort_strings(int argc, char **argv);
+void bench_heap_arity(int argc, char **argv);
+void bench_heap_build(int argc, char **argv);
+void bench_heap_meld(int argc, char **argv);
+void bench_heap_minmax(int argc, char **argv);
+void bench_heap_pq(int argc, char **argv);
+void bench_list_pool(int argc, char **argv);
+void bench_list_remove(int argc, char **argv);
+void bench_list_scan(int argc, char **argv);
+void bench_list_sort(int argc, char **argv);
+void bench_mpscq(int argc, char **argv);
+void bench_mq(int argc, char **argv);
+void bench_radix_sort(int argc, char **argv);
+void bench_timerwheel(int argc, char **argv);
+
+static void print_usage(const char *progName);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static const bench_entry_t m_benchmarks[] = {
+   {"ary_search", "[maxLen]", bench_ary_search},
+   {"ary_select", "[numElements] [k]", bench_ary_select},
+   {"ary_sort_parallel", "[numElements] [maxThreads]", bench_ary_sort_parallel},
+   {"ary_sort_strings", "[numStrings]", bench_ary_sort_strings},
+   {"heap_arity", "[maxQueueLen] [numOperations]", bench_heap_arity},
+   {"heap_build", "[numElements]", bench_heap_build},
+   {"heap_meld", "[numElements] [numQueues] [numOperations]", bench_heap_meld},
+   {"heap_minmax", "[boardLen] [numOperations]", bench_heap_minmax},
+   {"heap_pq", "[queueLen] [numOperations]", bench_heap_pq},
+   {"list_pool", "[queueLen] [numOperations]", bench_list_pool},
+   {"list_remove", "[numElements] [numOperations]", bench_list_remove},
+   {"list_scan", "[numElements]", bench_list_scan},
+   {"list_sort", "[numElements]", bench_list_sort},
+   {"mpscq", "[maxProducers] [numMessages]", bench_mpscq},
+   {"mq", "[maxThreads] [queueLen] [numOperations]", bench_mq},
+   {"radix_sort", "[numElements]", bench_radix_sort},
+   {"timerwheel", "[numTimers] [numTicks] [opsPerTick]", bench_timerwheel},
+};
+
+#define NUM_BENCHMARKS ((int) (sizeof(m_benchmarks) / sizeof(m_benchmarks[0])))
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Usage: adt_bench <name> [arguments]
+ *        adt_bench all
+ */
+int main(int argc, char **argv)
+{
+   int i;
+   if (argc < 2)
+   {
+      print_usage(argv[0]);
+      return 1;
+   }
+   for (i = 0; i < NUM_BENCHMARKS; i++)
+   {
+      if (strcmp(argv[1], "all") == 0)
+      {
+         printf("== %s ==\n", m_benchmarks[i].name);
+         m_benchmarks[i].func(0, (char**) 0);
+      }
+      else if (strcmp(argv[1], m_benchmarks[i].name) == 0)
+      {
+         m_benchmarks[i].func(argc - 2, &argv[2]);
+         return 0;
+      }
+   }
+   if (strcmp(argv[1], "all") != 0)
+   {
+      print_usage(argv[0]);
+      return 1;
+   }
+   return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void print_usage(const char *progName)
+{
+   int i;
+   printf("Usage: %s <benchmark> [arguments]\n", progName);
+   printf("       %s all\n\nBenchmarks:\n", progName);
+   for (i = 0; i < NUM_BENCHMARKS; i++)
+   {
+      printf("  %-24s %s\n", m_benchmarks[i].name, m_benchmarks[i].usage);
+   }
+}
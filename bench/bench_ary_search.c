@@ -0,0 +1,116 @@
+/*****************************************************************************
+* \file      bench_ary_search.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Benchmarks for adt_ary pointer search functions
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "adt_ary.h"
+#include "bench_util.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define DEFAULT_MAX_LEN 16384
+#define ELEMENTS_PER_LENGTH 20000000 //total number of elements compared for each array length
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static int32_t scalar_index_of(const adt_ary_t *array, const void *pElem);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Searches for an element that is not in the array (full scan) for array lengths 8, 16, 32 ... maxLen.
+ * Compares adt_ary_indexOf to a plain scalar loop.
+ */
+void bench_ary_search(int argc, char **argv)
+{
+   int32_t s32MaxLen = (int32_t) bench_arg(argc, argv, 0, DEFAULT_MAX_LEN);
+   int32_t s32Len;
+   char *pItems;
+   adt_ary_t array;
+
+   pItems = (char*) malloc((size_t) s32MaxLen + 1);
+   if (pItems == 0)
+   {
+      return;
+   }
+   adt_ary_create(&array, (void (*)(void*)) 0);
+   printf("%8s %14s %14s %8s\n", "length", "scalar ns/op", "indexOf ns/op", "speedup");
+   for (s32Len = 8; s32Len <= s32MaxLen; s32Len *= 2)
+   {
+      int32_t i;
+      int32_t s32Reps = ELEMENTS_PER_LENGTH / s32Len;
+      int32_t s32Found = 0;
+      double t0;
+      double tScalar;
+      double tSimd;
+      adt_ary_clear(&array);
+      for (i = 0; i < s32Len; i++)
+      {
+         adt_ary_push(&array, &pItems[i]);
+      }
+      t0 = bench_now();
+      for (i = 0; i < s32Reps; i++)
+      {
+         s32Found += scalar_index_of(&array, &pItems[s32MaxLen]);
+      }
+      tScalar = bench_now() - t0;
+      t0 = bench_now();
+      for (i = 0; i < s32Reps; i++)
+      {
+         s32Found += adt_ary_indexOf(&array, &pItems[s32MaxLen]);
+      }
+      tSimd = bench_now() - t0;
+      if (s32Found != (-2 * s32Reps))
+      {
+         printf("MISMATCH\n");
+      }
+      printf("%8d %14.1f %14.1f %7.2fx\n", (int) s32Len, (tScalar * 1e9) / s32Reps, (tSimd * 1e9) / s32Reps, tScalar / tSimd);
+   }
+   adt_ary_destroy(&array);
+   free(pItems);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static int32_t scalar_index_of(const adt_ary_t *array, const void *pElem)
+{
+   int32_t i;
+   for (i = 0; i < array->s32CurLen; i++)
+   {
+      if (array->pFirst[i] == pElem)
+      {
+         return i;
+      }
+   }
+   return -1;
+}
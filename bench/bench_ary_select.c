@@ -0,0 +1,160 @@
+/*****************************************************************************
+* \file      bench_ary_select.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Benchmarks for partial sort, nth_element and top-K selection
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "adt_ary.h"
+#include "adt_heap.h"
+#include "bench_util.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define DEFAULT_NUM_ELEMENTS 1000000
+#define DEFAULT_TOP_K        100
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void fill_array(adt_ary_t *array, uint32_t *pValues, int32_t s32Len);
+static bool is_equal_prefix(adt_ary_t *array, adt_ary_t *expected, int32_t s32Len);
+static void print_result(const char *name, double tSelect, double tSort, bool isEqual);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compares a full adt_ary_sort against adt_ary_partial_sort (top K), adt_ary_nth_element (median)
+ * and adt_heap_topk_t (top K, streamed) on the same random array.
+ */
+void bench_ary_select(int argc, char **argv)
+{
+   int32_t s32Len = (int32_t) bench_arg(argc, argv, 0, DEFAULT_NUM_ELEMENTS);
+   int32_t s32K = (int32_t) bench_arg(argc, argv, 1, DEFAULT_TOP_K);
+   uint32_t *pValues;
+   adt_ary_t expected;
+   adt_ary_t array;
+   adt_heap_topk_t topk;
+   double t0;
+   double tSort;
+   double tSelect;
+   int32_t i;
+   if ( (s32Len < 1) || (s32K < 1) || (s32K > s32Len) )
+   {
+      return;
+   }
+   pValues = (uint32_t*) malloc(sizeof(uint32_t) * (size_t) s32Len);
+   if (pValues == 0)
+   {
+      return;
+   }
+   adt_ary_create(&expected, (void (*)(void*)) 0);
+   adt_ary_create(&array, (void (*)(void*)) 0);
+   fill_array(&expected, pValues, s32Len);
+   t0 = bench_now();
+   adt_ary_sort(&expected, adt_u32_vlt, false);
+   tSort = bench_now() - t0;
+   printf("elements: %d, k: %d\n", (int) s32Len, (int) s32K);
+   printf("%-24s %10.3f ms\n", "adt_ary_sort", tSort * 1000.0);
+
+   fill_array(&array, pValues, s32Len);
+   t0 = bench_now();
+   adt_ary_partial_sort(&array, s32K, adt_u32_vlt, false);
+   tSelect = bench_now() - t0;
+   print_result("adt_ary_partial_sort", tSelect, tSort, is_equal_prefix(&array, &expected, s32K));
+
+   fill_array(&array, pValues, s32Len);
+   t0 = bench_now();
+   adt_ary_nth_element(&array, s32Len / 2, adt_u32_vlt, false);
+   tSelect = bench_now() - t0;
+   print_result("adt_ary_nth_element", tSelect, tSort,
+         *((uint32_t*) adt_ary_value(&array, s32Len / 2)) == *((uint32_t*) adt_ary_value(&expected, s32Len / 2)));
+
+   fill_array(&array, pValues, s32Len);
+   adt_heap_topk_create(&topk, s32K, adt_u32_vlt, false);
+   t0 = bench_now();
+   for (i = 0; i < s32Len; i++)
+   {
+      adt_heap_topk_push(&topk, adt_ary_value(&array, i), (void**) 0);
+   }
+   adt_ary_clear(&array);
+   adt_heap_topk_drain(&topk, &array);
+   tSelect = bench_now() - t0;
+   print_result("adt_heap_topk", tSelect, tSort, is_equal_prefix(&array, &expected, s32K));
+   adt_heap_topk_destroy(&topk);
+
+   adt_ary_destroy(&expected);
+   adt_ary_destroy(&array);
+   free(pValues);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Fills array with pointers into pValues, using a fixed seed so that every call produces the same order
+ */
+static void fill_array(adt_ary_t *array, uint32_t *pValues, int32_t s32Len)
+{
+   uint64_t state = 0x9E3779B97F4A7C15ull;
+   int32_t i;
+   adt_ary_clear(array);
+   adt_ary_resize(array, s32Len);
+   for (i = 0; i < s32Len; i++)
+   {
+      pValues[i] = (uint32_t) bench_rand(&state);
+      adt_ary_set(array, i, &pValues[i]);
+   }
+}
+
+/**
+ * Compares values (not pointers) since the selection functions are not stable
+ */
+static bool is_equal_prefix(adt_ary_t *array, adt_ary_t *expected, int32_t s32Len)
+{
+   int32_t i;
+   if (adt_ary_length(array) < s32Len)
+   {
+      return false;
+   }
+   for (i = 0; i < s32Len; i++)
+   {
+      if (*((uint32_t*) adt_ary_value(array, i)) != *((uint32_t*) adt_ary_value(expected, i)))
+      {
+         return false;
+      }
+   }
+   return true;
+}
+
+static void print_result(const char *name, double tSelect, double tSort, bool isEqual)
+{
+   printf("%-24s %10.3f ms  speedup: %6.2fx%s\n", name, tSelect * 1000.0, tSort / tSelect, isEqual ? "" : "  MISMATCH");
+}
@@ -0,0 +1,197 @@
+/*****************************************************************************
+* \file      bench_ary_sort.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Benchmarks for adt_ary sort functions
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "adt_ary.h"
+#include "adt_str.h"
+#include "bench_util.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define DEFAULT_NUM_ELEMENTS 2000000
+#define DEFAULT_MAX_THREADS  8
+#define DEFAULT_NUM_STRINGS  1000000
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void fill_array(adt_ary_t *array, uint32_t *pValues, int32_t s32Len);
+static void copy_array(adt_ary_t *dest, const adt_ary_t *src);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Sorts the same random array with adt_ary_sort and adt_ary_sort_parallel using 1, 2, 4 ... maxThreads threads.
+ * Verifies that the parallel result is identical to the sequential result.
+ */
+void bench_ary_sort_parallel(int argc, char **argv)
+{
+   int32_t s32Len = (int32_t) bench_arg(argc, argv, 0, DEFAULT_NUM_ELEMENTS);
+   int32_t s32MaxThreads = (int32_t) bench_arg(argc, argv, 1, DEFAULT_MAX_THREADS);
+   int32_t s32NumThreads;
+   uint32_t *pValues;
+   adt_ary_t expected;
+   adt_ary_t actual;
+   double t0;
+   double tSequential;
+
+   pValues = (uint32_t*) malloc(sizeof(uint32_t) * (size_t) s32Len);
+   if (pValues == 0)
+   {
+      return;
+   }
+   adt_ary_create(&expected, (void (*)(void*)) 0);
+   adt_ary_create(&actual, (void (*)(void*)) 0);
+   fill_array(&expected, pValues, s32Len);
+   t0 = bench_now();
+   adt_ary_sort(&expected, adt_u32_vlt, false);
+   tSequential = bench_now() - t0;
+   printf("elements: %d\n", (int) s32Len);
+   printf("%-16s %10.3f ms\n", "adt_ary_sort", tSequential * 1000.0);
+   for (s32NumThreads = 1; s32NumThreads <= s32MaxThreads; s32NumThreads *= 2)
+   {
+      double tParallel;
+      int32_t i;
+      bool isEqual = true;
+      fill_array(&actual, pValues, s32Len);
+      t0 = bench_now();
+      adt_ary_sort_parallel(&actual, adt_u32_vlt, false, s32NumThreads);
+      tParallel = bench_now() - t0;
+      for (i = 0; i < s32Len; i++)
+      {
+         if (adt_ary_value(&actual, i) != adt_ary_value(&expected, i))
+         {
+            isEqual = false;
+            break;
+         }
+      }
+      printf("threads: %-7d %10.3f ms  speedup: %5.2fx%s\n", (int) s32NumThreads, tParallel * 1000.0,
+            tSequential / tParallel, isEqual ? "" : "  MISMATCH");
+   }
+   adt_ary_destroy(&expected);
+   adt_ary_destroy(&actual);
+   free(pValues);
+}
+
+/**
+ * Sorts random strings with adt_ary_sort (adt_str_vlt on every comparison) and with
+ * adt_ary_sort_by_key (8-byte prefix key, adt_str_vlt only on ties).
+ */
+void bench_ary_sort_strings(int argc, char **argv)
+{
+   int32_t s32Len = (int32_t) bench_arg(argc, argv, 0, DEFAULT_NUM_STRINGS);
+   uint64_t state = 12345u;
+   int32_t i;
+   adt_ary_t strings;
+   adt_ary_t array;
+   double t0;
+   double tCompare;
+   double tKey;
+   bool isEqual = true;
+   adt_ary_create(&strings, adt_str_vdelete);
+   adt_ary_create(&array, (void (*)(void*)) 0);
+   adt_ary_resize(&strings, s32Len);
+   for (i = 0; i < s32Len; i++)
+   {
+      char buf[24];
+      int32_t j;
+      int32_t s32StrLen = 4 + (int32_t) (bench_rand(&state) % 16u);
+      for (j = 0; j < s32StrLen; j++)
+      {
+         buf[j] = (char) ('a' + (bench_rand(&state) % 26u));
+      }
+      buf[s32StrLen] = 0;
+      adt_ary_set(&strings, i, adt_str_new_cstr(buf));
+   }
+   copy_array(&array, &strings);
+   t0 = bench_now();
+   adt_ary_sort(&array, adt_str_vlt, false);
+   tCompare = bench_now() - t0;
+   copy_array(&strings, &array); //keep sorted result as reference, strings still owns all elements
+   adt_ary_destructor_enable(&strings, false);
+   state = 12345u;
+   for (i = 0; i < s32Len; i++)
+   {
+      //shuffle reference into array
+      int32_t s32Pos = (int32_t) (bench_rand(&state) % ((uint64_t) i + 1u));
+      adt_ary_set(&array, i, adt_ary_value(&array, s32Pos));
+      adt_ary_set(&array, s32Pos, adt_ary_value(&strings, i));
+   }
+   t0 = bench_now();
+   adt_ary_sort_by_key(&array, adt_str_prefix_key, (void*) 0, adt_str_vlt, false);
+   tKey = bench_now() - t0;
+   for (i = 0; i < s32Len; i++)
+   {
+      if (adt_str_lt((const adt_str_t*) adt_ary_value(&array, i), (const adt_str_t*) adt_ary_value(&strings, i)) ||
+          adt_str_lt((const adt_str_t*) adt_ary_value(&strings, i), (const adt_str_t*) adt_ary_value(&array, i)))
+      {
+         isEqual = false;
+         break;
+      }
+   }
+   printf("strings: %d\n", (int) s32Len);
+   printf("%-20s %10.3f ms\n", "adt_ary_sort", tCompare * 1000.0);
+   printf("%-20s %10.3f ms  speedup: %5.2fx%s\n", "adt_ary_sort_by_key", tKey * 1000.0, tCompare / tKey, isEqual ? "" : "  MISMATCH");
+   adt_ary_destructor_enable(&strings, true);
+   adt_ary_destroy(&strings);
+   adt_ary_destroy(&array);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Fills array with pointers into pValues, using a fixed seed so that every call produces the same order
+ */
+static void fill_array(adt_ary_t *array, uint32_t *pValues, int32_t s32Len)
+{
+   uint64_t state = 0x9E3779B97F4A7C15ull;
+   int32_t i;
+   adt_ary_clear(array);
+   adt_ary_resize(array, s32Len);
+   for (i = 0; i < s32Len; i++)
+   {
+      pValues[i] = (uint32_t) (bench_rand(&state) % 100000u); //many duplicates to exercise stability
+      adt_ary_set(array, i, &pValues[i]);
+   }
+}
+
+static void copy_array(adt_ary_t *dest, const adt_ary_t *src)
+{
+   int32_t i;
+   adt_ary_resize(dest, adt_ary_length(src));
+   for (i = 0; i < adt_ary_length(src); i++)
+   {
+      dest->pFirst[i] = src->pFirst[i];
+   }
+}
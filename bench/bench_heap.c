@@ -0,0 +1,520 @@
+/*****************************************************************************
+* \file      bench_heap.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Benchmarks for heaps and priority queues
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "adt_heap.h"
+#include "adt_pairheap.h"
+#include "bench_util.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define DEFAULT_QUEUE_LEN     10000
+#define DEFAULT_NUM_OPERATIONS 1000000
+#define DEFAULT_MAX_QUEUE_LEN 10000000
+#define DEFAULT_BUILD_LEN     10000000
+#define DEFAULT_MELD_LEN      1000000
+#define DEFAULT_MELD_QUEUES   16
+#define DEFAULT_BOARD_LEN     1000
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void heap_elem_push(adt_ary_t *heap, uint32_t u32Value);
+static uint32_t heap_elem_pop(adt_ary_t *heap);
+static double time_heap_elem(int32_t s32QueueLen, int32_t s32NumOperations, uint64_t *pSum);
+static double time_pq(int32_t s32Arity, int32_t s32QueueLen, int32_t s32NumOperations, uint64_t *pSum);
+static uint64_t lazy_pq_pop(adt_pq_t *pq, bool *pDeleted);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Scheduler pattern: keeps queueLen elements in the queue and performs numOperations pop+push pairs,
+ * where each new priority is the popped priority plus a random delay (0-1023).
+ * Compares adt_heap_elem_t with adt_heap_sortUp/sortDown (one malloc per element) against adt_pq_t.
+ */
+void bench_heap_pq(int argc, char **argv)
+{
+   int32_t s32QueueLen = (int32_t) bench_arg(argc, argv, 0, DEFAULT_QUEUE_LEN);
+   int32_t s32NumOperations = (int32_t) bench_arg(argc, argv, 1, DEFAULT_NUM_OPERATIONS);
+   uint64_t state = 12345u;
+   uint64_t u64SumHeap = 0u;
+   uint64_t u64SumPq = 0u;
+   adt_ary_t heap;
+   adt_pq_t pq;
+   double t0;
+   double tHeap;
+   double tPq;
+   int32_t i;
+   if (s32QueueLen < 1)
+   {
+      return;
+   }
+   adt_ary_create(&heap, adt_heap_elem_vdelete);
+   t0 = bench_now();
+   adt_ary_resize(&heap, s32QueueLen); //adt_ary_push grows the array by one element at a time
+   for (i = 0; i < s32QueueLen; i++)
+   {
+      adt_ary_set(&heap, i, adt_heap_elem_new((void*) 0, (uint32_t) (bench_rand(&state) >> 54)));
+      adt_heap_sortUp(&heap, i, ADT_MIN_HEAP);
+   }
+   for (i = 0; i < s32NumOperations; i++)
+   {
+      uint32_t u32Value = heap_elem_pop(&heap);
+      u64SumHeap += u32Value;
+      heap_elem_push(&heap, u32Value + (uint32_t) (bench_rand(&state) >> 54));
+   }
+   tHeap = bench_now() - t0;
+   adt_ary_destroy(&heap);
+
+   state = 12345u;
+   adt_pq_create(&pq, ADT_MIN_HEAP);
+   t0 = bench_now();
+   for (i = 0; i < s32QueueLen; i++)
+   {
+      adt_pq_push(&pq, (void*) 0, bench_rand(&state) >> 54);
+   }
+   for (i = 0; i < s32NumOperations; i++)
+   {
+      adt_pq_elem_t elem;
+      adt_pq_pop(&pq, &elem);
+      u64SumPq += elem.u64Priority;
+      adt_pq_push(&pq, (void*) 0, elem.u64Priority + (bench_rand(&state) >> 54));
+   }
+   tPq = bench_now() - t0;
+   adt_pq_destroy(&pq);
+
+   printf("queue length: %d, operations: %d\n", (int) s32QueueLen, (int) s32NumOperations);
+   printf("%-24s %10.3f ms\n", "adt_heap_elem_t", tHeap * 1000.0);
+   printf("%-24s %10.3f ms  speedup: %5.2fx%s\n", "adt_pq_t", tPq * 1000.0, tHeap / tPq, (u64SumHeap == u64SumPq) ? "" : "  MISMATCH");
+}
+
+/**
+ * Hold model for queue lengths 1K, 10K ... maxQueueLen: pop the top element and push it back with its priority
+ * increased by a uniform random delay in the same range as the initial priorities (0 to 2^20-1).
+ * Compares the binary heap of adt_heap_elem_t pointers against adt_pq_t with arity 2, 4 and 8.
+ * Only the pop+push pairs are timed, not the initial fill.
+ */
+void bench_heap_arity(int argc, char **argv)
+{
+   int32_t s32MaxQueueLen = (int32_t) bench_arg(argc, argv, 0, DEFAULT_MAX_QUEUE_LEN);
+   int32_t s32NumOperations = (int32_t) bench_arg(argc, argv, 1, DEFAULT_NUM_OPERATIONS);
+   int32_t s32QueueLen;
+   printf("operations: %d, time in ms\n", (int) s32NumOperations);
+   printf("%10s %12s %12s %12s %12s\n", "queue len", "heap_elem", "pq d=2", "pq d=4", "pq d=8");
+   for (s32QueueLen = 1000; s32QueueLen <= s32MaxQueueLen; s32QueueLen *= 10)
+   {
+      uint64_t u64Expected;
+      uint64_t u64Sum;
+      int32_t s32Arity;
+      bool isEqual = true;
+      double tElem = time_heap_elem(s32QueueLen, s32NumOperations, &u64Expected);
+      printf("%10d %12.3f", (int) s32QueueLen, tElem * 1000.0);
+      for (s32Arity = 2; s32Arity <= 8; s32Arity *= 2)
+      {
+         double tPq = time_pq(s32Arity, s32QueueLen, s32NumOperations, &u64Sum);
+         isEqual = isEqual && (u64Sum == u64Expected);
+         printf(" %12.3f", tPq * 1000.0);
+      }
+      printf("%s\n", isEqual ? "" : "  MISMATCH");
+      if (s32QueueLen > (INT32_MAX / 10))
+      {
+         break;
+      }
+   }
+}
+
+/**
+ * Bulk load: turns an array of numElements adt_heap_elem_t with 64-bit priorities into a min-heap,
+ * using adt_heap_sortUp for each element and using adt_heap_build.
+ * Random priorities are the best case for adt_heap_sortUp (a new element moves up less than two levels on average),
+ * descending priorities are the worst case (every element moves up to the root).
+ * Also times adt_heap_sort of the random array.
+ */
+void bench_heap_build(int argc, char **argv)
+{
+   int32_t s32NumElements = (int32_t) bench_arg(argc, argv, 0, DEFAULT_BUILD_LEN);
+   int32_t s32Order;
+   if (s32NumElements < 1)
+   {
+      return;
+   }
+   printf("elements: %d, time in ms\n", (int) s32NumElements);
+   for (s32Order = 0; s32Order < 2; s32Order++)
+   {
+      uint64_t state = 12345u;
+      adt_ary_t heap1;
+      adt_ary_t heap2;
+      double tSortUp;
+      double tBuild;
+      int32_t i;
+      bool isEqual;
+      adt_ary_create(&heap1, adt_heap_elem_vdelete);
+      adt_ary_create(&heap2, (void (*)(void*)) 0); //same elements as heap1
+      adt_ary_resize(&heap1, s32NumElements);
+      adt_ary_resize(&heap2, s32NumElements);
+      for (i = 0; i < s32NumElements; i++)
+      {
+         uint64_t u64Value = (s32Order == 0) ? bench_rand(&state) : (uint64_t) (s32NumElements - i);
+         adt_heap_elem_t *pElem = adt_heap_elem_new_u64((void*) 0, u64Value);
+         adt_ary_set(&heap1, i, pElem);
+         adt_ary_set(&heap2, i, pElem);
+      }
+      tSortUp = bench_now();
+      for (i = 1; i < s32NumElements; i++)
+      {
+         adt_heap_sortUp(&heap1, i, ADT_MIN_HEAP);
+      }
+      tSortUp = bench_now() - tSortUp;
+      tBuild = bench_now();
+      adt_heap_build(&heap2, ADT_MIN_HEAP);
+      tBuild = bench_now() - tBuild;
+      isEqual = (adt_ary_value(&heap1, 0) == adt_ary_value(&heap2, 0));
+      printf("%-10s sortUp: %10.3f  build: %10.3f  speedup: %5.2fx%s\n", (s32Order == 0) ? "random" : "descending",
+            tSortUp * 1000.0, tBuild * 1000.0, tSortUp / tBuild, isEqual ? "" : "  MISMATCH");
+      if (s32Order == 0)
+      {
+         double tSort = bench_now();
+         adt_heap_sort(&heap2, ADT_MIN_HEAP);
+         tSort = bench_now() - tSort;
+         printf("%-10s heap_sort: %10.3f\n", "random", tSort * 1000.0);
+      }
+      adt_ary_destroy(&heap2);
+      adt_ary_destroy(&heap1);
+   }
+}
+
+/**
+ * Work queue consolidation: numQueues queues with numElements elements in total are merged into the first queue.
+ * Compares re-inserting the elements with adt_heap_sortUp, adt_heap_merge and adt_pairheap_meld.
+ * Afterwards numOperations pop+push pairs are timed on the merged adt_pairheap_t and on an adt_pq_t of the same size.
+ */
+void bench_heap_meld(int argc, char **argv)
+{
+   int32_t s32NumElements = (int32_t) bench_arg(argc, argv, 0, DEFAULT_MELD_LEN);
+   int32_t s32NumQueues = (int32_t) bench_arg(argc, argv, 1, DEFAULT_MELD_QUEUES);
+   int32_t s32NumOperations = (int32_t) bench_arg(argc, argv, 2, DEFAULT_NUM_OPERATIONS);
+   adt_ary_t *pHeaps;
+   adt_pairheap_t *pPairHeaps;
+   adt_pq_t pq;
+   uint64_t state;
+   uint64_t u64SumPair = 0u;
+   uint64_t u64SumPq = 0u;
+   double tSortUp;
+   double tMerge;
+   double tMeld;
+   double tPair;
+   double tPq;
+   int32_t i;
+   int32_t j;
+   if ( (s32NumElements < 1) || (s32NumQueues < 2) )
+   {
+      return;
+   }
+   pHeaps = (adt_ary_t*) malloc(sizeof(adt_ary_t) * 2u * (size_t) s32NumQueues);
+   pPairHeaps = (adt_pairheap_t*) malloc(sizeof(adt_pairheap_t) * (size_t) s32NumQueues);
+   if ( (pHeaps == 0) || (pPairHeaps == 0) )
+   {
+      free(pHeaps);
+      free(pPairHeaps);
+      return;
+   }
+   //pHeaps[0..numQueues-1] are merged with sortUp, pHeaps[numQueues..] with adt_heap_merge
+   state = 12345u;
+   for (i = 0; i < s32NumQueues; i++)
+   {
+      int32_t s32Len = s32NumElements / s32NumQueues;
+      adt_ary_create(&pHeaps[i], adt_heap_elem_vdelete);
+      adt_ary_create(&pHeaps[s32NumQueues + i], adt_heap_elem_vdelete);
+      adt_pairheap_create(&pPairHeaps[i], ADT_MIN_HEAP);
+      adt_ary_resize(&pHeaps[i], s32Len);
+      adt_ary_resize(&pHeaps[s32NumQueues + i], s32Len);
+      for (j = 0; j < s32Len; j++)
+      {
+         uint64_t u64Priority = bench_rand(&state) >> 44;
+         adt_ary_set(&pHeaps[i], j, adt_heap_elem_new_u64((void*) 0, u64Priority));
+         adt_ary_set(&pHeaps[s32NumQueues + i], j, adt_heap_elem_new_u64((void*) 0, u64Priority));
+         adt_pairheap_push(&pPairHeaps[i], (void*) 0, u64Priority, (adt_pairheap_node_t**) 0);
+      }
+      adt_heap_build(&pHeaps[i], ADT_MIN_HEAP);
+      adt_heap_build(&pHeaps[s32NumQueues + i], ADT_MIN_HEAP);
+   }
+   tSortUp = bench_now();
+   for (i = 1; i < s32NumQueues; i++)
+   {
+      int32_t s32Len = adt_ary_length(&pHeaps[i]);
+      int32_t s32Offset = adt_ary_length(&pHeaps[0]);
+      adt_ary_destructor_enable(&pHeaps[i], false);
+      adt_ary_resize(&pHeaps[0], s32Offset + s32Len);
+      for (j = 0; j < s32Len; j++)
+      {
+         adt_ary_set(&pHeaps[0], s32Offset + j, adt_ary_value(&pHeaps[i], j));
+         adt_heap_sortUp(&pHeaps[0], s32Offset + j, ADT_MIN_HEAP);
+      }
+      adt_ary_clear(&pHeaps[i]);
+      adt_ary_destructor_enable(&pHeaps[i], true);
+   }
+   tSortUp = bench_now() - tSortUp;
+   tMerge = bench_now();
+   for (i = 1; i < s32NumQueues; i++)
+   {
+      adt_heap_merge(&pHeaps[s32NumQueues], &pHeaps[s32NumQueues + i], ADT_MIN_HEAP);
+   }
+   tMerge = bench_now() - tMerge;
+   tMeld = bench_now();
+   for (i = 1; i < s32NumQueues; i++)
+   {
+      adt_pairheap_meld(&pPairHeaps[0], &pPairHeaps[i]);
+   }
+   tMeld = bench_now() - tMeld;
+
+   //hold model on the merged queues
+   adt_pq_create(&pq, ADT_MIN_HEAP);
+   for (i = 0; i < adt_ary_length(&pHeaps[0]); i++)
+   {
+      adt_pq_push(&pq, (void*) 0, adt_heap_elem_value((adt_heap_elem_t*) adt_ary_value(&pHeaps[0], i)));
+   }
+   state = 54321u;
+   tPair = bench_now();
+   for (i = 0; i < s32NumOperations; i++)
+   {
+      adt_pq_elem_t elem;
+      adt_pairheap_pop(&pPairHeaps[0], &elem);
+      u64SumPair += elem.u64Priority;
+      adt_pairheap_push(&pPairHeaps[0], (void*) 0, elem.u64Priority + (bench_rand(&state) >> 44), (adt_pairheap_node_t**) 0);
+   }
+   tPair = bench_now() - tPair;
+   state = 54321u;
+   tPq = bench_now();
+   for (i = 0; i < s32NumOperations; i++)
+   {
+      adt_pq_elem_t elem;
+      adt_pq_pop(&pq, &elem);
+      u64SumPq += elem.u64Priority;
+      adt_pq_push(&pq, (void*) 0, elem.u64Priority + (bench_rand(&state) >> 44));
+   }
+   tPq = bench_now() - tPq;
+
+   printf("elements: %d, queues: %d, time in ms\n", (int) adt_pairheap_length(&pPairHeaps[0]), (int) s32NumQueues);
+   printf("%-28s %10.3f\n", "merge with adt_heap_sortUp", tSortUp * 1000.0);
+   printf("%-28s %10.3f\n", "adt_heap_merge", tMerge * 1000.0);
+   printf("%-28s %10.3f\n", "adt_pairheap_meld", tMeld * 1000.0);
+   printf("%d pop+push pairs:\n", (int) s32NumOperations);
+   printf("%-28s %10.3f\n", "adt_pairheap_t", tPair * 1000.0);
+   printf("%-28s %10.3f%s\n", "adt_pq_t", tPq * 1000.0, (u64SumPair == u64SumPq) ? "" : "  MISMATCH");
+   for (i = 0; i < s32NumQueues; i++)
+   {
+      adt_ary_destroy(&pHeaps[i]);
+      adt_ary_destroy(&pHeaps[s32NumQueues + i]);
+      adt_pairheap_destroy(&pPairHeaps[i]);
+   }
+   adt_pq_destroy(&pq);
+   free(pHeaps);
+   free(pPairHeaps);
+}
+
+/**
+ * Sliding leaderboard: every operation pushes a random score and evicts the lowest score once more than boardLen
+ * scores are kept. Every fourth operation also removes the highest score.
+ * Compares adt_mmheap_t against an ADT_MIN_HEAP and an ADT_MAX_HEAP adt_pq_t holding the same elements, where
+ * an element removed from one queue is marked as deleted and skipped when it reaches the top of the other.
+ */
+void bench_heap_minmax(int argc, char **argv)
+{
+   int32_t s32BoardLen = (int32_t) bench_arg(argc, argv, 0, DEFAULT_BOARD_LEN);
+   int32_t s32NumOperations = (int32_t) bench_arg(argc, argv, 1, DEFAULT_NUM_OPERATIONS);
+   uint64_t state;
+   uint64_t u64SumMm = 0u;
+   uint64_t u64SumPq = 0u;
+   adt_mmheap_t mmheap;
+   adt_pq_t minPq;
+   adt_pq_t maxPq;
+   bool *pDeleted;
+   double tMm;
+   double tPq;
+   int32_t s32Len;
+   int32_t i;
+   if ( (s32BoardLen < 1) || (s32NumOperations < 1) )
+   {
+      return;
+   }
+   pDeleted = (bool*) calloc((size_t) s32NumOperations, sizeof(bool));
+   if (pDeleted == 0)
+   {
+      return;
+   }
+   adt_mmheap_create(&mmheap);
+   adt_pq_create(&minPq, ADT_MIN_HEAP);
+   adt_pq_create(&maxPq, ADT_MAX_HEAP);
+
+   state = 12345u;
+   tMm = bench_now();
+   for (i = 0; i < s32NumOperations; i++)
+   {
+      adt_pq_elem_t elem;
+      adt_mmheap_push(&mmheap, (void*) 0, bench_rand(&state) >> 44);
+      if (adt_mmheap_length(&mmheap) > s32BoardLen)
+      {
+         adt_mmheap_pop_min(&mmheap, &elem);
+         u64SumMm += elem.u64Priority;
+      }
+      if ((i & 3) == 3)
+      {
+         adt_mmheap_pop_max(&mmheap, &elem);
+         u64SumMm += elem.u64Priority << 1;
+      }
+   }
+   tMm = bench_now() - tMm;
+
+   state = 12345u;
+   s32Len = 0;
+   tPq = bench_now();
+   for (i = 0; i < s32NumOperations; i++)
+   {
+      uint64_t u64Priority = bench_rand(&state) >> 44;
+      //the element index is stored as item so that both queues can refer to the same deleted flag
+      adt_pq_push(&minPq, (void*) (intptr_t) i, u64Priority);
+      adt_pq_push(&maxPq, (void*) (intptr_t) i, u64Priority);
+      if (++s32Len > s32BoardLen)
+      {
+         u64SumPq += lazy_pq_pop(&minPq, pDeleted);
+         s32Len--;
+      }
+      if ((i & 3) == 3)
+      {
+         u64SumPq += lazy_pq_pop(&maxPq, pDeleted) << 1;
+         s32Len--;
+      }
+   }
+   tPq = bench_now() - tPq;
+
+   printf("board length: %d, operations: %d\n", (int) s32BoardLen, (int) s32NumOperations);
+   printf("%-28s %10.3f ms\n", "2 x adt_pq_t (lazy delete)", tPq * 1000.0);
+   printf("%-28s %10.3f ms  speedup: %5.2fx%s\n", "adt_mmheap_t", tMm * 1000.0, tPq / tMm, (u64SumMm == u64SumPq) ? "" : "  MISMATCH");
+   printf("%-28s %10d\n", "adt_mmheap_t elements", (int) adt_mmheap_length(&mmheap));
+   printf("%-28s %10d\n", "adt_pq_t elements (both)", (int) (adt_pq_length(&minPq) + adt_pq_length(&maxPq)));
+   adt_mmheap_destroy(&mmheap);
+   adt_pq_destroy(&minPq);
+   adt_pq_destroy(&maxPq);
+   free(pDeleted);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void heap_elem_push(adt_ary_t *heap, uint32_t u32Value)
+{
+   adt_ary_push(heap, adt_heap_elem_new((void*) 0, u32Value));
+   adt_heap_sortUp(heap, adt_ary_length(heap) - 1, ADT_MIN_HEAP);
+}
+
+static uint32_t heap_elem_pop(adt_ary_t *heap)
+{
+   adt_heap_elem_t *pTop = (adt_heap_elem_t*) adt_ary_value(heap, 0);
+   void *pLast = adt_ary_pop(heap);
+   uint32_t u32Value = pTop->u32Value;
+   if (adt_ary_length(heap) > 0)
+   {
+      adt_ary_set(heap, 0, pLast);
+      adt_heap_sortDown(heap, 0, ADT_MIN_HEAP);
+   }
+   adt_heap_elem_delete(pTop);
+   return u32Value;
+}
+
+/**
+ * Returns time of the pop+push pairs. pSum receives the sum of all popped priorities.
+ */
+static double time_heap_elem(int32_t s32QueueLen, int32_t s32NumOperations, uint64_t *pSum)
+{
+   uint64_t state = 12345u;
+   adt_ary_t heap;
+   double t0;
+   int32_t i;
+   *pSum = 0u;
+   adt_ary_create(&heap, adt_heap_elem_vdelete);
+   adt_ary_resize(&heap, s32QueueLen);
+   for (i = 0; i < s32QueueLen; i++)
+   {
+      adt_ary_set(&heap, i, adt_heap_elem_new((void*) 0, (uint32_t) (bench_rand(&state) >> 44)));
+      adt_heap_sortUp(&heap, i, ADT_MIN_HEAP);
+   }
+   t0 = bench_now();
+   for (i = 0; i < s32NumOperations; i++)
+   {
+      uint32_t u32Value = heap_elem_pop(&heap);
+      *pSum += u32Value;
+      heap_elem_push(&heap, u32Value + (uint32_t) (bench_rand(&state) >> 44));
+   }
+   t0 = bench_now() - t0;
+   adt_ary_destroy(&heap);
+   return t0;
+}
+
+static double time_pq(int32_t s32Arity, int32_t s32QueueLen, int32_t s32NumOperations, uint64_t *pSum)
+{
+   uint64_t state = 12345u;
+   adt_pq_t pq;
+   double t0;
+   int32_t i;
+   *pSum = 0u;
+   adt_pq_create_arity(&pq, ADT_MIN_HEAP, s32Arity);
+   adt_pq_reserve(&pq, s32QueueLen);
+   for (i = 0; i < s32QueueLen; i++)
+   {
+      adt_pq_push(&pq, (void*) 0, bench_rand(&state) >> 44);
+   }
+   t0 = bench_now();
+   for (i = 0; i < s32NumOperations; i++)
+   {
+      adt_pq_elem_t elem;
+      adt_pq_pop(&pq, &elem);
+      *pSum += elem.u64Priority;
+      adt_pq_push(&pq, (void*) 0, elem.u64Priority + (bench_rand(&state) >> 44));
+   }
+   t0 = bench_now() - t0;
+   adt_pq_destroy(&pq);
+   return t0;
+}
+
+/**
+ * Pops the top element that is not yet deleted from the other queue and marks it as deleted
+ */
+static uint64_t lazy_pq_pop(adt_pq_t *pq, bool *pDeleted)
+{
+   adt_pq_elem_t elem;
+   do
+   {
+      adt_pq_pop(pq, &elem);
+   } while (pDeleted[(intptr_t) elem.pItem]);
+   pDeleted[(intptr_t) elem.pItem] = true;
+   return elem.u64Priority;
+}
@@ -0,0 +1,372 @@
+/*****************************************************************************
+* \file      bench_list.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Benchmark of adt_list node allocation
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "adt_list.h"
+#include "adt_ulist.h"
+#include "bench_util.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define DEFAULT_QUEUE_LEN      100000
+#define DEFAULT_NUM_OPERATIONS 10000000
+#define NUM_QUEUES             4
+#define NUM_ITERATIONS         100
+#define DEFAULT_SORT_LEN       1000000
+#define DEFAULT_SCAN_LEN       1000000
+#define NUM_SCANS              20
+#define DEFAULT_SUBSCRIBERS    50000
+#define DEFAULT_NUM_REMOVALS   10000
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static int u32_ptr_vlt(const void *a, const void *b);
+static void time_u32List(bool isPooled, int32_t s32QueueLen, int32_t s32NumOperations, double *pQueueTime, double *pIterTime, uint64_t *pSum);
+static double time_list_remove(bool isIndexed, uint32_t *pItems, int32_t s32NumElements, int32_t s32NumOperations, uint64_t *pSum);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Queue pattern on NUM_QUEUES adt_u32List_t of queueLen elements each: numOperations times a random queue gets
+ * its first element erased and a new element inserted at the end. Afterwards all queues are iterated
+ * NUM_ITERATIONS times. Compares nodes allocated with malloc against one node pool per list.
+ */
+void bench_list_pool(int argc, char **argv)
+{
+   int32_t s32QueueLen = (int32_t) bench_arg(argc, argv, 0, DEFAULT_QUEUE_LEN);
+   int32_t s32NumOperations = (int32_t) bench_arg(argc, argv, 1, DEFAULT_NUM_OPERATIONS);
+   double tMallocQueue;
+   double tMallocIter;
+   double tPoolQueue;
+   double tPoolIter;
+   uint64_t u64SumMalloc;
+   uint64_t u64SumPool;
+   if (s32QueueLen < 1)
+   {
+      return;
+   }
+   time_u32List(false, s32QueueLen, s32NumOperations, &tMallocQueue, &tMallocIter, &u64SumMalloc);
+   time_u32List(true, s32QueueLen, s32NumOperations, &tPoolQueue, &tPoolIter, &u64SumPool);
+   printf("queues: %d, queue length: %d, operations: %d, time in ms\n", NUM_QUEUES, (int) s32QueueLen, (int) s32NumOperations);
+   printf("%-20s %12s %12s\n", "", "erase+insert", "iterate");
+   printf("%-20s %12.3f %12.3f\n", "malloc", tMallocQueue * 1000.0, tMallocIter * 1000.0);
+   printf("%-20s %12.3f %12.3f%s\n", "adt_pool_t", tPoolQueue * 1000.0, tPoolIter * 1000.0, (u64SumMalloc == u64SumPool) ? "" : "  MISMATCH");
+   printf("%-20s %11.2fx %11.2fx\n", "speedup", tMallocQueue / tPoolQueue, tMallocIter / tPoolIter);
+}
+
+/**
+ * Sorts an adt_list_t of numElements random uint32_t items with adt_list_sort, and compares against copying the
+ * items into an adt_ary_t, sorting it with adt_ary_sort and writing the items back into the list nodes.
+ */
+void bench_list_sort(int argc, char **argv)
+{
+   int32_t s32NumElements = (int32_t) bench_arg(argc, argv, 0, DEFAULT_SORT_LEN);
+   uint32_t *pItems;
+   adt_list_t list;
+   adt_ary_t ary;
+   adt_list_elem_t *pIter;
+   uint64_t state = 12345u;
+   double tList;
+   double tAry;
+   bool isSame = true;
+   int32_t i;
+   if (s32NumElements < 1)
+   {
+      return;
+   }
+   pItems = (uint32_t*) malloc(sizeof(uint32_t) * (size_t) s32NumElements);
+   if (pItems == 0)
+   {
+      return;
+   }
+   adt_list_create(&list, (void (*)(void*)) 0);
+   adt_ary_create(&ary, (void (*)(void*)) 0);
+   for (i = 0; i < s32NumElements; i++)
+   {
+      pItems[i] = (uint32_t) bench_rand(&state);
+      adt_list_insert(&list, &pItems[i]);
+   }
+   tAry = bench_now();
+   adt_ary_resize(&ary, adt_list_length(&list));
+   for (pIter = adt_list_iter_first(&list), i = 0; pIter != 0; pIter = adt_list_iter_next(pIter), i++)
+   {
+      adt_ary_set(&ary, i, pIter->pItem);
+   }
+   adt_ary_sort(&ary, u32_ptr_vlt, false);
+   for (pIter = adt_list_iter_first(&list), i = 0; pIter != 0; pIter = adt_list_iter_next(pIter), i++)
+   {
+      pIter->pItem = adt_ary_value(&ary, i);
+   }
+   tAry = bench_now() - tAry;
+   //restore the original order before sorting the list itself
+   for (pIter = adt_list_iter_first(&list), i = 0; pIter != 0; pIter = adt_list_iter_next(pIter), i++)
+   {
+      pIter->pItem = &pItems[i];
+   }
+   tList = bench_now();
+   adt_list_sort(&list, u32_ptr_vlt, false);
+   tList = bench_now() - tList;
+   for (pIter = adt_list_iter_first(&list), i = 0; pIter != 0; pIter = adt_list_iter_next(pIter), i++)
+   {
+      isSame = isSame && (pIter->pItem == adt_ary_value(&ary, i));
+   }
+   printf("elements: %d, time in ms\n", (int) s32NumElements);
+   printf("%-32s %10.3f\n", "copy + adt_ary_sort + copy back", tAry * 1000.0);
+   printf("%-32s %10.3f%s\n", "adt_list_sort", tList * 1000.0, isSame ? "" : "  MISMATCH");
+   adt_list_destroy(&list);
+   adt_ary_destroy(&ary);
+   free(pItems);
+}
+
+/**
+ * Full scans over a list of numElements items, summing the item values. The lists are filled by appending to
+ * NUM_QUEUES lists in round-robin order, so that nodes allocated with malloc are interleaved between lists.
+ * Compares adt_list_t (malloc and pooled nodes) against adt_ulist_t.
+ */
+void bench_list_scan(int argc, char **argv)
+{
+   int32_t s32NumElements = (int32_t) bench_arg(argc, argv, 0, DEFAULT_SCAN_LEN);
+   uint32_t *pItems;
+   adt_list_t lists[NUM_QUEUES];
+   adt_list_t pooledLists[NUM_QUEUES];
+   adt_ulist_t ulists[NUM_QUEUES];
+   uint64_t u64SumList = 0u;
+   uint64_t u64SumPooled = 0u;
+   uint64_t u64SumUlist = 0u;
+   double tList;
+   double tPooled;
+   double tUlist;
+   int32_t i;
+   int32_t j;
+   if (s32NumElements < 1)
+   {
+      return;
+   }
+   pItems = (uint32_t*) malloc(sizeof(uint32_t) * (size_t) s32NumElements);
+   if (pItems == 0)
+   {
+      return;
+   }
+   for (i = 0; i < NUM_QUEUES; i++)
+   {
+      adt_list_create(&lists[i], (void (*)(void*)) 0);
+      adt_list_create_pooled(&pooledLists[i], (void (*)(void*)) 0, 0);
+      adt_ulist_create(&ulists[i], (void (*)(void*)) 0);
+   }
+   for (j = 0; j < s32NumElements; j++)
+   {
+      pItems[j] = (uint32_t) j;
+      for (i = 0; i < NUM_QUEUES; i++)
+      {
+         adt_list_insert(&lists[i], &pItems[j]);
+         adt_list_insert(&pooledLists[i], &pItems[j]);
+         adt_ulist_insert(&ulists[i], &pItems[j]);
+      }
+   }
+   tList = bench_now();
+   for (j = 0; j < NUM_SCANS; j++)
+   {
+      adt_list_elem_t *pIter;
+      for (pIter = adt_list_iter_first(&lists[j % NUM_QUEUES]); pIter != 0; pIter = adt_list_iter_next(pIter))
+      {
+         u64SumList += *(uint32_t*) pIter->pItem;
+      }
+   }
+   tList = bench_now() - tList;
+   tPooled = bench_now();
+   for (j = 0; j < NUM_SCANS; j++)
+   {
+      adt_list_elem_t *pIter;
+      for (pIter = adt_list_iter_first(&pooledLists[j % NUM_QUEUES]); pIter != 0; pIter = adt_list_iter_next(pIter))
+      {
+         u64SumPooled += *(uint32_t*) pIter->pItem;
+      }
+   }
+   tPooled = bench_now() - tPooled;
+   tUlist = bench_now();
+   for (j = 0; j < NUM_SCANS; j++)
+   {
+      adt_ulist_iter_t iter;
+      adt_ulist_iter_t *pIter;
+      for (pIter = adt_ulist_iter_first(&ulists[j % NUM_QUEUES], &iter); pIter != 0; pIter = adt_ulist_iter_next(pIter))
+      {
+         u64SumUlist += *(uint32_t*) pIter->pItem;
+      }
+   }
+   tUlist = bench_now() - tUlist;
+   printf("list length: %d, scans: %d, time in ms\n", (int) s32NumElements, NUM_SCANS);
+   printf("%-24s %10.3f\n", "adt_list_t (malloc)", tList * 1000.0);
+   printf("%-24s %10.3f  speedup: %5.2fx\n", "adt_list_t (pooled)", tPooled * 1000.0, tList / tPooled);
+   printf("%-24s %10.3f  speedup: %5.2fx%s\n", "adt_ulist_t", tUlist * 1000.0, tList / tUlist,
+         ((u64SumList == u64SumPooled) && (u64SumList == u64SumUlist)) ? "" : "  MISMATCH");
+   for (i = 0; i < NUM_QUEUES; i++)
+   {
+      adt_list_destroy(&lists[i]);
+      adt_list_destroy(&pooledLists[i]);
+      adt_ulist_destroy(&ulists[i]);
+   }
+   free(pItems);
+}
+
+/**
+ * Subscriber list pattern: an adt_list_t of numElements items where numOperations times a random item is removed
+ * with adt_list_remove and added back with adt_list_insert_unique. Compares the linear search against the item index.
+ */
+void bench_list_remove(int argc, char **argv)
+{
+   int32_t s32NumElements = (int32_t) bench_arg(argc, argv, 0, DEFAULT_SUBSCRIBERS);
+   int32_t s32NumOperations = (int32_t) bench_arg(argc, argv, 1, DEFAULT_NUM_REMOVALS);
+   uint32_t *pItems;
+   uint64_t u64SumLinear;
+   uint64_t u64SumIndexed;
+   double tLinear;
+   double tIndexed;
+   int32_t i;
+   if (s32NumElements < 1)
+   {
+      return;
+   }
+   pItems = (uint32_t*) malloc(sizeof(uint32_t) * (size_t) s32NumElements);
+   if (pItems == 0)
+   {
+      return;
+   }
+   for (i = 0; i < s32NumElements; i++)
+   {
+      pItems[i] = (uint32_t) i;
+   }
+   tLinear = time_list_remove(false, pItems, s32NumElements, s32NumOperations, &u64SumLinear);
+   tIndexed = time_list_remove(true, pItems, s32NumElements, s32NumOperations, &u64SumIndexed);
+   printf("list length: %d, operations: %d, time in ms\n", (int) s32NumElements, (int) s32NumOperations);
+   printf("%-24s %10.3f\n", "linear search", tLinear * 1000.0);
+   printf("%-24s %10.3f  speedup: %7.1fx%s\n", "item index", tIndexed * 1000.0, tLinear / tIndexed,
+         (u64SumLinear == u64SumIndexed) ? "" : "  MISMATCH");
+   free(pItems);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static int u32_ptr_vlt(const void *a, const void *b)
+{
+   return (*(const uint32_t*) a) < (*(const uint32_t*) b);
+}
+
+static void time_u32List(bool isPooled, int32_t s32QueueLen, int32_t s32NumOperations, double *pQueueTime, double *pIterTime, uint64_t *pSum)
+{
+   adt_u32List_t lists[NUM_QUEUES];
+   uint64_t state = 12345u;
+   uint64_t u64Sum = 0u;
+   double t0;
+   int32_t i;
+   int32_t j;
+   for (i = 0; i < NUM_QUEUES; i++)
+   {
+      if (isPooled)
+      {
+         adt_u32List_create_pooled(&lists[i], 0);
+      }
+      else
+      {
+         adt_u32List_create(&lists[i]);
+      }
+   }
+   //fill the queues in round-robin order so that malloc interleaves the nodes of different lists
+   for (j = 0; j < s32QueueLen; j++)
+   {
+      for (i = 0; i < NUM_QUEUES; i++)
+      {
+         adt_u32List_insert(&lists[i], (uint32_t) j);
+      }
+   }
+   t0 = bench_now();
+   for (j = 0; j < s32NumOperations; j++)
+   {
+      adt_u32List_t *pList = &lists[bench_rand(&state) % NUM_QUEUES];
+      adt_u32List_erase(pList, adt_u32List_iter_first(pList));
+      adt_u32List_insert(pList, (uint32_t) j);
+   }
+   *pQueueTime = bench_now() - t0;
+   t0 = bench_now();
+   for (j = 0; j < NUM_ITERATIONS; j++)
+   {
+      for (i = 0; i < NUM_QUEUES; i++)
+      {
+         adt_u32List_elem_t *pIter;
+         for (pIter = adt_u32List_iter_first(&lists[i]); pIter != 0; pIter = adt_u32List_iter_next(pIter))
+         {
+            u64Sum += pIter->item;
+         }
+      }
+   }
+   *pIterTime = bench_now() - t0;
+   *pSum = u64Sum;
+   for (i = 0; i < NUM_QUEUES; i++)
+   {
+      adt_u32List_destroy(&lists[i]);
+   }
+}
+
+static double time_list_remove(bool isIndexed, uint32_t *pItems, int32_t s32NumElements, int32_t s32NumOperations, uint64_t *pSum)
+{
+   adt_list_t list;
+   adt_list_elem_t *pIter;
+   uint64_t state = 12345u;
+   double t;
+   int32_t i;
+   adt_list_create(&list, (void (*)(void*)) 0);
+   if (isIndexed)
+   {
+      adt_list_index_enable(&list, true);
+   }
+   for (i = 0; i < s32NumElements; i++)
+   {
+      adt_list_insert(&list, &pItems[i]);
+   }
+   t = bench_now();
+   for (i = 0; i < s32NumOperations; i++)
+   {
+      uint32_t *pItem = &pItems[bench_rand(&state) % (uint64_t) s32NumElements];
+      adt_list_remove(&list, pItem);
+      adt_list_insert_unique(&list, pItem);
+   }
+   t = bench_now() - t;
+   //order of the list after the operations, weighted by position
+   *pSum = 0u;
+   for (pIter = adt_list_iter_first(&list), i = 0; pIter != 0; pIter = adt_list_iter_next(pIter), i++)
+   {
+      *pSum += (uint64_t) (*(uint32_t*) pIter->pItem) * (uint64_t) i;
+   }
+   adt_list_destroy(&list);
+   return t;
+}
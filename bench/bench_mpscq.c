@@ -0,0 +1,220 @@
+/*****************************************************************************
+* \file      bench_mpscq.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Benchmark of adt_mpscq against a mutex protected adt_list_t
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "adt_list.h"
+#include "adt_mpscq.h"
+#include "bench_util.h"
+#if (ADT_THREADS_ENABLE)
+#include <pthread.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define DEFAULT_MAX_PRODUCERS  8
+#define DEFAULT_NUM_MESSAGES   4000000
+#define MAX_PRODUCERS          64
+
+typedef struct msg_tag
+{
+   adt_mpscq_node_t node;
+   uint32_t u32Value;
+} msg_t;
+
+#if (ADT_THREADS_ENABLE)
+typedef struct locked_list_tag
+{
+   pthread_mutex_t lock;
+   adt_list_t list;
+} locked_list_t;
+
+typedef struct producer_tag
+{
+   adt_mpscq_t *queue;        //used when not NULL
+   locked_list_t *lockedList;
+   msg_t *pMsgs;
+   int32_t s32NumMessages;
+} producer_t;
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+#if (ADT_THREADS_ENABLE)
+static void* producer_main(void *arg);
+static double run_producers(adt_mpscq_t *queue, locked_list_t *lockedList, msg_t *pMsgs, int32_t s32NumProducers, int32_t s32NumMessages, uint64_t *pSum);
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Hand-off pattern: numProducers threads send numMessages messages in total to one consumer (the main thread).
+ * Compares adt_list_t behind a mutex (one malloc per message, the consumer pops one message per lock) against
+ * adt_mpscq_t (messages embed the queue node, the consumer takes batches with adt_mpscq_pop_all),
+ * for 1, 2, 4 ... maxProducers producers. Throughput is given in million messages per second.
+ */
+void bench_mpscq(int argc, char **argv)
+{
+#if (ADT_THREADS_ENABLE)
+   int32_t s32MaxProducers = (int32_t) bench_arg(argc, argv, 0, DEFAULT_MAX_PRODUCERS);
+   int32_t s32NumMessages = (int32_t) bench_arg(argc, argv, 1, DEFAULT_NUM_MESSAGES);
+   int32_t s32NumProducers;
+   msg_t *pMsgs;
+   if ( (s32MaxProducers < 1) || (s32MaxProducers > MAX_PRODUCERS) || (s32NumMessages < 1) )
+   {
+      return;
+   }
+   pMsgs = (msg_t*) malloc(sizeof(msg_t) * (size_t) s32NumMessages);
+   if (pMsgs == 0)
+   {
+      return;
+   }
+   printf("messages: %d, throughput in Mmsg/s\n", (int) s32NumMessages);
+   printf("%10s %14s %14s %8s\n", "producers", "mutex+adt_list", "adt_mpscq", "speedup");
+   for (s32NumProducers = 1; s32NumProducers <= s32MaxProducers; s32NumProducers *= 2)
+   {
+      locked_list_t lockedList;
+      adt_mpscq_t queue;
+      int32_t s32NumPerProducer = s32NumMessages / s32NumProducers;
+      double dTotal = (double) (s32NumPerProducer * s32NumProducers);
+      double tLocked;
+      double tQueue;
+      uint64_t u64SumLocked;
+      uint64_t u64SumQueue;
+      pthread_mutex_init(&lockedList.lock, (const pthread_mutexattr_t*) 0);
+      adt_list_create(&lockedList.list, (void (*)(void*)) 0);
+      adt_mpscq_create(&queue);
+      tLocked = run_producers((adt_mpscq_t*) 0, &lockedList, pMsgs, s32NumProducers, s32NumPerProducer, &u64SumLocked);
+      tQueue = run_producers(&queue, (locked_list_t*) 0, pMsgs, s32NumProducers, s32NumPerProducer, &u64SumQueue);
+      printf("%10d %14.2f %14.2f %7.2fx%s\n", (int) s32NumProducers, dTotal / tLocked * 1e-6, dTotal / tQueue * 1e-6,
+            tLocked / tQueue, (u64SumLocked == u64SumQueue) ? "" : "  MISMATCH");
+      adt_mpscq_destroy(&queue);
+      adt_list_destroy(&lockedList.list);
+      pthread_mutex_destroy(&lockedList.lock);
+   }
+   free(pMsgs);
+#else
+   (void) argc;
+   (void) argv;
+   printf("adt_mpscq benchmark requires ADT_THREADS_ENABLE\n");
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+#if (ADT_THREADS_ENABLE)
+static void* producer_main(void *arg)
+{
+   producer_t *pProducer = (producer_t*) arg;
+   int32_t i;
+   for (i = 0; i < pProducer->s32NumMessages; i++)
+   {
+      msg_t *pMsg = &pProducer->pMsgs[i];
+      if (pProducer->queue != 0)
+      {
+         adt_mpscq_push(pProducer->queue, &pMsg->node);
+      }
+      else
+      {
+         pthread_mutex_lock(&pProducer->lockedList->lock);
+         adt_list_insert(&pProducer->lockedList->list, pMsg);
+         pthread_mutex_unlock(&pProducer->lockedList->lock);
+      }
+   }
+   return (void*) 0;
+}
+
+/**
+ * Starts the producers and consumes all messages in the calling thread. Returns wall-clock time from start until
+ * the last message has been consumed.
+ */
+static double run_producers(adt_mpscq_t *queue, locked_list_t *lockedList, msg_t *pMsgs, int32_t s32NumProducers, int32_t s32NumMessages, uint64_t *pSum)
+{
+   pthread_t threads[MAX_PRODUCERS];
+   producer_t producers[MAX_PRODUCERS];
+   int32_t s32NumTotal = s32NumMessages * s32NumProducers;
+   int32_t s32NumReceived = 0;
+   uint64_t u64Sum = 0u;
+   double t0;
+   int32_t i;
+   for (i = 0; i < s32NumTotal; i++)
+   {
+      pMsgs[i].u32Value = (uint32_t) i;
+   }
+   t0 = bench_now();
+   for (i = 0; i < s32NumProducers; i++)
+   {
+      producers[i].queue = queue;
+      producers[i].lockedList = lockedList;
+      producers[i].pMsgs = &pMsgs[i * s32NumMessages];
+      producers[i].s32NumMessages = s32NumMessages;
+      pthread_create(&threads[i], (const pthread_attr_t*) 0, producer_main, &producers[i]);
+   }
+   while (s32NumReceived < s32NumTotal)
+   {
+      if (queue != 0)
+      {
+         adt_mpscq_node_t *pNode = adt_mpscq_pop_all(queue);
+         while (pNode != 0)
+         {
+            u64Sum += ADT_MPSCQ_ENTRY(pNode, msg_t, node)->u32Value;
+            s32NumReceived++;
+            pNode = adt_mpscq_node_next(pNode);
+         }
+      }
+      else
+      {
+         msg_t *pMsg = (msg_t*) 0;
+         pthread_mutex_lock(&lockedList->lock);
+         if (!adt_list_is_empty(&lockedList->list))
+         {
+            adt_list_elem_t *pIter = adt_list_iter_first(&lockedList->list);
+            pMsg = (msg_t*) pIter->pItem;
+            adt_list_erase(&lockedList->list, pIter);
+         }
+         pthread_mutex_unlock(&lockedList->lock);
+         if (pMsg != 0)
+         {
+            u64Sum += pMsg->u32Value;
+            s32NumReceived++;
+         }
+      }
+   }
+   for (i = 0; i < s32NumProducers; i++)
+   {
+      pthread_join(threads[i], (void**) 0);
+   }
+   *pSum = u64Sum;
+   return bench_now() - t0;
+}
+#endif
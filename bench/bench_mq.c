@@ -0,0 +1,179 @@
+/*****************************************************************************
+* \file      bench_mq.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Thread scaling of adt_mq against a locked adt_pq
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "adt_mq.h"
+#include "bench_util.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define DEFAULT_MAX_THREADS    32
+#define DEFAULT_QUEUE_LEN      100000
+#define DEFAULT_NUM_OPERATIONS 2000000
+#define MAX_THREADS            256
+
+#if (ADT_THREADS_ENABLE)
+typedef struct locked_pq_tag
+{
+   pthread_mutex_t lock;
+   adt_pq_t pq;
+} locked_pq_t;
+
+typedef struct worker_tag
+{
+   adt_mq_t *mq;           //used when not NULL
+   locked_pq_t *lockedPq;
+   int32_t s32NumOperations;
+   uint64_t u64Seed;
+} worker_t;
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+#if (ADT_THREADS_ENABLE)
+static void* worker_main(void *arg);
+static double run_workers(adt_mq_t *mq, locked_pq_t *lockedPq, int32_t s32NumThreads, int32_t s32NumOperations);
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Worker pool pattern: numThreads threads share one queue holding queueLen elements. In total numOperations
+ * pop+push pairs are performed, where each pushed priority is the popped priority plus a random delay.
+ * Compares one adt_pq_t behind a mutex against adt_mq_t with ADT_MQ_QUEUES_PER_THREAD queues per thread,
+ * for 1, 2, 4 ... maxThreads threads. Throughput is given in million pop+push pairs per second.
+ */
+void bench_mq(int argc, char **argv)
+{
+#if (ADT_THREADS_ENABLE)
+   int32_t s32MaxThreads = (int32_t) bench_arg(argc, argv, 0, DEFAULT_MAX_THREADS);
+   int32_t s32QueueLen = (int32_t) bench_arg(argc, argv, 1, DEFAULT_QUEUE_LEN);
+   int32_t s32NumOperations = (int32_t) bench_arg(argc, argv, 2, DEFAULT_NUM_OPERATIONS);
+   int32_t s32NumThreads;
+   if ( (s32MaxThreads < 1) || (s32MaxThreads > MAX_THREADS) || (s32QueueLen < 1) || (s32NumOperations < 1) )
+   {
+      return;
+   }
+   printf("queue length: %d, operations: %d, throughput in Mops/s\n", (int) s32QueueLen, (int) s32NumOperations);
+   printf("%8s %14s %14s %8s\n", "threads", "mutex+adt_pq", "adt_mq", "speedup");
+   for (s32NumThreads = 1; s32NumThreads <= s32MaxThreads; s32NumThreads *= 2)
+   {
+      uint64_t state = 12345u;
+      locked_pq_t lockedPq;
+      adt_mq_t mq;
+      double tLocked;
+      double tMq;
+      double dTotal;
+      int32_t i;
+      pthread_mutex_init(&lockedPq.lock, (const pthread_mutexattr_t*) 0);
+      adt_pq_create(&lockedPq.pq, ADT_MIN_HEAP);
+      adt_mq_create(&mq, ADT_MIN_HEAP, s32NumThreads * ADT_MQ_QUEUES_PER_THREAD);
+      adt_pq_reserve(&lockedPq.pq, s32QueueLen);
+      for (i = 0; i < s32QueueLen; i++)
+      {
+         uint64_t u64Priority = bench_rand(&state) >> 44;
+         adt_pq_push(&lockedPq.pq, (void*) 0, u64Priority);
+         adt_mq_push(&mq, (void*) 0, u64Priority);
+      }
+      tLocked = run_workers((adt_mq_t*) 0, &lockedPq, s32NumThreads, s32NumOperations);
+      tMq = run_workers(&mq, (locked_pq_t*) 0, s32NumThreads, s32NumOperations);
+      dTotal = (double) ((s32NumOperations / s32NumThreads) * s32NumThreads);
+      printf("%8d %14.2f %14.2f %7.2fx\n", (int) s32NumThreads, dTotal / tLocked * 1e-6, dTotal / tMq * 1e-6, tLocked / tMq);
+      adt_mq_destroy(&mq);
+      adt_pq_destroy(&lockedPq.pq);
+      pthread_mutex_destroy(&lockedPq.lock);
+   }
+#else
+   (void) argc;
+   (void) argv;
+   printf("adt_mq benchmark requires ADT_THREADS_ENABLE\n");
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+#if (ADT_THREADS_ENABLE)
+static void* worker_main(void *arg)
+{
+   worker_t *pWorker = (worker_t*) arg;
+   int32_t i;
+   for (i = 0; i < pWorker->s32NumOperations; i++)
+   {
+      adt_pq_elem_t elem;
+      uint64_t u64Delay = bench_rand(&pWorker->u64Seed) >> 44;
+      if (pWorker->mq != 0)
+      {
+         if (adt_mq_pop(pWorker->mq, &elem) == ADT_NO_ERROR)
+         {
+            adt_mq_push(pWorker->mq, elem.pItem, elem.u64Priority + u64Delay);
+         }
+      }
+      else
+      {
+         pthread_mutex_lock(&pWorker->lockedPq->lock);
+         if (adt_pq_pop(&pWorker->lockedPq->pq, &elem) == ADT_NO_ERROR)
+         {
+            adt_pq_push(&pWorker->lockedPq->pq, elem.pItem, elem.u64Priority + u64Delay);
+         }
+         pthread_mutex_unlock(&pWorker->lockedPq->lock);
+      }
+   }
+   return (void*) 0;
+}
+
+/**
+ * Returns wall-clock time for s32NumThreads threads to perform s32NumOperations pop+push pairs in total
+ */
+static double run_workers(adt_mq_t *mq, locked_pq_t *lockedPq, int32_t s32NumThreads, int32_t s32NumOperations)
+{
+   pthread_t threads[MAX_THREADS];
+   worker_t workers[MAX_THREADS];
+   double t0;
+   int32_t i;
+   t0 = bench_now();
+   for (i = 0; i < s32NumThreads; i++)
+   {
+      workers[i].mq = mq;
+      workers[i].lockedPq = lockedPq;
+      workers[i].s32NumOperations = s32NumOperations / s32NumThreads;
+      workers[i].u64Seed = (uint64_t) i + 1u;
+      pthread_create(&threads[i], (const pthread_attr_t*) 0, worker_main, &workers[i]);
+   }
+   for (i = 0; i < s32NumThreads; i++)
+   {
+      pthread_join(threads[i], (void**) 0);
+   }
+   return bench_now() - t0;
+}
+#endif
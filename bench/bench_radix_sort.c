@@ -0,0 +1,124 @@
+/*****************************************************************************
+* \file      bench_radix_sort.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Benchmarks for radix sort functions
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "adt_ary.h"
+#include "adt_vec.h"
+#include "bench_util.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define DEFAULT_NUM_ELEMENTS 10000000
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void fill_vec(adt_vec_t *vec, int32_t s32Len);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Sorts random uint32_t values with comparison sort and radix sort, both for adt_vec_t (values) and adt_ary_t (pointers)
+ */
+void bench_radix_sort(int argc, char **argv)
+{
+   int32_t s32Len = (int32_t) bench_arg(argc, argv, 0, DEFAULT_NUM_ELEMENTS);
+   int32_t i;
+   adt_vec_t vec;
+   adt_ary_t array;
+   double t0;
+   double tCompare;
+   double tRadix;
+   bool isSorted = true;
+
+   if (adt_vec_create(&vec, sizeof(uint32_t), (void (*)(void*)) 0) != ADT_NO_ERROR)
+   {
+      return;
+   }
+   adt_ary_create(&array, (void (*)(void*)) 0);
+   printf("elements: %d\n", (int) s32Len);
+
+   fill_vec(&vec, s32Len);
+   t0 = bench_now();
+   adt_vec_sort(&vec, adt_u32_vlt, false);
+   tCompare = bench_now() - t0;
+   fill_vec(&vec, s32Len);
+   t0 = bench_now();
+   adt_vec_sort_u32(&vec, false);
+   tRadix = bench_now() - t0;
+   printf("%-24s %10.3f ms\n", "adt_vec_sort", tCompare * 1000.0);
+   printf("%-24s %10.3f ms  speedup: %5.2fx\n", "adt_vec_sort_u32", tRadix * 1000.0, tCompare / tRadix);
+
+   //vec still holds sorted values, shuffle pointers to them
+   fill_vec(&vec, s32Len);
+   adt_ary_resize(&array, s32Len);
+   for (i = 0; i < s32Len; i++)
+   {
+      adt_ary_set(&array, i, adt_vec_get(&vec, i));
+   }
+   t0 = bench_now();
+   adt_ary_sort(&array, adt_u32_vlt, false);
+   tCompare = bench_now() - t0;
+   for (i = 0; i < s32Len; i++)
+   {
+      adt_ary_set(&array, i, adt_vec_get(&vec, i));
+   }
+   t0 = bench_now();
+   adt_ary_sort_u32(&array, false);
+   tRadix = bench_now() - t0;
+   for (i = 1; i < s32Len; i++)
+   {
+      if (*((uint32_t*) adt_ary_value(&array, i - 1)) > *((uint32_t*) adt_ary_value(&array, i)))
+      {
+         isSorted = false;
+         break;
+      }
+   }
+   printf("%-24s %10.3f ms\n", "adt_ary_sort", tCompare * 1000.0);
+   printf("%-24s %10.3f ms  speedup: %5.2fx%s\n", "adt_ary_sort_u32", tRadix * 1000.0, tCompare / tRadix, isSorted? "" : "  NOT SORTED");
+   adt_ary_destroy(&array);
+   adt_vec_destroy(&vec);
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void fill_vec(adt_vec_t *vec, int32_t s32Len)
+{
+   uint64_t state = 0x9E3779B97F4A7C15ull;
+   int32_t i;
+   adt_vec_resize(vec, s32Len);
+   for (i = 0; i < s32Len; i++)
+   {
+      *((uint32_t*) adt_vec_get(vec, i)) = (uint32_t) bench_rand(&state);
+   }
+}
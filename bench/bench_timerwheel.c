@@ -0,0 +1,227 @@
+/*****************************************************************************
+* \file      bench_timerwheel.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Benchmark of adt_timerwheel against adt_iheap
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdio.h>
+#include <stdlib.h>
+#include "adt_heap.h"
+#include "adt_timerwheel.h"
+#include "bench_util.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define DEFAULT_NUM_TIMERS    1000000
+#define DEFAULT_NUM_TICKS     10000
+#define DEFAULT_OPS_PER_TICK  100
+#define SHORT_DELAY_PERCENT   95
+#define MAX_SHORT_DELAY       10000u   //10 s with 1 ms ticks
+#define MAX_LONG_DELAY        3600000u //1 h with 1 ms ticks
+
+typedef struct bench_timer_tag
+{
+   adt_timer_t timer;
+   adt_heap_handle_t handle;
+   uint32_t u32Id;
+} bench_timer_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static uint64_t timer_delay(uint32_t u32Id, uint64_t u64Tick);
+static double time_timerwheel(int32_t s32NumTimers, int32_t s32NumTicks, int32_t s32OpsPerTick, uint64_t *pSum);
+static double time_iheap(int32_t s32NumTimers, int32_t s32NumTicks, int32_t s32OpsPerTick, uint64_t *pSum);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Timer service pattern with 1 ms ticks: numTimers timers are active, 95% with delays up to 10 s and the rest up to 1 h.
+ * Every tick opsPerTick random timers are cancelled or restarted, then the tick is processed and every expired timer
+ * is restarted. Compares adt_timerwheel_t against adt_iheap_t. Both must produce the same checksum.
+ */
+void bench_timerwheel(int argc, char **argv)
+{
+   int32_t s32NumTimers = (int32_t) bench_arg(argc, argv, 0, DEFAULT_NUM_TIMERS);
+   int32_t s32NumTicks = (int32_t) bench_arg(argc, argv, 1, DEFAULT_NUM_TICKS);
+   int32_t s32OpsPerTick = (int32_t) bench_arg(argc, argv, 2, DEFAULT_OPS_PER_TICK);
+   uint64_t u64SumWheel = 0u;
+   uint64_t u64SumHeap = 0u;
+   double tWheel;
+   double tHeap;
+   if ( (s32NumTimers < 1) || (s32NumTicks < 1) || (s32OpsPerTick < 0) )
+   {
+      return;
+   }
+   tWheel = time_timerwheel(s32NumTimers, s32NumTicks, s32OpsPerTick, &u64SumWheel);
+   tHeap = time_iheap(s32NumTimers, s32NumTicks, s32OpsPerTick, &u64SumHeap);
+   printf("timers=%d ticks=%d opsPerTick=%d\n", (int) s32NumTimers, (int) s32NumTicks, (int) s32OpsPerTick);
+   printf("  adt_iheap_t      %8.3f s\n", tHeap);
+   printf("  adt_timerwheel_t %8.3f s  (%.2fx)%s\n", tWheel, tHeap / tWheel, (u64SumWheel == u64SumHeap) ? "" : "  MISMATCH");
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Delay depends only on timer id and current tick so both implementations restart timers identically
+ * regardless of the order in which expired timers are returned.
+ */
+static uint64_t timer_delay(uint32_t u32Id, uint64_t u64Tick)
+{
+   uint64_t state = ((((uint64_t) u32Id) << 32) ^ u64Tick) + 0x9E3779B97F4A7C15ull;
+   uint64_t r = bench_rand(&state);
+   if ( (r % 100u) < SHORT_DELAY_PERCENT )
+   {
+      return 1u + ((r >> 8) % MAX_SHORT_DELAY);
+   }
+   return 1u + ((r >> 8) % MAX_LONG_DELAY);
+}
+
+/**
+ * Returns time of the tick loop. pSum receives a checksum of all (timer id, expiry tick) pairs.
+ */
+static double time_timerwheel(int32_t s32NumTimers, int32_t s32NumTicks, int32_t s32OpsPerTick, uint64_t *pSum)
+{
+   uint64_t state = 12345u;
+   bench_timer_t *pTimers = (bench_timer_t*) malloc(sizeof(bench_timer_t) * s32NumTimers);
+   adt_timerwheel_t wheel;
+   adt_ary_t expired;
+   uint64_t u64Tick;
+   double t0;
+   int32_t i;
+   *pSum = 0u;
+   if (pTimers == 0)
+   {
+      return 0.0;
+   }
+   adt_timerwheel_create(&wheel, 0u);
+   adt_ary_create(&expired, (void (*)(void*)) 0);
+   for (i = 0; i < s32NumTimers; i++)
+   {
+      pTimers[i].u32Id = (uint32_t) i;
+      adt_timer_create(&pTimers[i].timer, &pTimers[i]);
+      adt_timerwheel_schedule(&wheel, &pTimers[i].timer, timer_delay((uint32_t) i, 0u));
+   }
+   t0 = bench_now();
+   for (u64Tick = 1u; u64Tick <= (uint64_t) s32NumTicks; u64Tick++)
+   {
+      for (i = 0; i < s32OpsPerTick; i++)
+      {
+         uint64_t r = bench_rand(&state);
+         bench_timer_t *pTimer = &pTimers[(r >> 32) % (uint64_t) s32NumTimers];
+         if ( (r & 1u) != 0u )
+         {
+            adt_timerwheel_cancel(&wheel, &pTimer->timer);
+         }
+         else
+         {
+            adt_timerwheel_schedule(&wheel, &pTimer->timer, u64Tick + timer_delay(pTimer->u32Id, u64Tick));
+         }
+      }
+      adt_timerwheel_advance(&wheel, u64Tick, &expired);
+      for (i = 0; i < adt_ary_length(&expired); i++)
+      {
+         bench_timer_t *pTimer = (bench_timer_t*) ((adt_timer_t*) adt_ary_value(&expired, i))->pItem;
+         *pSum += (uint64_t) pTimer->u32Id * u64Tick;
+         adt_timerwheel_schedule(&wheel, &pTimer->timer, u64Tick + timer_delay(pTimer->u32Id, u64Tick));
+      }
+      adt_ary_resize(&expired, 0);
+   }
+   t0 = bench_now() - t0;
+   adt_ary_destroy(&expired);
+   adt_timerwheel_destroy(&wheel);
+   free(pTimers);
+   return t0;
+}
+
+static double time_iheap(int32_t s32NumTimers, int32_t s32NumTicks, int32_t s32OpsPerTick, uint64_t *pSum)
+{
+   uint64_t state = 12345u;
+   bench_timer_t *pTimers = (bench_timer_t*) malloc(sizeof(bench_timer_t) * s32NumTimers);
+   adt_iheap_t heap;
+   uint64_t u64Tick;
+   double t0;
+   int32_t i;
+   *pSum = 0u;
+   if (pTimers == 0)
+   {
+      return 0.0;
+   }
+   adt_iheap_create(&heap, ADT_MIN_HEAP);
+   adt_iheap_reserve(&heap, s32NumTimers);
+   for (i = 0; i < s32NumTimers; i++)
+   {
+      pTimers[i].u32Id = (uint32_t) i;
+      adt_iheap_push(&heap, &pTimers[i], timer_delay((uint32_t) i, 0u), &pTimers[i].handle);
+   }
+   t0 = bench_now();
+   for (u64Tick = 1u; u64Tick <= (uint64_t) s32NumTicks; u64Tick++)
+   {
+      for (i = 0; i < s32OpsPerTick; i++)
+      {
+         uint64_t r = bench_rand(&state);
+         bench_timer_t *pTimer = &pTimers[(r >> 32) % (uint64_t) s32NumTimers];
+         if ( (r & 1u) != 0u )
+         {
+            if (pTimer->handle != ADT_HEAP_INVALID_HANDLE)
+            {
+               adt_iheap_remove(&heap, pTimer->handle, (adt_pq_elem_t*) 0);
+               pTimer->handle = ADT_HEAP_INVALID_HANDLE;
+            }
+         }
+         else if (pTimer->handle != ADT_HEAP_INVALID_HANDLE)
+         {
+            adt_iheap_update(&heap, pTimer->handle, u64Tick + timer_delay(pTimer->u32Id, u64Tick));
+         }
+         else
+         {
+            adt_iheap_push(&heap, pTimer, u64Tick + timer_delay(pTimer->u32Id, u64Tick), &pTimer->handle);
+         }
+      }
+      while (!adt_iheap_is_empty(&heap))
+      {
+         adt_pq_elem_t elem;
+         bench_timer_t *pTimer;
+         adt_iheap_get(&heap, adt_iheap_top(&heap), &elem);
+         if (elem.u64Priority > u64Tick)
+         {
+            break;
+         }
+         adt_iheap_pop(&heap, &elem);
+         pTimer = (bench_timer_t*) elem.pItem;
+         *pSum += (uint64_t) pTimer->u32Id * u64Tick;
+         adt_iheap_push(&heap, pTimer, u64Tick + timer_delay(pTimer->u32Id, u64Tick), &pTimer->handle);
+      }
+   }
+   t0 = bench_now() - t0;
+   adt_iheap_destroy(&heap);
+   free(pTimers);
+   return t0;
+}
@@ -0,0 +1,80 @@
+/*****************************************************************************
+* \file      bench_util.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Helper functions for ADT benchmarks
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+typedef void (bench_func_t)(int argc, char **argv);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Returns monotonic time in seconds
+ */
+static inline double bench_now(void)
+{
+   struct timespec ts;
+   timespec_get(&ts, TIME_UTC);
+   return (double) ts.tv_sec + ((double) ts.tv_nsec * 1e-9);
+}
+
+/**
+ * xorshift64* pseudo random number generator. State must be non-zero.
+ */
+static inline uint64_t bench_rand(uint64_t *pState)
+{
+   uint64_t x = *pState;
+   x ^= x >> 12;
+   x ^= x << 25;
+   x ^= x >> 27;
+   *pState = x;
+   return x * 0x2545F4914F6CDD1Dull;
+}
+
+/**
+ * Returns argv[index] converted to integer or defaultValue when argument is missing
+ */
+static inline long bench_arg(int argc, char **argv, int index, long defaultValue)
+{
+   if (index < argc)
+   {
+      return strtol(argv[index], (char**) 0, 0);
+   }
+   return defaultValue;
+}
+
+#endif //BENCH_UTIL_H
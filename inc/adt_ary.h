@@ -38,6 +38,19 @@ typedef uint8_t bool;
 #include <stdbool.h>
 #endif
 #include "adt_error.h"
+#include "adt_radix.h"
+
+#ifndef ADT_THREADS_ENABLE
+#define ADT_THREADS_ENABLE 0
+#endif
+
+#ifndef ADT_SIMD_ENABLE
+#define ADT_SIMD_ENABLE 1 //use SSE2/AVX2/NEON kernels where available
+#endif
+
+#ifndef ADT_ARY_PARALLEL_SORT_MIN_LEN
+#define ADT_ARY_PARALLEL_SORT_MIN_LEN 65536 //adt_ary_sort_parallel sorts shorter arrays in the calling thread
+#endif
 
 typedef struct adt_ary_tag{
 	void **ppAlloc;		//array of (void*)
@@ -47,17 +60,22 @@ typedef struct adt_ary_tag{
 	void (*pDestructor)(void*); //optional destructor function (typically vdelete functions from other data structures)
 	void *pFillElem;            //optional fill element for new elements (defaults to NULL)
 	bool destructorEnable;      //Temporarily disables use of element pDestructor
+	void **ppInline;            //optional inline storage used before spilling to the heap (never freed by adt_ary)
+	int32_t s32InlineLen;       //number of elements in ppInline
 } adt_ary_t;
 
 typedef int (adt_vlt_func_t)(const void *a, const void *b); //lt = less-than
+typedef bool (adt_pred_func_t)(const void *pElem, void *arg); //returns true for elements to keep
 
 /***************** Public Function Declarations *******************/
 //Constructor/Destructor
 adt_ary_t*	adt_ary_new(void (*pDestructor)(void*));
 adt_ary_t*	adt_ary_make(void** ppElem, int32_t s32Len,void (*pDestructor)(void*));
+adt_ary_t*  adt_ary_new_inline(void (*pDestructor)(void*), int32_t s32InlineLen);
 void	      adt_ary_delete(adt_ary_t *self);
 void        adt_ary_vdelete(void *arg);
 void 	      adt_ary_create(adt_ary_t *self, void (*pDestructor)(void*));
+void        adt_ary_create_inline(adt_ary_t *self, void (*pDestructor)(void*), void **ppInline, int32_t s32InlineLen);
 void 	      adt_ary_destroy(adt_ary_t *self);
 void        adt_ary_destructor_enable(adt_ary_t *self, bool enable);
 
@@ -72,10 +90,13 @@ void*	      adt_ary_shift(adt_ary_t *self);
 adt_error_t	adt_ary_unshift(adt_ary_t *self, void *pElem);
 void*       adt_ary_value(const adt_ary_t *self, int32_t s32Index);
 adt_error_t adt_ary_remove(adt_ary_t *self, void *pElem);
+adt_error_t adt_ary_push_many(adt_ary_t *self, void **ppElems, int32_t s32Len);
+adt_error_t adt_ary_insert_range(adt_ary_t *self, int32_t s32Index, void **ppElems, int32_t s32Len);
 
 //Utility functions
 adt_error_t	adt_ary_extend(adt_ary_t *self, int32_t s32Len);
 adt_error_t	adt_ary_fill(adt_ary_t *self, int32_t s32Len);
+adt_error_t adt_ary_reserve_front(adt_ary_t *self, int32_t s32Len);
 adt_error_t adt_ary_resize(adt_ary_t *self, int32_t s32Len);
 void	      adt_ary_clear(adt_ary_t *self);
 int32_t     adt_ary_length(const adt_ary_t *self);
@@ -83,10 +104,28 @@ bool        adt_ary_is_empty(const adt_ary_t* self);
 void 	      adt_ary_set_fill_elem(adt_ary_t *self, void* pFillElem);
 void* 	   adt_ary_get_fill_elem(const adt_ary_t *self);
 adt_error_t adt_ary_splice(adt_ary_t *self, int32_t s32Index, int32_t s32Len);
+adt_error_t adt_ary_retain(adt_ary_t *self, adt_pred_func_t *pred, void *arg);
 int32_t	   adt_ary_exists(const adt_ary_t *self, int32_t s32Index);
 adt_error_t adt_ary_sort(adt_ary_t *self, adt_vlt_func_t *key, bool reverse);
+adt_error_t adt_ary_sort_parallel(adt_ary_t *self, adt_vlt_func_t *key, bool reverse, int32_t s32NumThreads);
+adt_error_t adt_ary_sort_u32(adt_ary_t *self, bool reverse);
+adt_error_t adt_ary_sort_i32(adt_ary_t *self, bool reverse);
+adt_error_t adt_ary_sort_u64(adt_ary_t *self, bool reverse);
+adt_error_t adt_ary_sort_u32_key(adt_ary_t *self, adt_u32_key_func_t *key, void *arg, bool reverse);
+adt_error_t adt_ary_sort_u64_key(adt_ary_t *self, adt_u64_key_func_t *key, void *arg, bool reverse);
+adt_error_t adt_ary_sort_by_key(adt_ary_t *self, adt_u64_key_func_t *key, void *arg, adt_vlt_func_t *vlt, bool reverse);
+adt_error_t adt_ary_partial_sort(adt_ary_t *self, int32_t s32Len, adt_vlt_func_t *vlt, bool reverse);
+adt_error_t adt_ary_nth_element(adt_ary_t *self, int32_t s32Index, adt_vlt_func_t *vlt, bool reverse);
 int32_t     adt_ary_indexOf(adt_ary_t *self, void *pElem);
 
+//Sorted array functions (array must be sorted in ascending order using the same vlt function)
+int32_t     adt_ary_bsearch(const adt_ary_t *self, const void *pElem, adt_vlt_func_t *vlt);
+int32_t     adt_ary_lower_bound(const adt_ary_t *self, const void *pElem, adt_vlt_func_t *vlt);
+int32_t     adt_ary_upper_bound(const adt_ary_t *self, const void *pElem, adt_vlt_func_t *vlt);
+adt_error_t adt_ary_insert_sorted(adt_ary_t *self, void *pElem, adt_vlt_func_t *vlt);
+adt_error_t adt_ary_unique_sorted(adt_ary_t *self, adt_vlt_func_t *vlt);
+adt_error_t adt_ary_merge_sorted(adt_ary_t *self, adt_ary_t *other, adt_vlt_func_t *vlt);
+
 //built-in lt functions (for sorting)
 int adt_i32_vlt(const void *a, const void *b);
 int adt_u32_vlt(const void *a, const void *b);
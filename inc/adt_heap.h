@@ -14,6 +14,7 @@
 // INCLUDES
 //////////////////////////////////////////////////////////////////////////////
 #include <stdint.h>
+#include <stdbool.h>
 #include "adt_ary.h"
 
 //////////////////////////////////////////////////////////////////////////////
@@ -22,7 +23,8 @@
 typedef struct adt_priorityHeap_elem_tag
 {
    void *pItem; //a weak pointer to a user object
-   uint32_t u32Value; //value used for sorting/comparing heap elements
+   uint32_t u32Value; //value used for sorting/comparing heap elements (lower 32 bits of the priority)
+   uint32_t u32ValueHigh; //upper 32 bits of the priority, zero for elements created with a 32-bit value
 } adt_heap_elem_t;
 
 typedef enum adt_heap_family_tag{
@@ -30,6 +32,102 @@ typedef enum adt_heap_family_tag{
    ADT_MAX_HEAP    //highest element at the top of the tree
 } adt_heap_family;
 
+/**
+ * Priority queue element, stored by value inside adt_pq_t
+ */
+typedef struct adt_pq_elem_tag
+{
+   void *pItem; //a weak pointer to a user object
+   uint64_t u64Priority;
+} adt_pq_elem_t;
+
+/**
+ * d-ary heap priority queue with elements stored inline in one allocation (no malloc per element).
+ * The top element has the lowest priority value for ADT_MIN_HEAP and the highest for ADT_MAX_HEAP.
+ * Arity is 2 (binary heap, the default), 4 or 8. Storage is offset so that all children of a node start at a
+ * cache line boundary. With 16-byte elements (64-bit targets) and arity 4 the children of a node fill exactly one
+ * 64-byte cache line.
+ * Higher arity halves (4) or thirds (8) the depth of the heap at the cost of more comparisons per level.
+ */
+typedef struct adt_pq_tag
+{
+   adt_pq_elem_t *pElems;     //pElems[0] is the top element
+   void *pAlloc;              //allocated memory, pElems points inside it
+   int32_t s32CurLen;
+   int32_t s32AllocLen;
+   uint32_t u32ArityShift;    //log2 of the number of children per node
+   adt_heap_family family;
+} adt_pq_t;
+
+#define ADT_PQ_MIN_ALLOC_LEN 8
+#define ADT_PQ_CACHE_LINE_SIZE 64
+
+/**
+ * Handle returned by adt_iheap_push. It stays valid until the element is popped or removed, after which
+ * the same handle value may be given to a new element.
+ */
+typedef int32_t adt_heap_handle_t;
+#define ADT_HEAP_INVALID_HANDLE ((adt_heap_handle_t) -1)
+
+typedef struct adt_iheap_node_tag
+{
+   uint64_t u64Priority;
+   adt_heap_handle_t handle;
+} adt_iheap_node_t;
+
+typedef struct adt_iheap_slot_tag
+{
+   void *pItem;                  //a weak pointer to a user object
+   int32_t s32Pos;               //position in the heap, -1 when slot is free
+   adt_heap_handle_t nextFree;   //next free slot, only used when slot is free
+} adt_iheap_slot_t;
+
+/**
+ * Addressable (indexed) binary heap. Each element gets a stable handle which can be used to change its priority
+ * or to remove it in O(log n). Heap nodes store the priority next to the handle so that sifting never has to
+ * look into the slot table except to update positions.
+ */
+typedef struct adt_iheap_tag
+{
+   adt_iheap_node_t *pNodes;
+   adt_iheap_slot_t *pSlots;     //indexed by handle
+   int32_t s32CurLen;
+   int32_t s32SlotLen;           //number of slots in use or on the free list
+   int32_t s32AllocLen;          //allocated length of both pNodes and pSlots
+   adt_heap_handle_t firstFree;
+   adt_heap_family family;
+} adt_iheap_t;
+
+/**
+ * Streaming top-K selection. Keeps the s32MaxLen elements ordered first by vlt (lowest elements, or highest when
+ * reverse is true) out of any number of pushed elements. The root of the bounded heap is the kept element that is
+ * ordered last, so most rejected elements cost a single comparison.
+ * Elements are weak pointers to user objects.
+ */
+typedef struct adt_heap_topk_tag
+{
+   void **ppHeap;
+   int32_t s32CurLen;
+   int32_t s32MaxLen;
+   adt_vlt_func_t *vlt;
+   bool reverse;
+} adt_heap_topk_t;
+
+/**
+ * Min-max heap (double-ended priority queue) with elements stored inline in one allocation.
+ * Nodes on even levels (the root is level 0) are lower than or equal to all their descendants, nodes on odd levels
+ * are higher than or equal to all their descendants. The lowest element is at the root and the highest element is
+ * one of its two children, which gives O(1) peek at both ends and O(log n) push, pop_min and pop_max.
+ */
+typedef struct adt_mmheap_tag
+{
+   adt_pq_elem_t *pElems;
+   int32_t s32CurLen;
+   int32_t s32AllocLen;
+} adt_mmheap_t;
+
+#define ADT_MMHEAP_MIN_ALLOC_LEN 8
+
 //////////////////////////////////////////////////////////////////////////////
 // GLOBAL VARIABLES
 //////////////////////////////////////////////////////////////////////////////
@@ -45,8 +143,81 @@ void adt_heap_elem_delete(adt_heap_elem_t *self);
 void adt_heap_elem_vdelete(void *arg);
 void adt_heap_elem_create(adt_heap_elem_t *self, void *pItem, uint32_t u32Value);
 void adt_heap_elem_destroy(adt_heap_elem_t *self);
+adt_heap_elem_t* adt_heap_elem_new_u64(void *pItem, uint64_t u64Value);
+void adt_heap_elem_create_u64(adt_heap_elem_t *self, void *pItem, uint64_t u64Value);
+uint64_t adt_heap_elem_value(const adt_heap_elem_t *self);
 void adt_heap_sortUp(adt_ary_t *heap, int32_t childIndex, adt_heap_family heapFamily);
 void adt_heap_sortDown(adt_ary_t *heap, int32_t parentIndex, adt_heap_family heapFamily);
+void adt_heap_build(adt_ary_t *heap, adt_heap_family heapFamily);
+adt_error_t adt_heap_merge(adt_ary_t *dst, adt_ary_t *src, adt_heap_family heapFamily);
+void adt_heap_sort(adt_ary_t *heap, adt_heap_family heapFamily);
+
+/************************* priority queue ***************************/
+void adt_pq_create(adt_pq_t *self, adt_heap_family family);
+adt_error_t adt_pq_create_arity(adt_pq_t *self, adt_heap_family family, int32_t s32Arity);
+void adt_pq_destroy(adt_pq_t *self);
+adt_pq_t* adt_pq_new(adt_heap_family family);
+adt_pq_t* adt_pq_new_arity(adt_heap_family family, int32_t s32Arity);
+void adt_pq_delete(adt_pq_t *self);
+void adt_pq_vdelete(void *arg);
+adt_error_t adt_pq_reserve(adt_pq_t *self, int32_t s32Len);
+adt_error_t adt_pq_push(adt_pq_t *self, void *pItem, uint64_t u64Priority);
+adt_error_t adt_pq_pop(adt_pq_t *self, adt_pq_elem_t *pElem);
+const adt_pq_elem_t* adt_pq_peek(const adt_pq_t *self);
+adt_error_t adt_pq_replace_top(adt_pq_t *self, void *pItem, uint64_t u64Priority, adt_pq_elem_t *pOld);
+int32_t adt_pq_length(const adt_pq_t *self);
+bool adt_pq_is_empty(const adt_pq_t *self);
+void adt_pq_clear(adt_pq_t *self);
+
+/************************* indexed heap ***************************/
+void adt_iheap_create(adt_iheap_t *self, adt_heap_family family);
+void adt_iheap_destroy(adt_iheap_t *self);
+adt_iheap_t* adt_iheap_new(adt_heap_family family);
+void adt_iheap_delete(adt_iheap_t *self);
+void adt_iheap_vdelete(void *arg);
+adt_error_t adt_iheap_reserve(adt_iheap_t *self, int32_t s32Len);
+adt_error_t adt_iheap_push(adt_iheap_t *self, void *pItem, uint64_t u64Priority, adt_heap_handle_t *pHandle);
+adt_error_t adt_iheap_pop(adt_iheap_t *self, adt_pq_elem_t *pElem);
+adt_heap_handle_t adt_iheap_top(const adt_iheap_t *self);
+adt_error_t adt_iheap_get(const adt_iheap_t *self, adt_heap_handle_t handle, adt_pq_elem_t *pElem);
+adt_error_t adt_iheap_update(adt_iheap_t *self, adt_heap_handle_t handle, uint64_t u64Priority);
+adt_error_t adt_iheap_decrease_key(adt_iheap_t *self, adt_heap_handle_t handle, uint64_t u64Priority);
+adt_error_t adt_iheap_increase_key(adt_iheap_t *self, adt_heap_handle_t handle, uint64_t u64Priority);
+adt_error_t adt_iheap_remove(adt_iheap_t *self, adt_heap_handle_t handle, adt_pq_elem_t *pElem);
+bool adt_iheap_contains(const adt_iheap_t *self, adt_heap_handle_t handle);
+int32_t adt_iheap_length(const adt_iheap_t *self);
+bool adt_iheap_is_empty(const adt_iheap_t *self);
+void adt_iheap_clear(adt_iheap_t *self);
+
+/************************* top-k ***************************/
+adt_error_t adt_heap_topk_create(adt_heap_topk_t *self, int32_t s32MaxLen, adt_vlt_func_t *vlt, bool reverse);
+void adt_heap_topk_destroy(adt_heap_topk_t *self);
+adt_heap_topk_t* adt_heap_topk_new(int32_t s32MaxLen, adt_vlt_func_t *vlt, bool reverse);
+void adt_heap_topk_delete(adt_heap_topk_t *self);
+void adt_heap_topk_vdelete(void *arg);
+adt_error_t adt_heap_topk_push(adt_heap_topk_t *self, void *pElem, void **ppRejected);
+void* adt_heap_topk_peek(const adt_heap_topk_t *self);
+int32_t adt_heap_topk_length(const adt_heap_topk_t *self);
+void adt_heap_topk_clear(adt_heap_topk_t *self);
+adt_error_t adt_heap_topk_drain(adt_heap_topk_t *self, adt_ary_t *pDest);
+
+/************************* min-max heap ***************************/
+void adt_mmheap_create(adt_mmheap_t *self);
+void adt_mmheap_destroy(adt_mmheap_t *self);
+adt_mmheap_t* adt_mmheap_new(void);
+void adt_mmheap_delete(adt_mmheap_t *self);
+void adt_mmheap_vdelete(void *arg);
+adt_error_t adt_mmheap_reserve(adt_mmheap_t *self, int32_t s32Len);
+adt_error_t adt_mmheap_push(adt_mmheap_t *self, void *pItem, uint64_t u64Priority);
+adt_error_t adt_mmheap_pop_min(adt_mmheap_t *self, adt_pq_elem_t *pElem);
+adt_error_t adt_mmheap_pop_max(adt_mmheap_t *self, adt_pq_elem_t *pElem);
+const adt_pq_elem_t* adt_mmheap_peek_min(const adt_mmheap_t *self);
+const adt_pq_elem_t* adt_mmheap_peek_max(const adt_mmheap_t *self);
+adt_error_t adt_mmheap_replace_min(adt_mmheap_t *self, void *pItem, uint64_t u64Priority, adt_pq_elem_t *pOld);
+adt_error_t adt_mmheap_replace_max(adt_mmheap_t *self, void *pItem, uint64_t u64Priority, adt_pq_elem_t *pOld);
+int32_t adt_mmheap_length(const adt_mmheap_t *self);
+bool adt_mmheap_is_empty(const adt_mmheap_t *self);
+void adt_mmheap_clear(adt_mmheap_t *self);
 
 
 #endif //ADT_PQ_H
@@ -0,0 +1,311 @@
+/*****************************************************************************
+* \file      adt_ilist.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Intrusive doubly linked list (links embedded in user structs)
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef ADT_ILIST_H
+#define ADT_ILIST_H
+
+/**
+* Intrusive circular doubly linked list. The user embeds an adt_ilist_node_t in its own struct and the list only
+* links those nodes together, which means insert, remove and move never allocate memory and are O(1).
+* A struct can be on several lists at the same time by embedding one node per list.
+* Use ADT_ILIST_ENTRY to get from a node back to the struct that contains it.
+*
+* Example:
+*    typedef struct conn_tag
+*    {
+*       adt_ilist_node_t activeNode;
+*       adt_ilist_node_t timeoutNode;
+*       int fd;
+*    } conn_t;
+*
+*    conn_t *pConn, *pTmp;
+*    ADT_ILIST_FOR_EACH_ENTRY_SAFE(pConn, pTmp, &activeList, conn_t, activeNode)
+*    {
+*       if (pConn->fd < 0) adt_ilist_remove(&pConn->activeNode);
+*    }
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#ifndef ADT_INLINE
+# if defined(_MSC_VER)
+#  define ADT_INLINE __inline
+# elif defined(__GNUC__)
+#  define ADT_INLINE __inline__
+# else
+#  define ADT_INLINE inline
+# endif
+#endif
+
+/**
+ * Links embedded in user structs. A node that is not on any list points to itself.
+ */
+typedef struct adt_ilist_node_tag
+{
+   struct adt_ilist_node_tag *pNext;
+   struct adt_ilist_node_tag *pPrev;
+} adt_ilist_node_t;
+
+/**
+ * List head. The head node is the sentinel of the circular list and is never returned as an element.
+ */
+typedef struct adt_ilist_tag
+{
+   adt_ilist_node_t head;
+} adt_ilist_t;
+
+/**
+ * Static initializer for an empty list, e.g. adt_ilist_t list = ADT_ILIST_INIT(list);
+ */
+#define ADT_ILIST_INIT(name) { { &(name).head, &(name).head } }
+
+/**
+ * Returns pointer to the struct of type that contains pNode as its member field
+ */
+#define ADT_ILIST_ENTRY(pNode, type, member) ((type*) (void*) (((char*) (pNode)) - offsetof(type, member)))
+
+/**
+ * Iterates over all nodes. The current node must not be removed inside the loop (use ADT_ILIST_FOR_EACH_SAFE).
+ */
+#define ADT_ILIST_FOR_EACH(pNode, pList) \
+   for ((pNode) = (pList)->head.pNext; (pNode) != &(pList)->head; (pNode) = (pNode)->pNext)
+
+/**
+ * Iterates over all nodes. The current node may be removed or moved to another list inside the loop.
+ */
+#define ADT_ILIST_FOR_EACH_SAFE(pNode, pTmp, pList) \
+   for ((pNode) = (pList)->head.pNext, (pTmp) = (pNode)->pNext; (pNode) != &(pList)->head; \
+        (pNode) = (pTmp), (pTmp) = (pNode)->pNext)
+
+/**
+ * Iterates backwards over all nodes. The current node may be removed or moved to another list inside the loop.
+ */
+#define ADT_ILIST_FOR_EACH_REVERSE_SAFE(pNode, pTmp, pList) \
+   for ((pNode) = (pList)->head.pPrev, (pTmp) = (pNode)->pPrev; (pNode) != &(pList)->head; \
+        (pNode) = (pTmp), (pTmp) = (pNode)->pPrev)
+
+/**
+ * Iterates over the structs (of given type) that contain the list nodes in their member field
+ */
+#define ADT_ILIST_FOR_EACH_ENTRY(pEntry, pList, type, member) \
+   for ((pEntry) = ADT_ILIST_ENTRY((pList)->head.pNext, type, member); &(pEntry)->member != &(pList)->head; \
+        (pEntry) = ADT_ILIST_ENTRY((pEntry)->member.pNext, type, member))
+
+/**
+ * Same as ADT_ILIST_FOR_EACH_ENTRY but the current entry may be removed or moved to another list inside the loop
+ */
+#define ADT_ILIST_FOR_EACH_ENTRY_SAFE(pEntry, pTmp, pList, type, member) \
+   for ((pEntry) = ADT_ILIST_ENTRY((pList)->head.pNext, type, member), \
+        (pTmp) = ADT_ILIST_ENTRY((pEntry)->member.pNext, type, member); \
+        &(pEntry)->member != &(pList)->head; \
+        (pEntry) = (pTmp), (pTmp) = ADT_ILIST_ENTRY((pTmp)->member.pNext, type, member))
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+static ADT_INLINE void adt_ilist_create(adt_ilist_t *self)
+{
+   self->head.pNext = &self->head;
+   self->head.pPrev = &self->head;
+}
+
+/**
+ * Initializes a node that is not on any list. Nodes must be initialized before adt_ilist_node_is_linked is used.
+ */
+static ADT_INLINE void adt_ilist_node_create(adt_ilist_node_t *pNode)
+{
+   pNode->pNext = pNode;
+   pNode->pPrev = pNode;
+}
+
+static ADT_INLINE bool adt_ilist_node_is_linked(const adt_ilist_node_t *pNode)
+{
+   return (pNode->pNext != pNode);
+}
+
+static ADT_INLINE bool adt_ilist_is_empty(const adt_ilist_t *self)
+{
+   return (self->head.pNext == &self->head);
+}
+
+/**
+ * Links pNode between pPrev and pNext, which must be adjacent
+ */
+static ADT_INLINE void adt_ilist_link(adt_ilist_node_t *pNode, adt_ilist_node_t *pPrev, adt_ilist_node_t *pNext)
+{
+   pNode->pNext = pNext;
+   pNode->pPrev = pPrev;
+   pPrev->pNext = pNode;
+   pNext->pPrev = pNode;
+}
+
+/**
+ * Inserts pNode (which must not be on any list) at the beginning of the list
+ */
+static ADT_INLINE void adt_ilist_push_front(adt_ilist_t *self, adt_ilist_node_t *pNode)
+{
+   adt_ilist_link(pNode, &self->head, self->head.pNext);
+}
+
+/**
+ * Inserts pNode (which must not be on any list) at the end of the list
+ */
+static ADT_INLINE void adt_ilist_push_back(adt_ilist_t *self, adt_ilist_node_t *pNode)
+{
+   adt_ilist_link(pNode, self->head.pPrev, &self->head);
+}
+
+/**
+ * Inserts pNode (which must not be on any list) before pPos, pPos must be on a list
+ */
+static ADT_INLINE void adt_ilist_insert_before(adt_ilist_node_t *pPos, adt_ilist_node_t *pNode)
+{
+   adt_ilist_link(pNode, pPos->pPrev, pPos);
+}
+
+/**
+ * Inserts pNode (which must not be on any list) after pPos, pPos must be on a list
+ */
+static ADT_INLINE void adt_ilist_insert_after(adt_ilist_node_t *pPos, adt_ilist_node_t *pNode)
+{
+   adt_ilist_link(pNode, pPos, pPos->pNext);
+}
+
+/**
+ * Removes pNode from the list it is on. The list itself is not needed. Removing a node that is not on any list
+ * (but has been initialized) has no effect.
+ */
+static ADT_INLINE void adt_ilist_remove(adt_ilist_node_t *pNode)
+{
+   pNode->pPrev->pNext = pNode->pNext;
+   pNode->pNext->pPrev = pNode->pPrev;
+   pNode->pNext = pNode;
+   pNode->pPrev = pNode;
+}
+
+/**
+ * Removes pNode from its current list (if any) and inserts it at the beginning of self
+ */
+static ADT_INLINE void adt_ilist_move_front(adt_ilist_t *self, adt_ilist_node_t *pNode)
+{
+   adt_ilist_remove(pNode);
+   adt_ilist_push_front(self, pNode);
+}
+
+/**
+ * Removes pNode from its current list (if any) and inserts it at the end of self
+ */
+static ADT_INLINE void adt_ilist_move_back(adt_ilist_t *self, adt_ilist_node_t *pNode)
+{
+   adt_ilist_remove(pNode);
+   adt_ilist_push_back(self, pNode);
+}
+
+/**
+ * Returns first node or NULL if the list is empty
+ */
+static ADT_INLINE adt_ilist_node_t* adt_ilist_first(const adt_ilist_t *self)
+{
+   return (self->head.pNext != &self->head)? self->head.pNext : (adt_ilist_node_t*) 0;
+}
+
+/**
+ * Returns last node or NULL if the list is empty
+ */
+static ADT_INLINE adt_ilist_node_t* adt_ilist_last(const adt_ilist_t *self)
+{
+   return (self->head.pPrev != &self->head)? self->head.pPrev : (adt_ilist_node_t*) 0;
+}
+
+/**
+ * Returns node after pNode or NULL when pNode is the last node of the list
+ */
+static ADT_INLINE adt_ilist_node_t* adt_ilist_next(const adt_ilist_t *self, const adt_ilist_node_t *pNode)
+{
+   return (pNode->pNext != &self->head)? pNode->pNext : (adt_ilist_node_t*) 0;
+}
+
+/**
+ * Returns node before pNode or NULL when pNode is the first node of the list
+ */
+static ADT_INLINE adt_ilist_node_t* adt_ilist_prev(const adt_ilist_t *self, const adt_ilist_node_t *pNode)
+{
+   return (pNode->pPrev != &self->head)? pNode->pPrev : (adt_ilist_node_t*) 0;
+}
+
+/**
+ * Removes and returns the first node, or NULL if the list is empty
+ */
+static ADT_INLINE adt_ilist_node_t* adt_ilist_pop_front(adt_ilist_t *self)
+{
+   adt_ilist_node_t *pNode = adt_ilist_first(self);
+   if (pNode != 0)
+   {
+      adt_ilist_remove(pNode);
+   }
+   return pNode;
+}
+
+/**
+ * Moves all nodes of src to the end of self in O(1). src becomes empty.
+ */
+static ADT_INLINE void adt_ilist_concat(adt_ilist_t *self, adt_ilist_t *src)
+{
+   if ( (self != src) && !adt_ilist_is_empty(src) )
+   {
+      adt_ilist_node_t *pFirst = src->head.pNext;
+      adt_ilist_node_t *pLast = src->head.pPrev;
+      pFirst->pPrev = self->head.pPrev;
+      self->head.pPrev->pNext = pFirst;
+      pLast->pNext = &self->head;
+      self->head.pPrev = pLast;
+      adt_ilist_create(src);
+   }
+}
+
+/**
+ * Counts the nodes in O(n)
+ */
+static ADT_INLINE int32_t adt_ilist_length(const adt_ilist_t *self)
+{
+   int32_t s32Len = 0;
+   const adt_ilist_node_t *pNode;
+   for (pNode = self->head.pNext; pNode != &self->head; pNode = pNode->pNext)
+   {
+      s32Len++;
+   }
+   return s32Len;
+}
+
+#endif //ADT_ILIST_H
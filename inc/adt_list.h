@@ -11,6 +11,9 @@ typedef uint8_t bool;
 #else
 #include <stdbool.h>
 #endif
+#include "adt_error.h"
+#include "adt_ary.h"
+#include "adt_pool.h"
 
 #define ADT_LIST_ELEM_HEAD(struct_name, item_type_name) \
       struct struct_name *pNext;\
@@ -34,14 +37,30 @@ typedef struct adt_u32List_elem_tag
    ADT_LIST_ELEM_HEAD(adt_u32List_elem_tag, uint32_t)
 }adt_u32List_elem_t;
 
+struct adt_list_index_tag; //pointer hashes from item to elements, defined in adt_list.c
+
+/**
+ * Nodes are allocated with malloc unless the list was created with a node pool (adt_list_create_pooled or
+ * adt_list_create_shared), which allocates nodes in cache aligned slabs and recycles erased nodes.
+ * When the item index is enabled (adt_list_index_enable) find, remove and insert_unique are O(1) on average
+ * instead of a linear search, also for items that are in the list more than once.
+ * The pItem field of an element must not be changed while the index is enabled.
+ */
 typedef struct adt_list_tag{
    ADT_LIST_HEAD(adt_list_elem_t)
    void (*pDestructor)(void*);
+   adt_pool_t *pPool; //NULL when nodes are allocated with malloc
+   struct adt_list_index_tag *pIndex; //NULL unless the item index is enabled
+   int32_t s32Length; //number of elements
    bool destructorEnable;
+   bool isPoolOwner;
 } adt_list_t;
 
 typedef struct adt_u32List_tag{
    ADT_LIST_HEAD(adt_u32List_elem_t)
+   adt_pool_t *pPool; //NULL when nodes are allocated with malloc
+   int32_t s32Length; //number of elements
+   bool isPoolOwner;
 } adt_u32List_t;
 
 
@@ -49,11 +68,14 @@ typedef struct adt_u32List_tag{
 
 /******* adt_list API *************/
 void  adt_list_create(adt_list_t *self, void (*pDestructor)(void*));
+adt_error_t adt_list_create_pooled(adt_list_t *self, void (*pDestructor)(void*), int32_t s32SlabLen);
+adt_error_t adt_list_create_shared(adt_list_t *self, void (*pDestructor)(void*), adt_pool_t *pPool);
 void  adt_list_destroy(adt_list_t *self);
 adt_list_t*  adt_list_new(void (*pDestructor)(void*));
 void  adt_list_delete(adt_list_t *self);
 void  adt_list_vdelete(void *arg);
 void  adt_list_destructor_enable(adt_list_t *self, bool enable);
+adt_error_t adt_list_index_enable(adt_list_t *self, bool enable);
 void adt_list_insert(adt_list_t *self, void *pItem);
 void adt_list_insert_before(adt_list_t *self, adt_list_elem_t *pIter, void *pItem);
 void adt_list_insert_after(adt_list_t *self, adt_list_elem_t *pIter, void *pItem);
@@ -70,9 +92,14 @@ adt_list_elem_t *adt_list_find(const adt_list_t *self, void *pItem);
 void adt_list_erase(adt_list_t *self, adt_list_elem_t *pElem);
 int32_t adt_list_length(const adt_list_t *self);
 void adt_list_clear(adt_list_t *self);
+adt_error_t adt_list_splice(adt_list_t *self, adt_list_elem_t *pPos, adt_list_t *src, adt_list_elem_t *pFirst, adt_list_elem_t *pLast);
+adt_error_t adt_list_concat(adt_list_t *self, adt_list_t *src);
+adt_error_t adt_list_sort(adt_list_t *self, adt_vlt_func_t *vlt, bool reverse);
 
 /******* adt_u32List API *************/
 void  adt_u32List_create(adt_u32List_t *self);
+adt_error_t adt_u32List_create_pooled(adt_u32List_t *self, int32_t s32SlabLen);
+adt_error_t adt_u32List_create_shared(adt_u32List_t *self, adt_pool_t *pPool);
 void  adt_u32List_destroy(adt_u32List_t *self);
 adt_u32List_t*  adt_u32List_new(void);
 void  adt_u32List_delete(adt_u32List_t *self);
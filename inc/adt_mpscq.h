@@ -0,0 +1,130 @@
+/*****************************************************************************
+* \file      adt_mpscq.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Lock-free intrusive multi-producer single-consumer queue
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef ADT_MPSCQ_H
+#define ADT_MPSCQ_H
+
+/**
+* Intrusive multi-producer single-consumer queue (D. Vyukov's non-intrusive MPSC node-based queue, intrusive variant).
+* The user embeds an adt_mpscq_node_t in its own struct, the queue never allocates memory.
+* Any number of threads may push concurrently, push is wait-free (one atomic exchange).
+* Only one thread at a time may call pop, pop_all and is_empty.
+* Elements come out in the order their push reached the atomic exchange (FIFO per producer).
+*
+* Pop can report an empty queue while a producer is in the middle of a push (between its exchange and
+* linking the node). The element becomes visible as soon as that push completes.
+*
+* Without C11 atomics (ADT_ATOMICS_ENABLE=0) plain loads and stores are used and the queue can only be used
+* from one thread.
+*
+* Example:
+*    typedef struct msg_tag
+*    {
+*       adt_mpscq_node_t node;
+*       char text[64];
+*    } msg_t;
+*
+*    adt_mpscq_push(&queue, &pMsg->node);                     //any thread
+*
+*    adt_mpscq_node_t *pNode = adt_mpscq_pop_all(&queue);     //consumer thread
+*    while (pNode != 0)
+*    {
+*       msg_t *pMsg = ADT_MPSCQ_ENTRY(pNode, msg_t, node);
+*       pNode = adt_mpscq_node_next(pNode);                   //before pMsg is freed or pushed again
+*       handle_msg(pMsg);
+*    }
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifndef ADT_ATOMICS_ENABLE
+# if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+#  define ADT_ATOMICS_ENABLE 1
+# else
+#  define ADT_ATOMICS_ENABLE 0
+# endif
+#endif
+
+#if (ADT_ATOMICS_ENABLE)
+#include <stdatomic.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define ADT_MPSCQ_CACHE_LINE_SIZE 64
+
+/**
+ * Link embedded in user structs
+ */
+typedef struct adt_mpscq_node_tag
+{
+#if (ADT_ATOMICS_ENABLE)
+   _Atomic(struct adt_mpscq_node_tag*) pNext;
+#else
+   struct adt_mpscq_node_tag *pNext;
+#endif
+} adt_mpscq_node_t;
+
+/**
+ * Producers only touch pHead, the consumer works on pTail. They are kept on separate cache lines.
+ */
+typedef struct adt_mpscq_tag
+{
+#if (ADT_ATOMICS_ENABLE)
+   _Atomic(adt_mpscq_node_t*) pHead; //most recently pushed node
+#else
+   adt_mpscq_node_t *pHead;
+#endif
+   uint8_t padding[ADT_MPSCQ_CACHE_LINE_SIZE];
+   adt_mpscq_node_t *pTail;          //next node to pop (may be the stub)
+   adt_mpscq_node_t stub;            //placeholder node, keeps the queue non-empty internally
+} adt_mpscq_t;
+
+/**
+ * Returns pointer to the struct of type that contains pNode as its member field
+ */
+#define ADT_MPSCQ_ENTRY(pNode, type, member) ((type*) (void*) (((char*) (pNode)) - offsetof(type, member)))
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void adt_mpscq_create(adt_mpscq_t *self);
+void adt_mpscq_destroy(adt_mpscq_t *self);
+adt_mpscq_t* adt_mpscq_new(void);
+void adt_mpscq_delete(adt_mpscq_t *self);
+void adt_mpscq_vdelete(void *arg);
+void adt_mpscq_push(adt_mpscq_t *self, adt_mpscq_node_t *pNode);
+adt_mpscq_node_t* adt_mpscq_pop(adt_mpscq_t *self);
+adt_mpscq_node_t* adt_mpscq_pop_all(adt_mpscq_t *self);
+adt_mpscq_node_t* adt_mpscq_node_next(const adt_mpscq_node_t *pNode);
+bool adt_mpscq_is_empty(adt_mpscq_t *self);
+
+#endif //ADT_MPSCQ_H
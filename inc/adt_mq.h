@@ -0,0 +1,90 @@
+/*****************************************************************************
+* \file      adt_mq.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Relaxed concurrent priority queue (MultiQueue)
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef ADT_MQ_H
+#define ADT_MQ_H
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "adt_error.h"
+#include "adt_heap.h"
+#if (ADT_THREADS_ENABLE)
+#include <pthread.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define ADT_MQ_QUEUES_PER_THREAD 2  //recommended number of queues per thread (the factor c in c*P queues)
+#define ADT_MQ_DEFAULT_SAMPLES 2    //number of queues compared by each pop
+#define ADT_MQ_MAX_SAMPLES 8
+#define ADT_MQ_LOCK_ATTEMPTS 8      //random queues tried before waiting for a lock
+#define ADT_MQ_CACHE_LINE_SIZE 64
+
+typedef struct adt_mq_queue_tag
+{
+#if (ADT_THREADS_ENABLE)
+   pthread_mutex_t lock;
+#endif
+   adt_pq_t pq;
+} adt_mq_queue_t;
+
+/**
+ * Relaxed concurrent priority queue (MultiQueue). Elements are spread over a number of independently locked
+ * priority queues (adt_pq_t). Push adds the element to a random queue, pop removes the top element of the best
+ * out of s32NumSamples randomly chosen queues. Pop does not always return the global top element but one close to it;
+ * more queues give less lock contention and weaker ordering, more samples give stronger ordering.
+ * Without ADT_THREADS_ENABLE no locks are used and the queue can only be used from one thread.
+ */
+typedef struct adt_mq_tag
+{
+   void *pAlloc;              //allocated memory, pQueues points inside it
+   uint8_t *pQueues;          //first queue, aligned to a cache line
+   uint32_t u32Stride;        //distance in bytes between queues, a multiple of the cache line size
+   int32_t s32NumQueues;
+   int32_t s32NumSamples;
+   adt_heap_family family;
+} adt_mq_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+adt_error_t adt_mq_create(adt_mq_t *self, adt_heap_family family, int32_t s32NumQueues);
+void adt_mq_destroy(adt_mq_t *self);
+adt_mq_t* adt_mq_new(adt_heap_family family, int32_t s32NumQueues);
+void adt_mq_delete(adt_mq_t *self);
+void adt_mq_vdelete(void *arg);
+adt_error_t adt_mq_set_samples(adt_mq_t *self, int32_t s32NumSamples);
+adt_error_t adt_mq_reserve(adt_mq_t *self, int32_t s32Len);
+adt_error_t adt_mq_push(adt_mq_t *self, void *pItem, uint64_t u64Priority);
+adt_error_t adt_mq_pop(adt_mq_t *self, adt_pq_elem_t *pElem);
+int32_t adt_mq_length(adt_mq_t *self);
+int32_t adt_mq_num_queues(const adt_mq_t *self);
+void adt_mq_clear(adt_mq_t *self);
+
+#endif //ADT_MQ_H
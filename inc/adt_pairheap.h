@@ -0,0 +1,88 @@
+/*****************************************************************************
+* \file      adt_pairheap.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Pairing heap with O(1) insert and meld
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef ADT_PAIRHEAP_H
+#define ADT_PAIRHEAP_H
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "adt_error.h"
+#include "adt_heap.h"
+#include "adt_pool.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Heap node. A pointer to the node is the handle of the element, it stays valid until the element is popped or
+ * removed (also when the heap is melded into another heap).
+ */
+typedef struct adt_pairheap_node_tag
+{
+   struct adt_pairheap_node_tag *pChild;  //first child
+   struct adt_pairheap_node_tag *pNext;   //next sibling
+   struct adt_pairheap_node_tag *pPrev;   //previous sibling, or parent for the first child
+   void *pItem;                           //a weak pointer to a user object
+   uint64_t u64Priority;
+} adt_pairheap_node_t;
+
+/**
+ * Pairing heap. Push and meld are O(1), pop and remove are amortized O(log n).
+ * Nodes are allocated from a pool, either owned by the heap or shared between heaps (adt_pairheap_create_shared).
+ * Heaps can only be melded when they use the same pool or both own their pools.
+ */
+typedef struct adt_pairheap_tag
+{
+   adt_pairheap_node_t *pRoot;
+   adt_pool_t *pPool;
+   int32_t s32CurLen;
+   bool isPoolOwner;
+   adt_heap_family family;
+} adt_pairheap_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+adt_error_t adt_pairheap_create(adt_pairheap_t *self, adt_heap_family family);
+adt_error_t adt_pairheap_create_shared(adt_pairheap_t *self, adt_heap_family family, adt_pool_t *pPool);
+void adt_pairheap_destroy(adt_pairheap_t *self);
+adt_pairheap_t* adt_pairheap_new(adt_heap_family family);
+void adt_pairheap_delete(adt_pairheap_t *self);
+void adt_pairheap_vdelete(void *arg);
+adt_error_t adt_pairheap_push(adt_pairheap_t *self, void *pItem, uint64_t u64Priority, adt_pairheap_node_t **ppNode);
+adt_error_t adt_pairheap_pop(adt_pairheap_t *self, adt_pq_elem_t *pElem);
+const adt_pairheap_node_t* adt_pairheap_peek(const adt_pairheap_t *self);
+adt_error_t adt_pairheap_decrease_key(adt_pairheap_t *self, adt_pairheap_node_t *pNode, uint64_t u64Priority);
+adt_error_t adt_pairheap_remove(adt_pairheap_t *self, adt_pairheap_node_t *pNode, adt_pq_elem_t *pElem);
+adt_error_t adt_pairheap_meld(adt_pairheap_t *dst, adt_pairheap_t *src);
+int32_t adt_pairheap_length(const adt_pairheap_t *self);
+bool adt_pairheap_is_empty(const adt_pairheap_t *self);
+void adt_pairheap_clear(adt_pairheap_t *self);
+
+#endif //ADT_PAIRHEAP_H
@@ -0,0 +1,74 @@
+/*****************************************************************************
+* \file      adt_pool.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Fixed-size element pool (slab allocator with free list)
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef ADT_POOL_H
+#define ADT_POOL_H
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "adt_error.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define ADT_POOL_CACHE_LINE_SIZE 64
+#define ADT_POOL_DEFAULT_SLAB_SIZE 4096 //slab size in bytes used when slab length is 0
+#define ADT_POOL_MIN_SLAB_LEN 8
+
+/**
+ * Pool of fixed-size elements. Memory is allocated in slabs of s32SlabLen elements, where the first element of each
+ * slab starts at a cache line boundary. Freed elements are kept on a free list and reused, slabs are only returned
+ * to the system by adt_pool_destroy.
+ * A pool can be shared between several containers of the same node type (not between threads).
+ */
+typedef struct adt_pool_tag
+{
+   void *pFree;               //first free element, free elements are linked through their first pointer
+   void *pLastFree;
+   void *pSlabs;              //first slab, slabs are linked through their first pointer
+   void *pLastSlab;
+   uint32_t u32ElemSize;      //element size rounded up to a multiple of 8 bytes
+   int32_t s32SlabLen;        //number of elements per slab
+   int32_t s32NumUsed;        //number of allocated elements not yet freed
+} adt_pool_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+adt_error_t adt_pool_create(adt_pool_t *self, uint32_t u32ElemSize, int32_t s32SlabLen);
+void adt_pool_destroy(adt_pool_t *self);
+adt_pool_t* adt_pool_new(uint32_t u32ElemSize, int32_t s32SlabLen);
+void adt_pool_delete(adt_pool_t *self);
+void adt_pool_vdelete(void *arg);
+void* adt_pool_alloc(adt_pool_t *self);
+void adt_pool_free(adt_pool_t *self, void *pElem);
+adt_error_t adt_pool_merge(adt_pool_t *dst, adt_pool_t *src);
+int32_t adt_pool_num_used(const adt_pool_t *self);
+uint32_t adt_pool_elem_size(const adt_pool_t *self);
+
+#endif //ADT_POOL_H
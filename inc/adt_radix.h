@@ -0,0 +1,56 @@
+/*****************************************************************************
+* \file      adt_radix.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     LSD radix sort for integer keys
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef ADT_RADIX_H
+#define ADT_RADIX_H
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stddef.h>
+#include <stdint.h>
+#include "adt_error.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define ADT_RADIX_BITS 11 //bits per digit, histograms for all digits are built in a single pass
+#define ADT_RADIX_MIN_LEN 64 //shorter sequences are sorted using insertion sort
+
+typedef uint32_t (adt_u32_key_func_t)(const void *pElem, void *arg); //order-preserving 32-bit key of an element
+typedef uint64_t (adt_u64_key_func_t)(const void *pElem, void *arg); //order-preserving 64-bit key (or key prefix) of an element
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Stable ascending sort of pKeys. When ppValues is not NULL it is permuted together with pKeys.
+ * Digits which are equal for all keys are skipped (e.g. upper digits of small numbers).
+ */
+adt_error_t adt_radix_sort_u32(uint32_t *pKeys, void **ppValues, size_t len);
+adt_error_t adt_radix_sort_u64(uint64_t *pKeys, void **ppValues, size_t len);
+
+#endif //ADT_RADIX_H
@@ -117,6 +117,7 @@ bool adt_str_equal_bstr(const adt_str_t *self, const char *pBegin, const char *p
 bool adt_str_equal_cstr(const adt_str_t *self, const char *cstr);
 int adt_str_lt(const adt_str_t *self, const adt_str_t *other);
 int adt_str_vlt(const void *a, const void *b); //Used for sorting strings
+uint64_t adt_str_prefix_key(const void *pElem, void *arg); //Key function for adt_ary_sort_by_key (use adt_str_vlt to break ties)
 
 
 /* function aliases */
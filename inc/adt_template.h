@@ -0,0 +1,611 @@
+/*****************************************************************************
+* \file      adt_template.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Macro-generated type-specialized containers
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef ADT_TEMPLATE_H
+#define ADT_TEMPLATE_H
+
+/**
+* Each container comes with three macros:
+*
+* ADT_<CONTAINER>_DEFINE(name, ...)    Defines the type name##_t and all of its functions as static inline.
+*                                      Use this when the container is only used in one translation unit.
+* ADT_<CONTAINER>_DECLARE(name, ...)   Defines the type name##_t and extern function prototypes (put it in a header).
+* ADT_<CONTAINER>_IMPLEMENT(name, ...) Generates extern function definitions (put it in exactly one .c file).
+*
+* Comparisons (LESS) and hashing (HASH, EQ) are macros or functions given as arguments.
+* They are expanded directly into the generated code, allowing the compiler to inline them.
+*
+* Example:
+*    #define INT_LESS(a, b) ((a) < (b))
+*    ADT_VEC_DEFINE(intvec, int)
+*    ADT_HEAP_DEFINE(intheap, int, INT_LESS)
+*    ADT_HASHMAP_DEFINE(u32map, uint32_t, double, adt_hash_u32, ADT_EQ_VALUE)
+*/
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <malloc.h>
+#include "adt_error.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#ifndef ADT_INLINE
+# if defined(_MSC_VER)
+#  define ADT_INLINE __inline
+# elif defined(__GNUC__)
+#  define ADT_INLINE __inline__
+# else
+#  define ADT_INLINE inline
+# endif
+#endif
+
+#define ADT_TEMPLATE_MIN_ALLOC_LEN 8
+#define ADT_EQ_VALUE(a, b) ((a) == (b))
+
+/* scope used by the _DEFINE variants */
+#define ADT_TEMPLATE_STATIC static ADT_INLINE
+/* scope used by the _DECLARE/_IMPLEMENT variants */
+#define ADT_TEMPLATE_EXTERN
+
+/**
+ * Integer hash function (finalizer of MurmurHash3). Suitable as HASH argument of ADT_HASHMAP_DEFINE.
+ */
+static ADT_INLINE uint32_t adt_hash_u32(uint32_t key)
+{
+   key ^= key >> 16;
+   key *= 0x85ebca6bu;
+   key ^= key >> 13;
+   key *= 0xc2b2ae35u;
+   key ^= key >> 16;
+   return key;
+}
+
+static ADT_INLINE uint32_t adt_hash_u64(uint64_t key)
+{
+   key ^= key >> 33;
+   key *= 0xff51afd7ed558ccdull;
+   key ^= key >> 33;
+   key *= 0xc4ceb9fe1a85ec53ull;
+   key ^= key >> 33;
+   return (uint32_t) key;
+}
+
+static ADT_INLINE uint32_t adt_hash_ptr(const void *key)
+{
+   return adt_hash_u64((uint64_t) (uintptr_t) key);
+}
+
+/**
+ * Returns the new allocation length (doubling strategy) or -1 when s32MinLen cannot be satisfied
+ */
+static ADT_INLINE int32_t adt_template_grow_len(int32_t s32AllocLen, int32_t s32MinLen)
+{
+   int32_t s32NewLen = (s32AllocLen < ADT_TEMPLATE_MIN_ALLOC_LEN)? ADT_TEMPLATE_MIN_ALLOC_LEN : s32AllocLen;
+   if (s32MinLen < 0)
+   {
+      return -1;
+   }
+   while (s32NewLen < s32MinLen)
+   {
+      s32NewLen = (s32NewLen > (INT32_MAX / 2))? s32MinLen : (s32NewLen * 2);
+   }
+   return s32NewLen;
+}
+
+/********************************* vector ***********************************/
+
+#define ADT_VEC_TYPE(name, T) \
+typedef struct name##_tag \
+{ \
+   T *pData; \
+   int32_t s32CurLen; \
+   int32_t s32AllocLen; \
+} name##_t;
+
+#define ADT_VEC_PROTOTYPES(scope, name, T) \
+scope void name##_create(name##_t *self); \
+scope void name##_destroy(name##_t *self); \
+scope adt_error_t name##_reserve(name##_t *self, int32_t s32Len); \
+scope adt_error_t name##_push(name##_t *self, T value); \
+scope adt_error_t name##_pop(name##_t *self, T *pValue); \
+scope adt_error_t name##_insert(name##_t *self, int32_t s32Index, T value); \
+scope adt_error_t name##_erase(name##_t *self, int32_t s32Index); \
+scope T* name##_at(const name##_t *self, int32_t s32Index); \
+scope int32_t name##_length(const name##_t *self); \
+scope void name##_clear(name##_t *self);
+
+#define ADT_VEC_IMPL(scope, name, T) \
+scope void name##_create(name##_t *self) \
+{ \
+   self->pData = (T*) 0; \
+   self->s32CurLen = 0; \
+   self->s32AllocLen = 0; \
+} \
+scope void name##_destroy(name##_t *self) \
+{ \
+   if (self->pData != 0) \
+   { \
+      free(self->pData); \
+   } \
+   name##_create(self); \
+} \
+scope adt_error_t name##_reserve(name##_t *self, int32_t s32Len) \
+{ \
+   if (s32Len > self->s32AllocLen) \
+   { \
+      T *pData = (T*) malloc(((size_t) s32Len) * sizeof(T)); \
+      if (pData == 0) \
+      { \
+         return ADT_MEM_ERROR; \
+      } \
+      if (self->pData != 0) \
+      { \
+         memcpy(pData, self->pData, ((size_t) self->s32CurLen) * sizeof(T)); \
+         free(self->pData); \
+      } \
+      self->pData = pData; \
+      self->s32AllocLen = s32Len; \
+   } \
+   return ADT_NO_ERROR; \
+} \
+scope adt_error_t name##_push(name##_t *self, T value) \
+{ \
+   if (self->s32CurLen == self->s32AllocLen) \
+   { \
+      int32_t s32NewLen = (self->s32CurLen < INT32_MAX)? adt_template_grow_len(self->s32AllocLen, self->s32CurLen + 1) : -1; \
+      adt_error_t result; \
+      if (s32NewLen < 0) \
+      { \
+         return ADT_LENGTH_ERROR; \
+      } \
+      result = name##_reserve(self, s32NewLen); \
+      if (result != ADT_NO_ERROR) \
+      { \
+         return result; \
+      } \
+   } \
+   self->pData[self->s32CurLen++] = value; \
+   return ADT_NO_ERROR; \
+} \
+scope adt_error_t name##_pop(name##_t *self, T *pValue) \
+{ \
+   if (self->s32CurLen == 0) \
+   { \
+      return ADT_LENGTH_ERROR; \
+   } \
+   self->s32CurLen--; \
+   if (pValue != 0) \
+   { \
+      *pValue = self->pData[self->s32CurLen]; \
+   } \
+   return ADT_NO_ERROR; \
+} \
+scope adt_error_t name##_insert(name##_t *self, int32_t s32Index, T value) \
+{ \
+   if ( (s32Index < 0) || (s32Index > self->s32CurLen) ) \
+   { \
+      return ADT_INDEX_OUT_OF_BOUNDS_ERROR; \
+   } \
+   if (self->s32CurLen == self->s32AllocLen) \
+   { \
+      int32_t s32NewLen = (self->s32CurLen < INT32_MAX)? adt_template_grow_len(self->s32AllocLen, self->s32CurLen + 1) : -1; \
+      adt_error_t result; \
+      if (s32NewLen < 0) \
+      { \
+         return ADT_LENGTH_ERROR; \
+      } \
+      result = name##_reserve(self, s32NewLen); \
+      if (result != ADT_NO_ERROR) \
+      { \
+         return result; \
+      } \
+   } \
+   memmove(&self->pData[s32Index + 1], &self->pData[s32Index], ((size_t) (self->s32CurLen - s32Index)) * sizeof(T)); \
+   self->pData[s32Index] = value; \
+   self->s32CurLen++; \
+   return ADT_NO_ERROR; \
+} \
+scope adt_error_t name##_erase(name##_t *self, int32_t s32Index) \
+{ \
+   if ( (s32Index < 0) || (s32Index >= self->s32CurLen) ) \
+   { \
+      return ADT_INDEX_OUT_OF_BOUNDS_ERROR; \
+   } \
+   memmove(&self->pData[s32Index], &self->pData[s32Index + 1], ((size_t) (self->s32CurLen - s32Index - 1)) * sizeof(T)); \
+   self->s32CurLen--; \
+   return ADT_NO_ERROR; \
+} \
+scope T* name##_at(const name##_t *self, int32_t s32Index) \
+{ \
+   return &self->pData[s32Index]; \
+} \
+scope int32_t name##_length(const name##_t *self) \
+{ \
+   return self->s32CurLen; \
+} \
+scope void name##_clear(name##_t *self) \
+{ \
+   self->s32CurLen = 0; \
+}
+
+#define ADT_VEC_DEFINE(name, T) \
+   ADT_VEC_TYPE(name, T) \
+   ADT_VEC_IMPL(ADT_TEMPLATE_STATIC, name, T)
+
+#define ADT_VEC_DECLARE(name, T) \
+   ADT_VEC_TYPE(name, T) \
+   ADT_VEC_PROTOTYPES(ADT_TEMPLATE_EXTERN, name, T)
+
+#define ADT_VEC_IMPLEMENT(name, T) \
+   ADT_VEC_IMPL(ADT_TEMPLATE_EXTERN, name, T)
+
+/********************************* heap *************************************/
+
+/**
+ * Binary heap where LESS(a, b) decides which element is closer to the top.
+ * Use ((a) < (b)) for a min-heap and ((a) > (b)) for a max-heap.
+ */
+#define ADT_HEAP_TYPE(name, T) \
+typedef struct name##_tag \
+{ \
+   T *pData; \
+   int32_t s32CurLen; \
+   int32_t s32AllocLen; \
+} name##_t;
+
+#define ADT_HEAP_PROTOTYPES(scope, name, T) \
+scope void name##_create(name##_t *self); \
+scope void name##_destroy(name##_t *self); \
+scope adt_error_t name##_reserve(name##_t *self, int32_t s32Len); \
+scope adt_error_t name##_push(name##_t *self, T value); \
+scope adt_error_t name##_pop(name##_t *self, T *pValue); \
+scope T* name##_peek(const name##_t *self); \
+scope int32_t name##_length(const name##_t *self); \
+scope void name##_clear(name##_t *self);
+
+#define ADT_HEAP_IMPL(scope, name, T, LESS) \
+scope void name##_create(name##_t *self) \
+{ \
+   self->pData = (T*) 0; \
+   self->s32CurLen = 0; \
+   self->s32AllocLen = 0; \
+} \
+scope void name##_destroy(name##_t *self) \
+{ \
+   if (self->pData != 0) \
+   { \
+      free(self->pData); \
+   } \
+   name##_create(self); \
+} \
+scope adt_error_t name##_reserve(name##_t *self, int32_t s32Len) \
+{ \
+   if (s32Len > self->s32AllocLen) \
+   { \
+      T *pData = (T*) malloc(((size_t) s32Len) * sizeof(T)); \
+      if (pData == 0) \
+      { \
+         return ADT_MEM_ERROR; \
+      } \
+      if (self->pData != 0) \
+      { \
+         memcpy(pData, self->pData, ((size_t) self->s32CurLen) * sizeof(T)); \
+         free(self->pData); \
+      } \
+      self->pData = pData; \
+      self->s32AllocLen = s32Len; \
+   } \
+   return ADT_NO_ERROR; \
+} \
+scope adt_error_t name##_push(name##_t *self, T value) \
+{ \
+   int32_t s32Child; \
+   if (self->s32CurLen == self->s32AllocLen) \
+   { \
+      int32_t s32NewLen = (self->s32CurLen < INT32_MAX)? adt_template_grow_len(self->s32AllocLen, self->s32CurLen + 1) : -1; \
+      adt_error_t result; \
+      if (s32NewLen < 0) \
+      { \
+         return ADT_LENGTH_ERROR; \
+      } \
+      result = name##_reserve(self, s32NewLen); \
+      if (result != ADT_NO_ERROR) \
+      { \
+         return result; \
+      } \
+   } \
+   s32Child = self->s32CurLen++; \
+   while (s32Child > 0) \
+   { \
+      int32_t s32Parent = (s32Child - 1) >> 1; \
+      if ( !(LESS(value, self->pData[s32Parent])) ) \
+      { \
+         break; \
+      } \
+      self->pData[s32Child] = self->pData[s32Parent]; \
+      s32Child = s32Parent; \
+   } \
+   self->pData[s32Child] = value; \
+   return ADT_NO_ERROR; \
+} \
+scope adt_error_t name##_pop(name##_t *self, T *pValue) \
+{ \
+   T last; \
+   int32_t s32Parent = 0; \
+   int32_t s32Len; \
+   if (self->s32CurLen == 0) \
+   { \
+      return ADT_LENGTH_ERROR; \
+   } \
+   if (pValue != 0) \
+   { \
+      *pValue = self->pData[0]; \
+   } \
+   s32Len = --self->s32CurLen; \
+   last = self->pData[s32Len]; \
+   for (;;) \
+   { \
+      int32_t s32Child = (s32Parent << 1) + 1; \
+      if (s32Child >= s32Len) \
+      { \
+         break; \
+      } \
+      if ( ( (s32Child + 1) < s32Len) && (LESS(self->pData[s32Child + 1], self->pData[s32Child])) ) \
+      { \
+         s32Child++; \
+      } \
+      if ( !(LESS(self->pData[s32Child], last)) ) \
+      { \
+         break; \
+      } \
+      self->pData[s32Parent] = self->pData[s32Child]; \
+      s32Parent = s32Child; \
+   } \
+   if (s32Len > 0) \
+   { \
+      self->pData[s32Parent] = last; \
+   } \
+   return ADT_NO_ERROR; \
+} \
+scope T* name##_peek(const name##_t *self) \
+{ \
+   return (self->s32CurLen > 0)? &self->pData[0] : (T*) 0; \
+} \
+scope int32_t name##_length(const name##_t *self) \
+{ \
+   return self->s32CurLen; \
+} \
+scope void name##_clear(name##_t *self) \
+{ \
+   self->s32CurLen = 0; \
+}
+
+#define ADT_HEAP_DEFINE(name, T, LESS) \
+   ADT_HEAP_TYPE(name, T) \
+   ADT_HEAP_IMPL(ADT_TEMPLATE_STATIC, name, T, LESS)
+
+#define ADT_HEAP_DECLARE(name, T) \
+   ADT_HEAP_TYPE(name, T) \
+   ADT_HEAP_PROTOTYPES(ADT_TEMPLATE_EXTERN, name, T)
+
+#define ADT_HEAP_IMPLEMENT(name, T, LESS) \
+   ADT_HEAP_IMPL(ADT_TEMPLATE_EXTERN, name, T, LESS)
+
+/******************************** hash map **********************************/
+
+/**
+ * Open addressing hash map (linear probing) with a power-of-two number of slots.
+ * HASH(key) must return uint32_t, EQ(a, b) must return non-zero when the keys are equal.
+ * Removal uses backward shift deletion, there are no tombstones.
+ */
+#define ADT_HASHMAP_TYPE(name, K, V) \
+typedef struct name##_tag \
+{ \
+   K *pKeys; \
+   V *pValues; \
+   uint8_t *pUsed; \
+   uint32_t u32NumSlots; \
+   uint32_t u32Size; \
+} name##_t;
+
+#define ADT_HASHMAP_PROTOTYPES(scope, name, K, V) \
+scope void name##_create(name##_t *self); \
+scope void name##_destroy(name##_t *self); \
+scope adt_error_t name##_reserve(name##_t *self, uint32_t u32Size); \
+scope adt_error_t name##_set(name##_t *self, K key, V value); \
+scope V* name##_get(const name##_t *self, K key); \
+scope bool name##_remove(name##_t *self, K key); \
+scope uint32_t name##_length(const name##_t *self); \
+scope void name##_clear(name##_t *self);
+
+#define ADT_HASHMAP_IMPL(scope, name, K, V, HASH, EQ) \
+scope void name##_create(name##_t *self) \
+{ \
+   self->pKeys = (K*) 0; \
+   self->pValues = (V*) 0; \
+   self->pUsed = (uint8_t*) 0; \
+   self->u32NumSlots = 0u; \
+   self->u32Size = 0u; \
+} \
+scope void name##_destroy(name##_t *self) \
+{ \
+   if (self->pKeys != 0) \
+   { \
+      free(self->pKeys); \
+      free(self->pValues); \
+      free(self->pUsed); \
+   } \
+   name##_create(self); \
+} \
+scope adt_error_t name##_reserve(name##_t *self, uint32_t u32Size) \
+{ \
+   uint32_t u32NumSlots = ADT_TEMPLATE_MIN_ALLOC_LEN; \
+   while ( (u32NumSlots - (u32NumSlots >> 2)) < u32Size ) \
+   { \
+      if (u32NumSlots >= 0x80000000u) \
+      { \
+         return ADT_LENGTH_ERROR; \
+      } \
+      u32NumSlots <<= 1; \
+   } \
+   if (u32NumSlots > self->u32NumSlots) \
+   { \
+      name##_t other; \
+      uint32_t i; \
+      other.pKeys = (K*) malloc(((size_t) u32NumSlots) * sizeof(K)); \
+      other.pValues = (V*) malloc(((size_t) u32NumSlots) * sizeof(V)); \
+      other.pUsed = (uint8_t*) malloc((size_t) u32NumSlots); \
+      if ( (other.pKeys == 0) || (other.pValues == 0) || (other.pUsed == 0) ) \
+      { \
+         if (other.pKeys != 0) free(other.pKeys); \
+         if (other.pValues != 0) free(other.pValues); \
+         if (other.pUsed != 0) free(other.pUsed); \
+         return ADT_MEM_ERROR; \
+      } \
+      memset(other.pUsed, 0, (size_t) u32NumSlots); \
+      other.u32NumSlots = u32NumSlots; \
+      other.u32Size = self->u32Size; \
+      for (i = 0u; i < self->u32NumSlots; i++) \
+      { \
+         if (self->pUsed[i] != 0u) \
+         { \
+            uint32_t u32Slot = ((uint32_t) HASH(self->pKeys[i])) & (u32NumSlots - 1u); \
+            while (other.pUsed[u32Slot] != 0u) \
+            { \
+               u32Slot = (u32Slot + 1u) & (u32NumSlots - 1u); \
+            } \
+            other.pUsed[u32Slot] = 1u; \
+            other.pKeys[u32Slot] = self->pKeys[i]; \
+            other.pValues[u32Slot] = self->pValues[i]; \
+         } \
+      } \
+      name##_destroy(self); \
+      *self = other; \
+   } \
+   return ADT_NO_ERROR; \
+} \
+scope adt_error_t name##_set(name##_t *self, K key, V value) \
+{ \
+   uint32_t u32Slot; \
+   uint32_t u32Mask; \
+   if ( (self->u32Size + 1u) > (self->u32NumSlots - (self->u32NumSlots >> 2)) ) \
+   { \
+      adt_error_t result = name##_reserve(self, self->u32Size + 1u); \
+      if (result != ADT_NO_ERROR) \
+      { \
+         return result; \
+      } \
+   } \
+   u32Mask = self->u32NumSlots - 1u; \
+   u32Slot = ((uint32_t) HASH(key)) & u32Mask; \
+   while (self->pUsed[u32Slot] != 0u) \
+   { \
+      if (EQ(self->pKeys[u32Slot], key)) \
+      { \
+         self->pValues[u32Slot] = value; \
+         return ADT_NO_ERROR; \
+      } \
+      u32Slot = (u32Slot + 1u) & u32Mask; \
+   } \
+   self->pUsed[u32Slot] = 1u; \
+   self->pKeys[u32Slot] = key; \
+   self->pValues[u32Slot] = value; \
+   self->u32Size++; \
+   return ADT_NO_ERROR; \
+} \
+scope V* name##_get(const name##_t *self, K key) \
+{ \
+   if (self->u32Size > 0u) \
+   { \
+      uint32_t u32Mask = self->u32NumSlots - 1u; \
+      uint32_t u32Slot = ((uint32_t) HASH(key)) & u32Mask; \
+      while (self->pUsed[u32Slot] != 0u) \
+      { \
+         if (EQ(self->pKeys[u32Slot], key)) \
+         { \
+            return &self->pValues[u32Slot]; \
+         } \
+         u32Slot = (u32Slot + 1u) & u32Mask; \
+      } \
+   } \
+   return (V*) 0; \
+} \
+scope bool name##_remove(name##_t *self, K key) \
+{ \
+   V *pValue = name##_get(self, key); \
+   if (pValue != 0) \
+   { \
+      uint32_t u32Mask = self->u32NumSlots - 1u; \
+      uint32_t u32Hole = (uint32_t) (pValue - self->pValues); \
+      uint32_t u32Slot = (u32Hole + 1u) & u32Mask; \
+      while (self->pUsed[u32Slot] != 0u) \
+      { \
+         uint32_t u32Home = ((uint32_t) HASH(self->pKeys[u32Slot])) & u32Mask; \
+         /* move element into the hole unless its home slot lies cyclically in (hole, slot] */ \
+         if ( ((u32Slot - u32Home) & u32Mask) >= ((u32Slot - u32Hole) & u32Mask) ) \
+         { \
+            self->pKeys[u32Hole] = self->pKeys[u32Slot]; \
+            self->pValues[u32Hole] = self->pValues[u32Slot]; \
+            u32Hole = u32Slot; \
+         } \
+         u32Slot = (u32Slot + 1u) & u32Mask; \
+      } \
+      self->pUsed[u32Hole] = 0u; \
+      self->u32Size--; \
+      return true; \
+   } \
+   return false; \
+} \
+scope uint32_t name##_length(const name##_t *self) \
+{ \
+   return self->u32Size; \
+} \
+scope void name##_clear(name##_t *self) \
+{ \
+   if (self->pUsed != 0) \
+   { \
+      memset(self->pUsed, 0, (size_t) self->u32NumSlots); \
+   } \
+   self->u32Size = 0u; \
+}
+
+#define ADT_HASHMAP_DEFINE(name, K, V, HASH, EQ) \
+   ADT_HASHMAP_TYPE(name, K, V) \
+   ADT_HASHMAP_IMPL(ADT_TEMPLATE_STATIC, name, K, V, HASH, EQ)
+
+#define ADT_HASHMAP_DECLARE(name, K, V) \
+   ADT_HASHMAP_TYPE(name, K, V) \
+   ADT_HASHMAP_PROTOTYPES(ADT_TEMPLATE_EXTERN, name, K, V)
+
+#define ADT_HASHMAP_IMPLEMENT(name, K, V, HASH, EQ) \
+   ADT_HASHMAP_IMPL(ADT_TEMPLATE_EXTERN, name, K, V, HASH, EQ)
+
+#endif //ADT_TEMPLATE_H
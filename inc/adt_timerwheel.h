@@ -0,0 +1,93 @@
+/*****************************************************************************
+* \file      adt_timerwheel.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Hierarchical timing wheel
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef ADT_TIMERWHEEL_H
+#define ADT_TIMERWHEEL_H
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "adt_error.h"
+#include "adt_ary.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#ifndef ADT_TIMERWHEEL_SLOT_BITS
+#define ADT_TIMERWHEEL_SLOT_BITS 8 //each level has 2^bits slots
+#endif
+
+#ifndef ADT_TIMERWHEEL_LEVELS
+#define ADT_TIMERWHEEL_LEVELS 4 //timers further away than 2^(bits*levels) ticks are cascaded more than once
+#endif
+
+#define ADT_TIMERWHEEL_SLOTS (1 << ADT_TIMERWHEEL_SLOT_BITS)
+
+/**
+ * Timer node, owned by the user (typically embedded in the user object). A timer can be scheduled in at most one
+ * timer wheel at a time.
+ */
+typedef struct adt_timer_tag
+{
+   struct adt_timer_tag *pNext;
+   struct adt_timer_tag **ppPrev;   //pNext field of previous timer or slot head, NULL when the timer is not scheduled
+   uint64_t u64Expires;
+   void *pItem;                     //a weak pointer to a user object
+   int32_t s32Slot;
+} adt_timer_t;
+
+/**
+ * Hierarchical timing wheel. Time is measured in ticks (any unit, chosen by the user).
+ * Level 0 has one slot per tick, each slot in level n covers 2^(bits*n) ticks. Timers in higher levels are moved
+ * (cascaded) to lower levels as time advances. Scheduling and cancelling a timer is O(1).
+ */
+typedef struct adt_timerwheel_tag
+{
+   adt_timer_t **ppSlots;           //ADT_TIMERWHEEL_LEVELS * ADT_TIMERWHEEL_SLOTS list heads followed by the due list
+   int32_t *ps32SlotLen;            //number of timers in each slot
+   int32_t s32LevelLen[ADT_TIMERWHEEL_LEVELS];
+   int32_t s32CurLen;               //total number of scheduled timers
+   uint64_t u64Tick;                //next tick to process, all earlier ticks have been processed
+} adt_timerwheel_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void adt_timer_create(adt_timer_t *self, void *pItem);
+bool adt_timer_is_scheduled(const adt_timer_t *self);
+
+adt_error_t adt_timerwheel_create(adt_timerwheel_t *self, uint64_t u64Now);
+void adt_timerwheel_destroy(adt_timerwheel_t *self);
+adt_timerwheel_t* adt_timerwheel_new(uint64_t u64Now);
+void adt_timerwheel_delete(adt_timerwheel_t *self);
+void adt_timerwheel_vdelete(void *arg);
+adt_error_t adt_timerwheel_schedule(adt_timerwheel_t *self, adt_timer_t *pTimer, uint64_t u64Expires);
+adt_error_t adt_timerwheel_cancel(adt_timerwheel_t *self, adt_timer_t *pTimer);
+adt_error_t adt_timerwheel_advance(adt_timerwheel_t *self, uint64_t u64Now, adt_ary_t *pExpired);
+int32_t adt_timerwheel_length(const adt_timerwheel_t *self);
+
+#endif //ADT_TIMERWHEEL_H
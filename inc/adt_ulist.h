@@ -0,0 +1,103 @@
+/*****************************************************************************
+* \file      adt_ulist.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unrolled linked list (several items per node)
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef ADT_ULIST_H
+#define ADT_ULIST_H
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "adt_error.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#ifndef ADT_ULIST_NODE_LEN
+#define ADT_ULIST_NODE_LEN 32 //maximum number of items per node
+#endif
+
+typedef struct adt_ulist_node_tag
+{
+   struct adt_ulist_node_tag *pNext;
+   struct adt_ulist_node_tag *pPrev;
+   int32_t s32Len;                        //number of items in use
+   void *ppItems[ADT_ULIST_NODE_LEN];
+} adt_ulist_node_t;
+
+/**
+ * Unrolled doubly linked list of void pointers. Each node stores up to ADT_ULIST_NODE_LEN items in a contiguous
+ * array, so a full scan touches one node per ADT_ULIST_NODE_LEN items instead of one node per item.
+ * A full node is split in two halves on insert, and a node is merged with its neighbour when both together are
+ * at most half full after an erase.
+ */
+typedef struct adt_ulist_tag
+{
+   adt_ulist_node_t *pFirst;
+   adt_ulist_node_t *pLast;
+   void (*pDestructor)(void*);
+   int32_t s32Length;                     //number of items
+   bool destructorEnable;
+} adt_ulist_t;
+
+/**
+ * Iterator, owned by the user. pItem is the item at the current position.
+ * Iterators are invalidated by inserts and erases except those made through the iterator itself.
+ */
+typedef struct adt_ulist_iter_tag
+{
+   adt_ulist_node_t *pNode;
+   int32_t s32Index;
+   void *pItem;
+} adt_ulist_iter_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+void adt_ulist_create(adt_ulist_t *self, void (*pDestructor)(void*));
+void adt_ulist_destroy(adt_ulist_t *self);
+adt_ulist_t* adt_ulist_new(void (*pDestructor)(void*));
+void adt_ulist_delete(adt_ulist_t *self);
+void adt_ulist_vdelete(void *arg);
+void adt_ulist_destructor_enable(adt_ulist_t *self, bool enable);
+adt_error_t adt_ulist_insert(adt_ulist_t *self, void *pItem);
+adt_error_t adt_ulist_insert_front(adt_ulist_t *self, void *pItem);
+adt_error_t adt_ulist_insert_before(adt_ulist_t *self, adt_ulist_iter_t *pIter, void *pItem);
+adt_error_t adt_ulist_insert_after(adt_ulist_t *self, adt_ulist_iter_t *pIter, void *pItem);
+adt_ulist_iter_t* adt_ulist_erase(adt_ulist_t *self, adt_ulist_iter_t *pIter);
+bool adt_ulist_remove(adt_ulist_t *self, void *pItem);
+void* adt_ulist_first(const adt_ulist_t *self);
+void* adt_ulist_last(const adt_ulist_t *self);
+adt_ulist_iter_t* adt_ulist_iter_first(const adt_ulist_t *self, adt_ulist_iter_t *pIter);
+adt_ulist_iter_t* adt_ulist_iter_last(const adt_ulist_t *self, adt_ulist_iter_t *pIter);
+adt_ulist_iter_t* adt_ulist_iter_next(adt_ulist_iter_t *pIter);
+adt_ulist_iter_t* adt_ulist_iter_prev(adt_ulist_iter_t *pIter);
+adt_ulist_iter_t* adt_ulist_find(const adt_ulist_t *self, void *pItem, adt_ulist_iter_t *pIter);
+int32_t adt_ulist_length(const adt_ulist_t *self);
+bool adt_ulist_is_empty(const adt_ulist_t *self);
+void adt_ulist_clear(adt_ulist_t *self);
+
+#endif //ADT_ULIST_H
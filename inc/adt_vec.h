@@ -0,0 +1,89 @@
+/*****************************************************************************
+* \file      adt_vec.h
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Vector storing fixed-size elements inline (no pointer indirection)
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+#ifndef ADT_VEC_H
+#define ADT_VEC_H
+
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <stdint.h>
+#include <stdbool.h>
+#include "adt_error.h"
+#include "adt_ary.h"
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Elements are copied by value into one contiguous block of memory.
+ * Functions taking a compare function (adt_vlt_func_t) pass pointers to elements,
+ * which means adt_i32_vlt and adt_u32_vlt work directly on vectors of int32_t/uint32_t.
+ */
+typedef struct adt_vec_tag
+{
+   uint8_t *pAlloc;              //array of elements
+   uint32_t u32ElemSize;         //size of each element in bytes
+   int32_t s32AllocLen;          //number of elements allocated
+   int32_t s32CurLen;            //number of elements currently in the vector
+   void (*pDestructor)(void*);   //optional destructor, called with a pointer to the element (not the element itself)
+} adt_vec_t;
+
+#define ADT_VEC_MIN_ALLOC_LEN 8
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+//Constructor/Destructor
+adt_error_t adt_vec_create(adt_vec_t *self, uint32_t u32ElemSize, void (*pDestructor)(void*));
+void adt_vec_destroy(adt_vec_t *self);
+adt_vec_t* adt_vec_new(uint32_t u32ElemSize, void (*pDestructor)(void*));
+void adt_vec_delete(adt_vec_t *self);
+void adt_vec_vdelete(void *arg);
+
+//Accessors
+adt_error_t adt_vec_push(adt_vec_t *self, const void *pElem);
+adt_error_t adt_vec_pop(adt_vec_t *self, void *pDest);
+adt_error_t adt_vec_insert(adt_vec_t *self, int32_t s32Index, const void *pElem);
+adt_error_t adt_vec_erase(adt_vec_t *self, int32_t s32Index);
+adt_error_t adt_vec_splice(adt_vec_t *self, int32_t s32Index, int32_t s32Len);
+void* adt_vec_get(const adt_vec_t *self, int32_t s32Index);
+void* adt_vec_data(const adt_vec_t *self);
+
+//Utility functions
+adt_error_t adt_vec_reserve(adt_vec_t *self, int32_t s32Len);
+adt_error_t adt_vec_resize(adt_vec_t *self, int32_t s32Len);
+void adt_vec_clear(adt_vec_t *self);
+int32_t adt_vec_length(const adt_vec_t *self);
+bool adt_vec_is_empty(const adt_vec_t *self);
+uint32_t adt_vec_elem_size(const adt_vec_t *self);
+adt_error_t adt_vec_sort(adt_vec_t *self, adt_vlt_func_t *vlt, bool reverse);
+adt_error_t adt_vec_sort_u32(adt_vec_t *self, bool reverse);
+adt_error_t adt_vec_sort_i32(adt_vec_t *self, bool reverse);
+adt_error_t adt_vec_sort_u64(adt_vec_t *self, bool reverse);
+int32_t adt_vec_bsearch(const adt_vec_t *self, const void *pKey, adt_vlt_func_t *vlt);
+
+#endif //ADT_VEC_H
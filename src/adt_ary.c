@@ -11,6 +11,22 @@
 #include <malloc.h>
 #include <assert.h>
 #include <string.h>
+#if (ADT_THREADS_ENABLE)
+#include <pthread.h>
+#endif
+#if (ADT_SIMD_ENABLE) && (UINTPTR_MAX == UINT64_MAX)
+# if defined(__x86_64__) || defined(_M_X64)
+#  define ADT_ARY_SIMD_SSE2 1
+#  include <emmintrin.h>
+#  if defined(__GNUC__)
+#   define ADT_ARY_SIMD_AVX2 1 //selected at runtime using __builtin_cpu_supports
+#   include <immintrin.h>
+#  endif
+# elif defined(__aarch64__) || defined(_M_ARM64)
+#  define ADT_ARY_SIMD_NEON 1
+#  include <arm_neon.h>
+# endif
+#endif
 #ifdef MEM_LEAK_CHECK
 #include "CMemLeak.h"
 #endif
@@ -21,11 +37,85 @@
 
 #define ELEM_SIZE (sizeof(void*))
 #define ELEM_VALUE_IS_LESS(T) ( *((T*) a) < *((T*) b) )
+#define SORT_RUN_LEN 16 //runs shorter than this are sorted using insertion sort before merging
+#define MIN_SPARE_LEN 8 //minimum number of spare elements added when array is reallocated with headroom
+#define SIMD_FIND_MIN_LEN 16 //shorter arrays are searched using a scalar loop
+
+typedef int32_t (adt_ary_find_func_t)(void * const *ppData, int32_t s32Len, const void *pElem);
+
+#if (ADT_THREADS_ENABLE)
+#define PARALLEL_SORT_MAX_THREADS 256
+#define PARALLEL_MERGE_MIN_LEN 8192 //merges shorter than this are not split between threads
+
+typedef struct adt_ary_sort_task_tag
+{
+   void **ppDest;       //destination of merge (output index 0)
+   void **ppLeft;       //left run (or data to sort when ppRight is NULL)
+   void **ppRight;      //right run (or temporary buffer when sorting)
+   int32_t s32LeftLen;
+   int32_t s32RightLen;
+   int32_t s32Begin;    //first output index handled by this task
+   int32_t s32End;      //one past last output index handled by this task
+   bool isSort;         //true: merge sort ppLeft using ppRight as buffer. false: merge part of two runs
+   adt_error_t result;
+} adt_ary_sort_task_t;
+
+typedef struct adt_ary_sort_worker_tag
+{
+   adt_ary_sort_task_t *pTasks;
+   int32_t s32NumTasks;
+   int32_t s32FirstTask;
+   int32_t s32Stride;
+   adt_vlt_func_t *vlt;
+   bool reverse;
+} adt_ary_sort_worker_t;
+#endif
 
 /**************** Private Function Declarations *******************/
 static void adt_block_memmove(uint8_t*pDest, uint8_t*pSrc, uint32_t u32Remain);
-static adt_error_t adt_ary_insertion_sort(adt_ary_t *self, adt_vlt_func_t *vlt, bool reverse);
+static int adt_ary_is_before(adt_vlt_func_t *vlt, const void *a, const void *b, bool reverse);
+static adt_error_t adt_ary_insertion_sort(void **ppData, int32_t s32Len, adt_vlt_func_t *vlt, bool reverse);
+static adt_error_t adt_ary_merge(void **ppDest, void **ppLeft, int32_t s32LeftLen, void **ppRight, int32_t s32RightLen, adt_vlt_func_t *vlt, bool reverse);
+static adt_error_t adt_ary_merge_sort(void **ppData, void **ppTmp, int32_t s32Len, adt_vlt_func_t *vlt, bool reverse);
+static adt_error_t adt_ary_introselect(void **ppData, int32_t s32Len, int32_t s32Index, adt_vlt_func_t *vlt, bool reverse);
+static adt_error_t adt_ary_heap_select(void **ppData, int32_t s32Len, int32_t s32Index, adt_vlt_func_t *vlt, bool reverse);
+static adt_error_t adt_ary_sift_down(void **ppHeap, int32_t s32Len, int32_t s32Index, adt_vlt_func_t *vlt, bool reverse);
+#if (ADT_THREADS_ENABLE)
+static adt_error_t adt_ary_corank(int32_t s32Rank, void **ppLeft, int32_t s32LeftLen, void **ppRight, int32_t s32RightLen, adt_vlt_func_t *vlt, bool reverse, int32_t *ps32LeftCount);
+static void* adt_ary_sort_worker(void *arg);
+static adt_error_t adt_ary_sort_run_tasks(adt_ary_sort_task_t *pTasks, int32_t s32NumTasks, int32_t s32NumThreads, adt_vlt_func_t *vlt, bool reverse);
+static adt_error_t adt_ary_parallel_merge_sort(void **ppData, void **ppTmp, int32_t s32Len, int32_t s32NumThreads, adt_vlt_func_t *vlt, bool reverse);
+#endif
+static adt_error_t adt_ary_make_room(adt_ary_t *self, int32_t s32Index, int32_t s32Count);
+static adt_error_t adt_ary_recenter(adt_ary_t *self, int32_t s32FrontLen, int32_t s32BackLen);
+static void adt_ary_free_alloc(adt_ary_t *self);
+static adt_error_t adt_ary_radix_sort32(adt_ary_t *self, adt_u32_key_func_t *key, void *arg, uint32_t u32Flip);
+static adt_error_t adt_ary_radix_sort64(adt_ary_t *self, adt_u64_key_func_t *key, void *arg, uint64_t u64Flip);
+static bool adt_ary_has_null(const adt_ary_t *self);
+static adt_error_t adt_ary_sort_ties(void **ppData, const uint64_t *pKeys, int32_t s32Len, adt_vlt_func_t *vlt, bool reverse);
+static uint32_t adt_ary_u32_key(const void *pElem, void *arg);
+static uint64_t adt_ary_u64_key(const void *pElem, void *arg);
+static int32_t adt_ary_bound(const adt_ary_t *self, const void *pElem, adt_vlt_func_t *vlt, bool upper);
+static int32_t adt_ary_find(void * const *ppData, int32_t s32Len, const void *pElem);
+static adt_ary_find_func_t* adt_ary_find_select(void);
+#if (ADT_THREADS_ENABLE)
+static void adt_ary_find_init(void);
+#endif
+static int32_t adt_ary_find_scalar(void * const *ppData, int32_t s32Len, const void *pElem);
+#if defined(ADT_ARY_SIMD_SSE2)
+static int32_t adt_ary_find_sse2(void * const *ppData, int32_t s32Len, const void *pElem);
+#endif
+#if defined(ADT_ARY_SIMD_AVX2)
+static int32_t adt_ary_find_avx2(void * const *ppData, int32_t s32Len, const void *pElem);
+#endif
+#if defined(ADT_ARY_SIMD_NEON)
+static int32_t adt_ary_find_neon(void * const *ppData, int32_t s32Len, const void *pElem);
+#endif
 /**************** Private Variable Declarations *******************/
+#if (ADT_THREADS_ENABLE)
+static pthread_once_t m_findKernelOnce = PTHREAD_ONCE_INIT;
+static adt_ary_find_func_t *m_pFindKernel = (adt_ary_find_func_t*) 0; //search kernel for long arrays, written once by adt_ary_find_init
+#endif
 
 
 /****************** Public Function Definitions *******************/
@@ -37,6 +127,27 @@ adt_ary_t*	adt_ary_new(void (*pDestructor)(void*)){
 	adt_ary_create(self,pDestructor);
 	return self;
 }
+/**
+ * Creates a new array with room for s32InlineLen elements allocated together with the array object itself.
+ * No further memory is allocated until the array grows beyond s32InlineLen elements.
+ * Delete using adt_ary_delete.
+ */
+adt_ary_t* adt_ary_new_inline(void (*pDestructor)(void*), int32_t s32InlineLen)
+{
+   adt_ary_t *self;
+   if ( (s32InlineLen < 0) || (((size_t) s32InlineLen) > ((SIZE_MAX - sizeof(adt_ary_t)) / ELEM_SIZE)) )
+   {
+      return (adt_ary_t*) 0;
+   }
+   self = (adt_ary_t*) malloc(sizeof(adt_ary_t) + (((size_t) s32InlineLen) * ELEM_SIZE));
+   if (self == 0)
+   {
+      return (adt_ary_t*) 0;
+   }
+   adt_ary_create_inline(self, pDestructor, (void**) (self + 1), s32InlineLen);
+   return self;
+}
+
 adt_ary_t*	adt_ary_make(void** ppElem, int32_t s32Len,void (*pDestructor)(void*)){
 	adt_ary_t *self;
 	int32_t s32i;
@@ -145,16 +256,12 @@ adt_error_t adt_ary_remove(adt_ary_t *self, void *pElem)
 {
    if (self != 0)
    {
-      int32_t s32Index;
-      adt_error_t result = ADT_NO_ERROR;
-      for(s32Index = 0; s32Index < self->s32CurLen; s32Index++ )
+      int32_t s32Index = adt_ary_find(self->pFirst, self->s32CurLen, pElem);
+      if (s32Index >= 0)
       {
-         if (self->pFirst[s32Index] == pElem){
-            result = adt_ary_splice(self, s32Index, 1);
-            break;
-         }
+         return adt_ary_splice(self, s32Index, 1);
       }
-      return result;
+      return ADT_NO_ERROR;
    }
    return ADT_INVALID_ARGUMENT_ERROR;
 }
@@ -177,6 +284,37 @@ adt_error_t	adt_ary_push(adt_ary_t *self, void *pElem){
    return ADT_INVALID_ARGUMENT_ERROR;
 }
 
+/**
+ * Appends s32Len elements from ppElems to the end of the array.
+ * ppElems must not point into the array itself.
+ */
+adt_error_t adt_ary_push_many(adt_ary_t *self, void **ppElems, int32_t s32Len)
+{
+   if (self != 0)
+   {
+      return adt_ary_insert_range(self, self->s32CurLen, ppElems, s32Len);
+   }
+   return ADT_INVALID_ARGUMENT_ERROR;
+}
+
+/**
+ * Inserts s32Len elements from ppElems before the element at s32Index (0 <= s32Index <= length).
+ * Existing elements are moved using a single memmove. ppElems must not point into the array itself.
+ */
+adt_error_t adt_ary_insert_range(adt_ary_t *self, int32_t s32Index, void **ppElems, int32_t s32Len)
+{
+   if ( (self != 0) && (s32Len >= 0) && ( (ppElems != 0) || (s32Len == 0) ) )
+   {
+      adt_error_t result = adt_ary_make_room(self, s32Index, s32Len);
+      if ( (result == ADT_NO_ERROR) && (s32Len > 0) )
+      {
+         memcpy(&self->pFirst[s32Index], ppElems, ((size_t) s32Len) * ELEM_SIZE);
+      }
+      return result;
+   }
+   return ADT_INVALID_ARGUMENT_ERROR;
+}
+
 /**
  * Same as adt_ary_push but skips adding if it already exists.
  * Runs in linear time.
@@ -184,12 +322,9 @@ adt_error_t	adt_ary_push(adt_ary_t *self, void *pElem){
 adt_error_t adt_ary_push_unique(adt_ary_t *self, void *pElem){
    if (self != 0)
    {
-      int32_t s32Index;
-      for(s32Index = 0; s32Index < self->s32CurLen; s32Index++ )
+      if (adt_ary_find(self->pFirst, self->s32CurLen, pElem) >= 0)
       {
-         if (self->pFirst[s32Index] == pElem){
-            return ADT_NO_ERROR;
-         }
+         return ADT_NO_ERROR;
       }
       return adt_ary_push(self, pElem);
    }
@@ -243,18 +378,11 @@ adt_error_t	adt_ary_unshift(adt_ary_t *self, void *pElem){
          return ADT_NO_ERROR;
       }
       else {
-         //no room at beginning of array, move all array data forward by one
-         uint8_t *pBegin,*pEnd;
-         adt_error_t result;
-         uint32_t u32ElemSize = sizeof(void**);
-         result = adt_ary_extend(self,(int32_t) (self->s32CurLen+1));
+         //no room at beginning of array, recenter array data leaving headroom at both ends
+         adt_error_t result = adt_ary_recenter(self, 1, 0);
          if (result == ADT_NO_ERROR) {
-            uint32_t u32Remain;
-            pBegin = (uint8_t*) self->pFirst+u32ElemSize;
-            pEnd = ((uint8_t*) &self->pFirst[self->s32CurLen]);
-            u32Remain = (uint32_t) (pEnd-pBegin);
-            adt_block_memmove(pBegin, (uint8_t*) self->pFirst, u32Remain);
-            self->pFirst[0]=pElem;
+            *(--self->pFirst)=pElem;
+            self->s32CurLen++;
          }
          return result;
       }
@@ -267,40 +395,68 @@ adt_error_t	adt_ary_unshift(adt_ary_t *self, void *pElem){
 adt_error_t	adt_ary_extend(adt_ary_t *self, int32_t s32Len){
    if (self != 0) {
       void **ppAlloc;
+      int32_t s32FrontLen;
       //check if current length is greater than requested length
       if( self->s32CurLen>=s32Len ) return ADT_NO_ERROR;
 
-      //check if allocated length is greater than requested length
-      if( (self->s32AllocLen>=s32Len) ){
-         //shift array data to start of allocated array
-         memmove(self->ppAlloc,self->pFirst,((unsigned int)self->s32CurLen) * sizeof(void*));
-         self->pFirst = self->ppAlloc;
+      s32FrontLen = (int32_t) (self->pFirst - self->ppAlloc);
+      //check if there is room after the last element
+      if( (s32Len <= (self->s32AllocLen - s32FrontLen)) ){
+         self->s32CurLen = s32Len;
+      }
+      else if (s32FrontLen > 0) {
+         //array is in use at both ends, recenter (and possibly reallocate) to keep headroom
+         adt_error_t result = adt_ary_recenter(self, 0, s32Len - self->s32CurLen);
+         if (result != ADT_NO_ERROR) {
+            return result;
+         }
          self->s32CurLen = s32Len;
       }
       else {
          //need to allocate new array data element and copy data to newly allocated memory
+         int32_t s32AllocLen = s32Len;
+         int32_t s32GrowLen;
          if(s32Len>= INT32_MAX){
             return ADT_LENGTH_ERROR;
          }
-         ppAlloc = (void**) malloc(ELEM_SIZE*((unsigned int)s32Len));
+         //grow by at least 50% so that repeated push is amortized O(1)
+         s32GrowLen = (self->s32AllocLen > ((INT32_MAX - 1) / 3) * 2)? (INT32_MAX - 1) : (self->s32AllocLen + (self->s32AllocLen >> 1));
+         if (s32GrowLen > s32AllocLen) {
+            s32AllocLen = s32GrowLen;
+         }
+         ppAlloc = (void**) malloc(ELEM_SIZE*((size_t)s32AllocLen));
          if (ppAlloc == 0)
          {
             return ADT_MEM_ERROR;
          }
+         memset(ppAlloc+self->s32CurLen, 0, ((size_t) (s32AllocLen - self->s32CurLen)) * ELEM_SIZE);
          if(self->ppAlloc){
-            size_t numNewElems = (size_t) (s32Len - self->s32CurLen);
-            memset(ppAlloc+self->s32CurLen, 0,  numNewElems * ELEM_SIZE);
             memcpy(ppAlloc,self->pFirst, ((unsigned int)self->s32CurLen) * ELEM_SIZE);
-            free(self->ppAlloc);
+            adt_ary_free_alloc(self);
          }
          self->ppAlloc = self->pFirst = ppAlloc;
-         self->s32AllocLen = self->s32CurLen = s32Len;
+         self->s32AllocLen = s32AllocLen;
+         self->s32CurLen = s32Len;
       }
       return ADT_NO_ERROR;
    }
 	return ADT_INVALID_ARGUMENT_ERROR;
 }
 
+/**
+ * Makes sure there is room for at least s32Len calls to adt_ary_unshift without moving array data.
+ */
+adt_error_t adt_ary_reserve_front(adt_ary_t *self, int32_t s32Len)
+{
+   if ( (self != 0) && (s32Len >= 0) ) {
+      if ( (self->pFirst - self->ppAlloc) >= s32Len) {
+         return ADT_NO_ERROR;
+      }
+      return adt_ary_recenter(self, s32Len, 0);
+   }
+   return ADT_INVALID_ARGUMENT_ERROR;
+}
+
 adt_error_t adt_ary_fill(adt_ary_t *self, int32_t s32Len){
    if (self != 0) {
       int32_t s32Index;
@@ -346,6 +502,39 @@ void adt_ary_clear(adt_ary_t *self){
 	}
 }
 
+/**
+ * Keeps elements for which pred returns true and removes all others in a single pass.
+ * The order of kept elements is preserved. The destructor (if enabled) is called on removed elements only.
+ */
+adt_error_t adt_ary_retain(adt_ary_t *self, adt_pred_func_t *pred, void *arg)
+{
+   if ( (self != 0) && (pred != 0) )
+   {
+      int32_t s32Read;
+      int32_t s32Write = 0;
+      bool callDestructor = ( (self->destructorEnable != false) && (self->pDestructor != 0) );
+      for (s32Read = 0; s32Read < self->s32CurLen; s32Read++)
+      {
+         void *pElem = self->pFirst[s32Read];
+         if (pred(pElem, arg))
+         {
+            self->pFirst[s32Write++] = pElem;
+         }
+         else if (callDestructor)
+         {
+            self->pDestructor(pElem);
+         }
+      }
+      self->s32CurLen = s32Write;
+      if (self->s32CurLen == 0)
+      {
+         self->pFirst = self->ppAlloc;
+      }
+      return ADT_NO_ERROR;
+   }
+   return ADT_INVALID_ARGUMENT_ERROR;
+}
+
 int32_t adt_ary_length(const adt_ary_t *self){
 	if(self){
 		return self->s32CurLen;
@@ -388,6 +577,22 @@ void adt_ary_create(adt_ary_t *self,void (*pDestructor)(void*)){
 	self->pDestructor = pDestructor;
 	self->pFillElem = (void*)0;
 	self->destructorEnable = true;
+	self->ppInline = (void**) 0;
+	self->s32InlineLen = 0;
+}
+
+/**
+ * Same as adt_ary_create but uses the caller-supplied buffer ppInline until the array grows beyond s32InlineLen elements.
+ * The buffer must outlive the array. It is reused after adt_ary_clear/adt_ary_destroy.
+ */
+void adt_ary_create_inline(adt_ary_t *self, void (*pDestructor)(void*), void **ppInline, int32_t s32InlineLen)
+{
+   adt_ary_create(self, pDestructor);
+   if ( (ppInline != 0) && (s32InlineLen > 0) )
+   {
+      self->ppInline = self->ppAlloc = self->pFirst = ppInline;
+      self->s32InlineLen = self->s32AllocLen = s32InlineLen;
+   }
 }
 
 void adt_ary_destroy(adt_ary_t *self){
@@ -399,12 +604,11 @@ void adt_ary_destroy(adt_ary_t *self){
 			self->pDestructor(*(ppElem++));
 		}
 	}
-	if(self->ppAlloc != 0){
-		free(self->ppAlloc);
-	}
-	self->ppAlloc = (void**) 0;
-	self->s32AllocLen = 0;
-	self->pFirst = (void**) 0;
+	adt_ary_free_alloc(self);
+	//return to inline storage (if any)
+	self->ppAlloc = self->ppInline;
+	self->s32AllocLen = self->s32InlineLen;
+	self->pFirst = self->ppInline;
 	self->s32CurLen = 0;
 }
 
@@ -475,16 +679,226 @@ adt_error_t adt_ary_splice(adt_ary_t *self,int32_t s32Index, int32_t s32Len){
 /**
  * sorts the array using the given key function.
  * If reverse is true it will be sorted in descending order, otherwise it will
- * be sorted in ascending order
+ * be sorted in ascending order.
+ * The sort is stable (merge sort), equal elements keep their relative order.
  */
 adt_error_t adt_ary_sort(adt_ary_t *self, adt_vlt_func_t *key, bool reverse)
 {
+   void **ppTmp;
+   adt_error_t result;
+   if ( (self == 0) || (key == 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (self->s32CurLen <= SORT_RUN_LEN)
+   {
+      return adt_ary_insertion_sort(self->pFirst, self->s32CurLen, key, reverse);
+   }
+   ppTmp = (void**) malloc(ELEM_SIZE * ((size_t) self->s32CurLen));
+   if (ppTmp == 0)
+   {
+      return ADT_MEM_ERROR;
+   }
+   result = adt_ary_merge_sort(self->pFirst, ppTmp, self->s32CurLen, key, reverse);
+   free(ppTmp);
+   return result;
+}
+
+/**
+ * Same as adt_ary_sort but splits the work between s32NumThreads threads.
+ * The result is identical to the result of adt_ary_sort.
+ * Arrays shorter than ADT_ARY_PARALLEL_SORT_MIN_LEN are sorted in the calling thread.
+ * The key function is called concurrently from several threads and must be thread-safe.
+ * When ADT is built without thread support this is the same as calling adt_ary_sort.
+ */
+adt_error_t adt_ary_sort_parallel(adt_ary_t *self, adt_vlt_func_t *key, bool reverse, int32_t s32NumThreads)
+{
+   if ( (self == 0) || (key == 0) || (s32NumThreads < 1) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+#if (ADT_THREADS_ENABLE)
+   if ( (s32NumThreads > 1) && (self->s32CurLen >= ADT_ARY_PARALLEL_SORT_MIN_LEN) )
+   {
+      void **ppTmp;
+      adt_error_t result;
+      if (s32NumThreads > PARALLEL_SORT_MAX_THREADS)
+      {
+         s32NumThreads = PARALLEL_SORT_MAX_THREADS;
+      }
+      ppTmp = (void**) malloc(ELEM_SIZE * ((size_t) self->s32CurLen));
+      if (ppTmp == 0)
+      {
+         return ADT_MEM_ERROR;
+      }
+      result = adt_ary_parallel_merge_sort(self->pFirst, ppTmp, self->s32CurLen, s32NumThreads, key, reverse);
+      free(ppTmp);
+      return result;
+   }
+#endif
+   return adt_ary_sort(self, key, reverse);
+}
+
+/**
+ * Sorts an array of pointers to uint32_t by value using radix sort. The sort is stable.
+ * Returns ADT_INVALID_ARGUMENT_ERROR if the array contains NULL pointers.
+ */
+adt_error_t adt_ary_sort_u32(adt_ary_t *self, bool reverse)
+{
+   if ( (self == 0) || adt_ary_has_null(self) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   return adt_ary_radix_sort32(self, adt_ary_u32_key, (void*) 0, reverse? UINT32_MAX : 0u);
+}
+
+/**
+ * Sorts an array of pointers to int32_t by value using radix sort. The sort is stable.
+ * Returns ADT_INVALID_ARGUMENT_ERROR if the array contains NULL pointers.
+ */
+adt_error_t adt_ary_sort_i32(adt_ary_t *self, bool reverse)
+{
+   if ( (self == 0) || adt_ary_has_null(self) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   //flipping the sign bit maps int32_t to uint32_t while preserving order
+   return adt_ary_radix_sort32(self, adt_ary_u32_key, (void*) 0, reverse? INT32_MAX : 0x80000000u);
+}
+
+/**
+ * Sorts an array of pointers to uint64_t by value using radix sort. The sort is stable.
+ * Returns ADT_INVALID_ARGUMENT_ERROR if the array contains NULL pointers.
+ */
+adt_error_t adt_ary_sort_u64(adt_ary_t *self, bool reverse)
+{
+   if ( (self == 0) || adt_ary_has_null(self) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   return adt_ary_radix_sort64(self, adt_ary_u64_key, (void*) 0, reverse? UINT64_MAX : 0u);
+}
+
+/**
+ * Sorts the array by a 32-bit key using radix sort. key is called exactly once per element, arg is passed through to it.
+ */
+adt_error_t adt_ary_sort_u32_key(adt_ary_t *self, adt_u32_key_func_t *key, void *arg, bool reverse)
+{
+   if ( (self == 0) || (key == 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   return adt_ary_radix_sort32(self, key, arg, reverse? UINT32_MAX : 0u);
+}
+
+/**
+ * Sorts the array by a 64-bit key using radix sort. key is called exactly once per element, arg is passed through to it.
+ */
+adt_error_t adt_ary_sort_u64_key(adt_ary_t *self, adt_u64_key_func_t *key, void *arg, bool reverse)
+{
+   if ( (self == 0) || (key == 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   return adt_ary_radix_sort64(self, key, arg, reverse? UINT64_MAX : 0u);
+}
+
+/**
+ * Decorate-sort-undecorate: calls key once per element, radix sorts the (key, element) pairs and then uses vlt
+ * only to order elements with equal keys. The key must be consistent with vlt, i.e. key(a) < key(b) implies
+ * vlt(a, b) != 0. A key can therefore be a prefix of the full sort key (see adt_str_prefix_key).
+ * When vlt is NULL, elements with equal keys keep their original order.
+ */
+adt_error_t adt_ary_sort_by_key(adt_ary_t *self, adt_u64_key_func_t *key, void *arg, adt_vlt_func_t *vlt, bool reverse)
+{
+   uint64_t *pKeys;
+   uint64_t u64Flip = reverse? UINT64_MAX : 0u;
+   int32_t i;
+   adt_error_t result;
    if ( (self == 0) || (key == 0) )
    {
       return ADT_INVALID_ARGUMENT_ERROR;
    }
-   ///TODO: For now we simply use insertion sort. Will need to implement Timsort later on.
-   return adt_ary_insertion_sort(self, key, reverse);
+   if (self->s32CurLen < 2)
+   {
+      return ADT_NO_ERROR;
+   }
+   pKeys = (uint64_t*) malloc(sizeof(uint64_t) * ((size_t) self->s32CurLen));
+   if (pKeys == 0)
+   {
+      return ADT_MEM_ERROR;
+   }
+   for (i = 0; i < self->s32CurLen; i++)
+   {
+      pKeys[i] = key(self->pFirst[i], arg) ^ u64Flip;
+   }
+   result = adt_radix_sort_u64(pKeys, self->pFirst, (size_t) self->s32CurLen);
+   if ( (result == ADT_NO_ERROR) && (vlt != 0) )
+   {
+      result = adt_ary_sort_ties(self->pFirst, pKeys, self->s32CurLen, vlt, reverse);
+   }
+   free(pKeys);
+   return result;
+}
+
+/**
+ * Sorts only the first s32Len elements: afterwards they are the s32Len lowest elements (highest when reverse is true)
+ * in sorted order. The order of the remaining elements is unspecified.
+ * Runs in O(n + k log k) time which is much cheaper than a full sort when s32Len is small compared to the array length.
+ */
+adt_error_t adt_ary_partial_sort(adt_ary_t *self, int32_t s32Len, adt_vlt_func_t *vlt, bool reverse)
+{
+   void **ppTmp;
+   adt_error_t result;
+   if ( (self == 0) || (vlt == 0) || (s32Len < 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (s32Len >= self->s32CurLen)
+   {
+      return adt_ary_sort(self, vlt, reverse);
+   }
+   if (s32Len == 0)
+   {
+      return ADT_NO_ERROR;
+   }
+   result = adt_ary_introselect(self->pFirst, self->s32CurLen, s32Len - 1, vlt, reverse);
+   if (result != ADT_NO_ERROR)
+   {
+      return result;
+   }
+   //element at s32Len-1 is already in its final position
+   if (s32Len <= SORT_RUN_LEN)
+   {
+      return adt_ary_insertion_sort(self->pFirst, s32Len - 1, vlt, reverse);
+   }
+   ppTmp = (void**) malloc(ELEM_SIZE * ((size_t) s32Len));
+   if (ppTmp == 0)
+   {
+      return ADT_MEM_ERROR;
+   }
+   result = adt_ary_merge_sort(self->pFirst, ppTmp, s32Len - 1, vlt, reverse);
+   free(ppTmp);
+   return result;
+}
+
+/**
+ * Moves the element that belongs at s32Index in the sorted array to that position. Elements before it are not ordered
+ * after it and elements after it are not ordered before it, otherwise their order is unspecified.
+ * Uses introselect: quickselect with median-of-three pivots, falling back to heap selection when partitioning
+ * degenerates. Average time is O(n), worst case O(n log n).
+ */
+adt_error_t adt_ary_nth_element(adt_ary_t *self, int32_t s32Index, adt_vlt_func_t *vlt, bool reverse)
+{
+   if ( (self == 0) || (vlt == 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if ( (s32Index < 0) || (s32Index >= self->s32CurLen) )
+   {
+      return ADT_INDEX_OUT_OF_BOUNDS_ERROR;
+   }
+   return adt_ary_introselect(self->pFirst, self->s32CurLen, s32Index, vlt, reverse);
 }
 
 int adt_i32_vlt(const void *a, const void *b)
@@ -512,99 +926,1111 @@ int32_t adt_ary_indexOf(adt_ary_t *self, void *pElem)
 {
    if (self != 0)
    {
-      int32_t s32Index;
-      for(s32Index = 0; s32Index < self->s32CurLen; s32Index++ )
+      return adt_ary_find(self->pFirst, self->s32CurLen, pElem);
+   }
+   return -1;
+}
+
+/**
+ * Binary search in an array sorted in ascending order (according to vlt).
+ * Returns the index of the first element equal to pElem or -1 if not found.
+ */
+int32_t adt_ary_bsearch(const adt_ary_t *self, const void *pElem, adt_vlt_func_t *vlt)
+{
+   int32_t s32Index = adt_ary_lower_bound(self, pElem, vlt);
+   if ( (s32Index >= 0) && (s32Index < self->s32CurLen) )
+   {
+      if (vlt(pElem, self->pFirst[s32Index]) == 0)
       {
-         if (self->pFirst[s32Index] == pElem) {
-            return s32Index;
-         }
+         return s32Index;
       }
    }
    return -1;
 }
 
-/***************** Private Function Definitions *******************/
 /**
- * CG: I had some serious issues with some Microsoft compilers not handling large memmoves.
- * To mitigate this potential problem I use this function to transform one large memmoves into a series of smaller memmoves.
+ * Returns index of the first element that is not less than pElem (array length if no such element exists).
+ * Returns -1 on error.
  */
-static void adt_block_memmove(uint8_t *pDest, uint8_t*pSrc, uint32_t u32Remain){
-   while(u32Remain>0){
-      uint32_t u32Size = (u32Remain>DATA_BLOCK_MAX)? DATA_BLOCK_MAX : u32Remain;
-      memmove(pDest, pSrc, u32Size);
-      u32Remain-=u32Size;
-      pDest+=u32Size;
-      pSrc+=u32Size;
-   }
+int32_t adt_ary_lower_bound(const adt_ary_t *self, const void *pElem, adt_vlt_func_t *vlt)
+{
+   return adt_ary_bound(self, pElem, vlt, false);
 }
 
-static adt_error_t adt_ary_insertion_sort(adt_ary_t *self, adt_vlt_func_t *vlt, bool reverse)
+/**
+ * Returns index of the first element that is greater than pElem (array length if no such element exists).
+ * Returns -1 on error.
+ */
+int32_t adt_ary_upper_bound(const adt_ary_t *self, const void *pElem, adt_vlt_func_t *vlt)
 {
-   int32_t arrayLen = self->s32CurLen;
-   if (arrayLen > 1)
-   {
-      int32_t unsortedStart = 1;
+   return adt_ary_bound(self, pElem, vlt, true);
+}
 
-      while(unsortedStart < arrayLen)
+/**
+ * Inserts pElem into a sorted array, after any elements equal to it.
+ * Runs in O(log n) comparisons and a single memmove.
+ */
+adt_error_t adt_ary_insert_sorted(adt_ary_t *self, void *pElem, adt_vlt_func_t *vlt)
+{
+   if ( (self != 0) && (vlt != 0) )
+   {
+      adt_error_t result;
+      int32_t s32Index = adt_ary_upper_bound(self, pElem, vlt);
+      if (s32Index < 0)
       {
-         int result;
-         void *rhs = self->pFirst[unsortedStart];
-         void *lhs = self->pFirst[unsortedStart-1];
-         result = vlt(lhs, rhs);
-         if (result < 0)
-         {
-            return ADT_OBJECT_COMPARE_ERROR;
-         }
-         else
-         {
-            if (reverse)
-            {
-               result = !result;
-            }
-            if (result == 0)
-            {
-               int32_t i;
-               bool isHandled = false;
-               self->pFirst[unsortedStart] = lhs;
-               for(i=unsortedStart-1; i>0; i--)
-               {
-                  lhs = self->pFirst[i-1];
-                  result = vlt(lhs, rhs);
-                  if (result < 0)
-                  {
-                     return ADT_OBJECT_COMPARE_ERROR;
-                  }
-                  if (reverse)
-                  {
-                     result = !result;
-                  }
-                  if (result == 0)
-                  {
-                     self->pFirst[i] = lhs;
-                  }
-                  else
-                  {
-                     isHandled = true;
-                     self->pFirst[i] = rhs;
-                     unsortedStart++;
-                     break;
-                  }
-               }
-               if (!isHandled)
-               {
-                  assert(i == 0);
-                  self->pFirst[0] = rhs;
-                  unsortedStart++;
-               }
-            }
-            else
-            {
-               unsortedStart++; //items are already sorted
-            }
-         }
+         return ADT_OBJECT_COMPARE_ERROR;
       }
+      result = adt_ary_make_room(self, s32Index, 1);
+      if (result == ADT_NO_ERROR)
+      {
+         self->pFirst[s32Index] = pElem;
+      }
+      return result;
    }
-   return ADT_NO_ERROR;
+   return ADT_INVALID_ARGUMENT_ERROR;
 }
 
-
+/**
+ * Removes consecutive duplicates from a sorted array, keeping the first element of each group of equal elements.
+ * The destructor is called on removed elements.
+ */
+adt_error_t adt_ary_unique_sorted(adt_ary_t *self, adt_vlt_func_t *vlt)
+{
+   if ( (self != 0) && (vlt != 0) )
+   {
+      int32_t s32Read;
+      int32_t s32Write = 1;
+      adt_error_t result = ADT_NO_ERROR;
+      bool callDestructor = ( (self->pDestructor != 0) && (self->destructorEnable != false) );
+      if (self->s32CurLen < 2)
+      {
+         return ADT_NO_ERROR;
+      }
+      for (s32Read = 1; s32Read < self->s32CurLen; s32Read++)
+      {
+         void *pElem = self->pFirst[s32Read];
+         int isLess = (result == ADT_NO_ERROR)? vlt(self->pFirst[s32Write-1], pElem) : 1;
+         if (isLess < 0)
+         {
+            //keep remaining elements as they are
+            result = ADT_OBJECT_COMPARE_ERROR;
+            isLess = 1;
+         }
+         if (isLess != 0)
+         {
+            self->pFirst[s32Write++] = pElem;
+         }
+         else if (callDestructor)
+         {
+            self->pDestructor(pElem);
+         }
+      }
+      self->s32CurLen = s32Write;
+      return result;
+   }
+   return ADT_INVALID_ARGUMENT_ERROR;
+}
+
+/**
+ * Moves all elements of the sorted array other into the sorted array self in linear time.
+ * The merge is stable: elements from self are placed before equal elements from other.
+ * When the function returns, other is empty. In case vlt reports an error, self still
+ * contains all elements but the order is unspecified.
+ */
+adt_error_t adt_ary_merge_sorted(adt_ary_t *self, adt_ary_t *other, adt_vlt_func_t *vlt)
+{
+   if ( (self != 0) && (other != 0) && (self != other) && (vlt != 0) )
+   {
+      int32_t i, j, k;
+      adt_error_t result;
+      if (other->s32CurLen == 0)
+      {
+         return ADT_NO_ERROR;
+      }
+      if (self->s32CurLen > (INT32_MAX - other->s32CurLen))
+      {
+         return ADT_LENGTH_ERROR;
+      }
+      i = self->s32CurLen - 1;
+      j = other->s32CurLen - 1;
+      result = adt_ary_extend(self, self->s32CurLen + other->s32CurLen);
+      if (result != ADT_NO_ERROR)
+      {
+         return result;
+      }
+      //merge from the back which lets us merge directly into self without a temporary buffer
+      k = self->s32CurLen - 1;
+      while ( (j >= 0) && (result == ADT_NO_ERROR) )
+      {
+         int isLess = (i >= 0)? vlt(other->pFirst[j], self->pFirst[i]) : 0;
+         if (isLess < 0)
+         {
+            result = ADT_OBJECT_COMPARE_ERROR;
+         }
+         else if (isLess != 0)
+         {
+            self->pFirst[k--] = self->pFirst[i--];
+         }
+         else
+         {
+            self->pFirst[k--] = other->pFirst[j--];
+         }
+      }
+      if (j >= 0)
+      {
+         //error recovery: remaining elements of other fit exactly into the unused gap
+         assert(k == (i + j + 1));
+         memcpy(&self->pFirst[i+1], other->pFirst, ((size_t) (j + 1)) * ELEM_SIZE);
+      }
+      other->s32CurLen = 0;
+      other->pFirst = other->ppAlloc;
+      return result;
+   }
+   return ADT_INVALID_ARGUMENT_ERROR;
+}
+
+/***************** Private Function Definitions *******************/
+/**
+ * CG: I had some serious issues with some Microsoft compilers not handling large memmoves.
+ * To mitigate this potential problem I use this function to transform one large memmoves into a series of smaller memmoves.
+ */
+static void adt_block_memmove(uint8_t *pDest, uint8_t*pSrc, uint32_t u32Remain){
+   if (pDest > pSrc) {
+      //overlapping move towards higher addresses must copy the last block first
+      pDest+=u32Remain;
+      pSrc+=u32Remain;
+      while(u32Remain>0){
+         uint32_t u32Size = (u32Remain>DATA_BLOCK_MAX)? DATA_BLOCK_MAX : u32Remain;
+         pDest-=u32Size;
+         pSrc-=u32Size;
+         memmove(pDest, pSrc, u32Size);
+         u32Remain-=u32Size;
+      }
+   }
+   else {
+      while(u32Remain>0){
+         uint32_t u32Size = (u32Remain>DATA_BLOCK_MAX)? DATA_BLOCK_MAX : u32Remain;
+         memmove(pDest, pSrc, u32Size);
+         u32Remain-=u32Size;
+         pDest+=u32Size;
+         pSrc+=u32Size;
+      }
+   }
+}
+
+/**
+ * Moves array data so that there are at least s32FrontLen free elements before pFirst and
+ * s32BackLen free elements after the last element. Remaining free space is split evenly between both ends.
+ * The array is reallocated when the spare space would otherwise be smaller than the current length,
+ * which makes repeated calls from adt_ary_unshift and adt_ary_push amortized O(1).
+ */
+static adt_error_t adt_ary_recenter(adt_ary_t *self, int32_t s32FrontLen, int32_t s32BackLen)
+{
+   int32_t s32NeededLen;
+   int32_t s32SpareLen;
+   int32_t s32NewFrontLen;
+   if ( (s32FrontLen > (INT32_MAX - 1 - self->s32CurLen)) || (s32BackLen > (INT32_MAX - 1 - self->s32CurLen - s32FrontLen)) )
+   {
+      return ADT_LENGTH_ERROR;
+   }
+   s32NeededLen = self->s32CurLen + s32FrontLen + s32BackLen;
+   s32SpareLen = self->s32AllocLen - s32NeededLen;
+   if ( (s32SpareLen >= 0) && (s32SpareLen >= self->s32CurLen) )
+   {
+      //enough free space, move data within current allocation
+      s32NewFrontLen = s32FrontLen + (s32SpareLen / 2);
+      memmove(&self->ppAlloc[s32NewFrontLen], self->pFirst, ((size_t) self->s32CurLen) * ELEM_SIZE);
+      self->pFirst = &self->ppAlloc[s32NewFrontLen];
+   }
+   else
+   {
+      void **ppAlloc;
+      int32_t s32AllocLen;
+      s32SpareLen = (self->s32CurLen > MIN_SPARE_LEN)? self->s32CurLen : MIN_SPARE_LEN;
+      if (s32SpareLen > (INT32_MAX - 1 - s32NeededLen))
+      {
+         s32SpareLen = INT32_MAX - 1 - s32NeededLen;
+      }
+      s32AllocLen = s32NeededLen + s32SpareLen;
+      ppAlloc = (void**) malloc(ELEM_SIZE * ((size_t) s32AllocLen));
+      if (ppAlloc == 0)
+      {
+         return ADT_MEM_ERROR;
+      }
+      s32NewFrontLen = s32FrontLen + (s32SpareLen / 2);
+      memset(ppAlloc, 0, ELEM_SIZE * ((size_t) s32AllocLen));
+      if (self->ppAlloc != 0)
+      {
+         memcpy(&ppAlloc[s32NewFrontLen], self->pFirst, ((size_t) self->s32CurLen) * ELEM_SIZE);
+         adt_ary_free_alloc(self);
+      }
+      self->ppAlloc = ppAlloc;
+      self->pFirst = &ppAlloc[s32NewFrontLen];
+      self->s32AllocLen = s32AllocLen;
+   }
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Opens a gap of s32Count elements at s32Index (0 <= s32Index <= s32CurLen) using a single memmove.
+ * The content of the gap is undefined.
+ */
+static adt_error_t adt_ary_make_room(adt_ary_t *self, int32_t s32Index, int32_t s32Count)
+{
+   adt_error_t result;
+   int32_t s32ElemsToMove;
+   if ( (s32Index < 0) || (s32Index > self->s32CurLen) || (s32Count < 0) )
+   {
+      return ADT_INDEX_OUT_OF_BOUNDS_ERROR;
+   }
+   if (s32Count > (INT32_MAX - 1 - self->s32CurLen))
+   {
+      return ADT_LENGTH_ERROR;
+   }
+   s32ElemsToMove = self->s32CurLen - s32Index;
+   result = adt_ary_extend(self, self->s32CurLen + s32Count);
+   if ( (result == ADT_NO_ERROR) && (s32ElemsToMove > 0) && (s32Count > 0) )
+   {
+      adt_block_memmove((uint8_t*) &self->pFirst[s32Index + s32Count], (uint8_t*) &self->pFirst[s32Index], ((uint32_t) s32ElemsToMove) * ((uint32_t) ELEM_SIZE));
+   }
+   return result;
+}
+
+/**
+ * Extracts keys (XOR:ed with u32Flip) into a side array and radix sorts the array elements along with them
+ */
+static adt_error_t adt_ary_radix_sort32(adt_ary_t *self, adt_u32_key_func_t *key, void *arg, uint32_t u32Flip)
+{
+   uint32_t *pKeys;
+   int32_t i;
+   adt_error_t result;
+   if (self->s32CurLen < 2)
+   {
+      return ADT_NO_ERROR;
+   }
+   pKeys = (uint32_t*) malloc(sizeof(uint32_t) * ((size_t) self->s32CurLen));
+   if (pKeys == 0)
+   {
+      return ADT_MEM_ERROR;
+   }
+   for (i = 0; i < self->s32CurLen; i++)
+   {
+      pKeys[i] = key(self->pFirst[i], arg) ^ u32Flip;
+   }
+   result = adt_radix_sort_u32(pKeys, self->pFirst, (size_t) self->s32CurLen);
+   free(pKeys);
+   return result;
+}
+
+static adt_error_t adt_ary_radix_sort64(adt_ary_t *self, adt_u64_key_func_t *key, void *arg, uint64_t u64Flip)
+{
+   uint64_t *pKeys;
+   int32_t i;
+   adt_error_t result;
+   if (self->s32CurLen < 2)
+   {
+      return ADT_NO_ERROR;
+   }
+   pKeys = (uint64_t*) malloc(sizeof(uint64_t) * ((size_t) self->s32CurLen));
+   if (pKeys == 0)
+   {
+      return ADT_MEM_ERROR;
+   }
+   for (i = 0; i < self->s32CurLen; i++)
+   {
+      pKeys[i] = key(self->pFirst[i], arg) ^ u64Flip;
+   }
+   result = adt_radix_sort_u64(pKeys, self->pFirst, (size_t) self->s32CurLen);
+   free(pKeys);
+   return result;
+}
+
+/**
+ * Sorts each run of equal keys using vlt. pKeys must be sorted.
+ */
+static adt_error_t adt_ary_sort_ties(void **ppData, const uint64_t *pKeys, int32_t s32Len, adt_vlt_func_t *vlt, bool reverse)
+{
+   void **ppTmp = (void**) 0;
+   int32_t s32Begin = 0;
+   adt_error_t result = ADT_NO_ERROR;
+   while ( (s32Begin < s32Len) && (result == ADT_NO_ERROR) )
+   {
+      int32_t s32End = s32Begin + 1;
+      while ( (s32End < s32Len) && (pKeys[s32End] == pKeys[s32Begin]) )
+      {
+         s32End++;
+      }
+      if ( (s32End - s32Begin) > SORT_RUN_LEN)
+      {
+         if (ppTmp == 0)
+         {
+            ppTmp = (void**) malloc(ELEM_SIZE * ((size_t) s32Len));
+            if (ppTmp == 0)
+            {
+               return ADT_MEM_ERROR;
+            }
+         }
+         result = adt_ary_merge_sort(&ppData[s32Begin], ppTmp, s32End - s32Begin, vlt, reverse);
+      }
+      else if ( (s32End - s32Begin) > 1)
+      {
+         result = adt_ary_insertion_sort(&ppData[s32Begin], s32End - s32Begin, vlt, reverse);
+      }
+      s32Begin = s32End;
+   }
+   if (ppTmp != 0)
+   {
+      free(ppTmp);
+   }
+   return result;
+}
+
+static bool adt_ary_has_null(const adt_ary_t *self)
+{
+   int32_t i;
+   for (i = 0; i < self->s32CurLen; i++)
+   {
+      if (self->pFirst[i] == 0)
+      {
+         return true;
+      }
+   }
+   return false;
+}
+
+static uint32_t adt_ary_u32_key(const void *pElem, void *arg)
+{
+   (void) arg;
+   return *((const uint32_t*) pElem);
+}
+
+static uint64_t adt_ary_u64_key(const void *pElem, void *arg)
+{
+   (void) arg;
+   return *((const uint64_t*) pElem);
+}
+
+/**
+ * Frees ppAlloc unless it points to inline storage
+ */
+static void adt_ary_free_alloc(adt_ary_t *self)
+{
+   if ( (self->ppAlloc != 0) && (self->ppAlloc != self->ppInline) )
+   {
+      free(self->ppAlloc);
+   }
+}
+
+/**
+ * Binary search returning lower bound (upper=false) or upper bound (upper=true). Returns -1 on error.
+ */
+static int32_t adt_ary_bound(const adt_ary_t *self, const void *pElem, adt_vlt_func_t *vlt, bool upper)
+{
+   if ( (self != 0) && (vlt != 0) )
+   {
+      int32_t s32Low = 0;
+      int32_t s32High = self->s32CurLen;
+      while (s32Low < s32High)
+      {
+         int32_t s32Mid = s32Low + ((s32High - s32Low) >> 1);
+         //lower bound: go right while element < pElem. upper bound: go right while !(pElem < element)
+         int result = upper? vlt(pElem, self->pFirst[s32Mid]) : vlt(self->pFirst[s32Mid], pElem);
+         if (result < 0)
+         {
+            return -1;
+         }
+         if (upper)
+         {
+            result = !result;
+         }
+         if (result != 0)
+         {
+            s32Low = s32Mid + 1;
+         }
+         else
+         {
+            s32High = s32Mid;
+         }
+      }
+      return s32Low;
+   }
+   return -1;
+}
+
+/**
+ * Returns 1 if a shall be placed before b, 0 if not and -1 on error
+ */
+static int adt_ary_is_before(adt_vlt_func_t *vlt, const void *a, const void *b, bool reverse)
+{
+   return reverse? vlt(b, a) : vlt(a, b);
+}
+
+/**
+ * Stable insertion sort. The insertion position is found before any data is moved,
+ * which leaves all elements in the array in case vlt reports an error.
+ */
+static adt_error_t adt_ary_insertion_sort(void **ppData, int32_t s32Len, adt_vlt_func_t *vlt, bool reverse)
+{
+   int32_t i;
+   for (i = 1; i < s32Len; i++)
+   {
+      void *pElem = ppData[i];
+      int32_t j = i;
+      while (j > 0)
+      {
+         int result = adt_ary_is_before(vlt, pElem, ppData[j-1], reverse);
+         if (result < 0)
+         {
+            return ADT_OBJECT_COMPARE_ERROR;
+         }
+         if (result == 0)
+         {
+            break;
+         }
+         j--;
+      }
+      if (j < i)
+      {
+         memmove(&ppData[j+1], &ppData[j], ((size_t) (i - j)) * ELEM_SIZE);
+         ppData[j] = pElem;
+      }
+   }
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Merges two sorted runs into ppDest. Elements from the left run wins ties which makes the merge stable.
+ */
+static adt_error_t adt_ary_merge(void **ppDest, void **ppLeft, int32_t s32LeftLen, void **ppRight, int32_t s32RightLen, adt_vlt_func_t *vlt, bool reverse)
+{
+   while ( (s32LeftLen > 0) && (s32RightLen > 0) )
+   {
+      int result = adt_ary_is_before(vlt, *ppRight, *ppLeft, reverse);
+      if (result < 0)
+      {
+         return ADT_OBJECT_COMPARE_ERROR;
+      }
+      if (result != 0)
+      {
+         *(ppDest++) = *(ppRight++);
+         s32RightLen--;
+      }
+      else
+      {
+         *(ppDest++) = *(ppLeft++);
+         s32LeftLen--;
+      }
+   }
+   if (s32LeftLen > 0)
+   {
+      memcpy(ppDest, ppLeft, ((size_t) s32LeftLen) * ELEM_SIZE);
+   }
+   if (s32RightLen > 0)
+   {
+      memcpy(ppDest, ppRight, ((size_t) s32RightLen) * ELEM_SIZE);
+   }
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Bottom-up merge sort of ppData using ppTmp (same length) as buffer. The result is placed in ppData.
+ * In case vlt reports an error ppData still contains all elements but in unspecified order.
+ */
+static adt_error_t adt_ary_merge_sort(void **ppData, void **ppTmp, int32_t s32Len, adt_vlt_func_t *vlt, bool reverse)
+{
+   void **ppSrc = ppData;
+   void **ppDest = ppTmp;
+   int32_t s32Begin;
+   int32_t s32Width;
+   adt_error_t result = ADT_NO_ERROR;
+   for (s32Begin = 0; s32Begin < s32Len; s32Begin += SORT_RUN_LEN)
+   {
+      int32_t s32RunLen = (s32Len - s32Begin) < SORT_RUN_LEN ? (s32Len - s32Begin) : SORT_RUN_LEN;
+      result = adt_ary_insertion_sort(&ppData[s32Begin], s32RunLen, vlt, reverse);
+      if (result != ADT_NO_ERROR)
+      {
+         return result;
+      }
+   }
+   for (s32Width = SORT_RUN_LEN; s32Width < s32Len; s32Width = (s32Width > (INT32_MAX / 2))? s32Len : (s32Width * 2))
+   {
+      for (s32Begin = 0; s32Begin < s32Len; s32Begin += 2 * s32Width)
+      {
+         int32_t s32Mid = (s32Len - s32Begin) > s32Width ? (s32Begin + s32Width) : s32Len;
+         int32_t s32End = (s32Len - s32Mid) > s32Width ? (s32Mid + s32Width) : s32Len;
+         result = adt_ary_merge(&ppDest[s32Begin], &ppSrc[s32Begin], s32Mid - s32Begin, &ppSrc[s32Mid], s32End - s32Mid, vlt, reverse);
+         if (result != ADT_NO_ERROR)
+         {
+            break;
+         }
+         if (s32End == s32Len)
+         {
+            break;
+         }
+      }
+      if (result != ADT_NO_ERROR)
+      {
+         break; //ppSrc still holds all elements
+      }
+      else
+      {
+         void **ppSwap = ppSrc;
+         ppSrc = ppDest;
+         ppDest = ppSwap;
+      }
+   }
+   if (ppSrc != ppData)
+   {
+      memcpy(ppData, ppSrc, ((size_t) s32Len) * ELEM_SIZE);
+   }
+   return result;
+}
+
+/**
+ * Quickselect on ppData[0..s32Len). Hoare partitioning around the median of the first, middle and last element.
+ * After 2*log2(n) partitioning rounds the remaining range is handed to adt_ary_heap_select.
+ */
+static adt_error_t adt_ary_introselect(void **ppData, int32_t s32Len, int32_t s32Index, adt_vlt_func_t *vlt, bool reverse)
+{
+   int32_t s32Begin = 0;
+   int32_t s32End = s32Len;
+   int32_t s32Depth = 0;
+   int32_t s32Tmp;
+   for (s32Tmp = s32Len; s32Tmp > 1; s32Tmp >>= 1)
+   {
+      s32Depth += 2;
+   }
+   while ( (s32End - s32Begin) > SORT_RUN_LEN )
+   {
+      void **ppFirst = &ppData[s32Begin];
+      int32_t s32Mid = (s32End - s32Begin - 1) / 2;
+      int32_t i;
+      int32_t j;
+      void *pPivot;
+      void *pTmp;
+      if (s32Depth-- == 0)
+      {
+         return adt_ary_heap_select(ppFirst, s32End - s32Begin, s32Index - s32Begin, vlt, reverse);
+      }
+      //median of three, the middle position receives the median
+      for (i = 0; i < 3; i++)
+      {
+         void **ppA = (i == 1)? &ppFirst[s32Mid] : &ppFirst[0];
+         void **ppB = (i == 1)? &ppFirst[s32End - s32Begin - 1] : &ppFirst[s32Mid];
+         int result = adt_ary_is_before(vlt, *ppB, *ppA, reverse);
+         if (result < 0)
+         {
+            return ADT_OBJECT_COMPARE_ERROR;
+         }
+         if (result != 0)
+         {
+            pTmp = *ppA;
+            *ppA = *ppB;
+            *ppB = pTmp;
+         }
+      }
+      pPivot = ppFirst[s32Mid];
+      i = -1;
+      j = s32End - s32Begin;
+      for (;;)
+      {
+         int result;
+         do
+         {
+            result = adt_ary_is_before(vlt, ppFirst[++i], pPivot, reverse);
+         } while (result > 0);
+         if (result < 0)
+         {
+            return ADT_OBJECT_COMPARE_ERROR;
+         }
+         do
+         {
+            result = adt_ary_is_before(vlt, pPivot, ppFirst[--j], reverse);
+         } while (result > 0);
+         if (result < 0)
+         {
+            return ADT_OBJECT_COMPARE_ERROR;
+         }
+         if (i >= j)
+         {
+            break;
+         }
+         pTmp = ppFirst[i];
+         ppFirst[i] = ppFirst[j];
+         ppFirst[j] = pTmp;
+      }
+      //ppFirst[0..j] are not ordered after the pivot, ppFirst[j+1..] are not ordered before it
+      if (s32Index <= (s32Begin + j))
+      {
+         s32End = s32Begin + j + 1;
+      }
+      else
+      {
+         s32Begin += j + 1;
+      }
+   }
+   return adt_ary_insertion_sort(&ppData[s32Begin], s32End - s32Begin, vlt, reverse);
+}
+
+/**
+ * Selection with a heap of s32Index+1 elements whose root is the element ordered last. Every remaining element that
+ * is ordered before the root replaces it. The root is then the wanted element and is swapped into place.
+ */
+static adt_error_t adt_ary_heap_select(void **ppData, int32_t s32Len, int32_t s32Index, adt_vlt_func_t *vlt, bool reverse)
+{
+   int32_t s32HeapLen = s32Index + 1;
+   int32_t i;
+   void *pTmp;
+   adt_error_t result;
+   for (i = (s32HeapLen / 2) - 1; i >= 0; i--)
+   {
+      result = adt_ary_sift_down(ppData, s32HeapLen, i, vlt, reverse);
+      if (result != ADT_NO_ERROR)
+      {
+         return result;
+      }
+   }
+   for (i = s32HeapLen; i < s32Len; i++)
+   {
+      int isBefore = adt_ary_is_before(vlt, ppData[i], ppData[0], reverse);
+      if (isBefore < 0)
+      {
+         return ADT_OBJECT_COMPARE_ERROR;
+      }
+      if (isBefore != 0)
+      {
+         pTmp = ppData[0];
+         ppData[0] = ppData[i];
+         ppData[i] = pTmp;
+         result = adt_ary_sift_down(ppData, s32HeapLen, 0, vlt, reverse);
+         if (result != ADT_NO_ERROR)
+         {
+            return result;
+         }
+      }
+   }
+   pTmp = ppData[0];
+   ppData[0] = ppData[s32Index];
+   ppData[s32Index] = pTmp;
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Restores the heap property below s32Index in a heap where each parent is not ordered before its children.
+ */
+static adt_error_t adt_ary_sift_down(void **ppHeap, int32_t s32Len, int32_t s32Index, adt_vlt_func_t *vlt, bool reverse)
+{
+   void *pElem = ppHeap[s32Index];
+   int32_t s32Child;
+   while ( (s32Child = (2 * s32Index) + 1) < s32Len )
+   {
+      int result;
+      if ( (s32Child + 1) < s32Len )
+      {
+         result = adt_ary_is_before(vlt, ppHeap[s32Child], ppHeap[s32Child + 1], reverse);
+         if (result < 0)
+         {
+            ppHeap[s32Index] = pElem;
+            return ADT_OBJECT_COMPARE_ERROR;
+         }
+         s32Child += (result > 0)? 1 : 0;
+      }
+      result = adt_ary_is_before(vlt, pElem, ppHeap[s32Child], reverse);
+      if (result <= 0)
+      {
+         ppHeap[s32Index] = pElem;
+         return (result < 0)? ADT_OBJECT_COMPARE_ERROR : ADT_NO_ERROR;
+      }
+      ppHeap[s32Index] = ppHeap[s32Child];
+      s32Index = s32Child;
+   }
+   ppHeap[s32Index] = pElem;
+   return ADT_NO_ERROR;
+}
+
+#if (ADT_THREADS_ENABLE)
+/**
+ * Finds how many elements from the left run are among the first s32Rank elements of the stable merge of both runs.
+ */
+static adt_error_t adt_ary_corank(int32_t s32Rank, void **ppLeft, int32_t s32LeftLen, void **ppRight, int32_t s32RightLen, adt_vlt_func_t *vlt, bool reverse, int32_t *ps32LeftCount)
+{
+   int32_t s32Low = (s32Rank > s32RightLen)? (s32Rank - s32RightLen) : 0;
+   int32_t s32High = (s32Rank < s32LeftLen)? s32Rank : s32LeftLen;
+   while (s32Low < s32High)
+   {
+      int32_t i = s32Low + ((s32High - s32Low) >> 1);
+      int32_t j = s32Rank - i;
+      //left[i] is taken after right[j-1] only if right[j-1] is placed before left[i]
+      int result = adt_ary_is_before(vlt, ppRight[j-1], ppLeft[i], reverse);
+      if (result < 0)
+      {
+         return ADT_OBJECT_COMPARE_ERROR;
+      }
+      if (result != 0)
+      {
+         s32High = i;
+      }
+      else
+      {
+         s32Low = i + 1;
+      }
+   }
+   *ps32LeftCount = s32Low;
+   return ADT_NO_ERROR;
+}
+
+static void* adt_ary_sort_worker(void *arg)
+{
+   adt_ary_sort_worker_t *pWorker = (adt_ary_sort_worker_t*) arg;
+   int32_t s32Index;
+   for (s32Index = pWorker->s32FirstTask; s32Index < pWorker->s32NumTasks; s32Index += pWorker->s32Stride)
+   {
+      adt_ary_sort_task_t *pTask = &pWorker->pTasks[s32Index];
+      if (pTask->isSort)
+      {
+         pTask->result = adt_ary_merge_sort(pTask->ppLeft, pTask->ppRight, pTask->s32LeftLen, pWorker->vlt, pWorker->reverse);
+      }
+      else
+      {
+         int32_t s32LeftBegin, s32LeftEnd;
+         pTask->result = adt_ary_corank(pTask->s32Begin, pTask->ppLeft, pTask->s32LeftLen, pTask->ppRight, pTask->s32RightLen, pWorker->vlt, pWorker->reverse, &s32LeftBegin);
+         if (pTask->result == ADT_NO_ERROR)
+         {
+            pTask->result = adt_ary_corank(pTask->s32End, pTask->ppLeft, pTask->s32LeftLen, pTask->ppRight, pTask->s32RightLen, pWorker->vlt, pWorker->reverse, &s32LeftEnd);
+         }
+         if (pTask->result == ADT_NO_ERROR)
+         {
+            int32_t s32RightBegin = pTask->s32Begin - s32LeftBegin;
+            int32_t s32RightEnd = pTask->s32End - s32LeftEnd;
+            pTask->result = adt_ary_merge(&pTask->ppDest[pTask->s32Begin], &pTask->ppLeft[s32LeftBegin], s32LeftEnd - s32LeftBegin,
+                  &pTask->ppRight[s32RightBegin], s32RightEnd - s32RightBegin, pWorker->vlt, pWorker->reverse);
+         }
+      }
+   }
+   return (void*) 0;
+}
+
+/**
+ * Runs tasks on s32NumThreads threads (the calling thread being one of them).
+ * Should a thread fail to start, its tasks are executed by the calling thread instead.
+ */
+static adt_error_t adt_ary_sort_run_tasks(adt_ary_sort_task_t *pTasks, int32_t s32NumTasks, int32_t s32NumThreads, adt_vlt_func_t *vlt, bool reverse)
+{
+   pthread_t threads[PARALLEL_SORT_MAX_THREADS];
+   bool isStarted[PARALLEL_SORT_MAX_THREADS];
+   adt_ary_sort_worker_t workers[PARALLEL_SORT_MAX_THREADS];
+   int32_t i;
+   if (s32NumThreads > s32NumTasks)
+   {
+      s32NumThreads = s32NumTasks;
+   }
+   for (i = 0; i < s32NumThreads; i++)
+   {
+      workers[i].pTasks = pTasks;
+      workers[i].s32NumTasks = s32NumTasks;
+      workers[i].s32FirstTask = i;
+      workers[i].s32Stride = s32NumThreads;
+      workers[i].vlt = vlt;
+      workers[i].reverse = reverse;
+      isStarted[i] = false;
+      if (i > 0)
+      {
+         isStarted[i] = (pthread_create(&threads[i], (const pthread_attr_t*) 0, adt_ary_sort_worker, &workers[i]) == 0);
+      }
+   }
+   (void) adt_ary_sort_worker(&workers[0]);
+   for (i = 1; i < s32NumThreads; i++)
+   {
+      if (isStarted[i])
+      {
+         pthread_join(threads[i], (void**) 0);
+      }
+      else
+      {
+         (void) adt_ary_sort_worker(&workers[i]);
+      }
+   }
+   for (i = 0; i < s32NumTasks; i++)
+   {
+      if (pTasks[i].result != ADT_NO_ERROR)
+      {
+         return pTasks[i].result;
+      }
+   }
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Parallel merge sort. The array is split into one chunk per thread, each chunk is sorted using
+ * adt_ary_merge_sort and the sorted chunks are then merged pairwise. Each pairwise merge is split into
+ * independent parts (using co-ranking) so that all threads stay busy until the final merge.
+ */
+static adt_error_t adt_ary_parallel_merge_sort(void **ppData, void **ppTmp, int32_t s32Len, int32_t s32NumThreads, adt_vlt_func_t *vlt, bool reverse)
+{
+   adt_ary_sort_task_t *pTasks;
+   int32_t *ps32RunBegin;
+   int32_t s32NumRuns = s32NumThreads;
+   void **ppSrc = ppData;
+   void **ppDest = ppTmp;
+   adt_error_t result;
+   int32_t i;
+
+   pTasks = (adt_ary_sort_task_t*) malloc(sizeof(adt_ary_sort_task_t) * ((size_t) s32NumThreads) * 2u);
+   ps32RunBegin = (int32_t*) malloc(sizeof(int32_t) * ((size_t) s32NumRuns + 1u));
+   if ( (pTasks == 0) || (ps32RunBegin == 0) )
+   {
+      if (pTasks != 0) free(pTasks);
+      if (ps32RunBegin != 0) free(ps32RunBegin);
+      return ADT_MEM_ERROR;
+   }
+   //phase 1: sort one chunk per thread
+   for (i = 0; i <= s32NumRuns; i++)
+   {
+      ps32RunBegin[i] = (int32_t) (((int64_t) s32Len * i) / s32NumRuns);
+   }
+   for (i = 0; i < s32NumRuns; i++)
+   {
+      adt_ary_sort_task_t *pTask = &pTasks[i];
+      pTask->isSort = true;
+      pTask->ppLeft = &ppData[ps32RunBegin[i]];
+      pTask->ppRight = &ppTmp[ps32RunBegin[i]];
+      pTask->s32LeftLen = ps32RunBegin[i+1] - ps32RunBegin[i];
+      pTask->result = ADT_NO_ERROR;
+   }
+   result = adt_ary_sort_run_tasks(pTasks, s32NumRuns, s32NumThreads, vlt, reverse);
+
+   //phase 2: merge runs pairwise until one run remains
+   while ( (result == ADT_NO_ERROR) && (s32NumRuns > 1) )
+   {
+      int32_t s32NumPairs = s32NumRuns / 2;
+      int32_t s32PartsPerPair = s32NumThreads / s32NumPairs;
+      int32_t s32NumTasks = 0;
+      int32_t s32Pair;
+      if (s32PartsPerPair < 1)
+      {
+         s32PartsPerPair = 1;
+      }
+      for (s32Pair = 0; s32Pair < ((s32NumRuns + 1) / 2); s32Pair++)
+      {
+         int32_t s32Begin = ps32RunBegin[2 * s32Pair];
+         int32_t s32Mid = ps32RunBegin[(2 * s32Pair) + 1];
+         int32_t s32End = ((2 * s32Pair) + 2 <= s32NumRuns)? ps32RunBegin[(2 * s32Pair) + 2] : s32Mid;
+         int32_t s32MergeLen = s32End - s32Begin;
+         int32_t s32Parts = s32PartsPerPair;
+         int32_t s32Part;
+         if ( (s32MergeLen / s32Parts) < PARALLEL_MERGE_MIN_LEN )
+         {
+            s32Parts = (s32MergeLen / PARALLEL_MERGE_MIN_LEN) > 0 ? (s32MergeLen / PARALLEL_MERGE_MIN_LEN) : 1;
+         }
+         for (s32Part = 0; s32Part < s32Parts; s32Part++)
+         {
+            adt_ary_sort_task_t *pTask = &pTasks[s32NumTasks++];
+            pTask->isSort = false;
+            pTask->ppDest = &ppDest[s32Begin];
+            pTask->ppLeft = &ppSrc[s32Begin];
+            pTask->s32LeftLen = s32Mid - s32Begin;
+            pTask->ppRight = &ppSrc[s32Mid];
+            pTask->s32RightLen = s32End - s32Mid;
+            pTask->s32Begin = (int32_t) (((int64_t) s32MergeLen * s32Part) / s32Parts);
+            pTask->s32End = (int32_t) (((int64_t) s32MergeLen * (s32Part + 1)) / s32Parts);
+            pTask->result = ADT_NO_ERROR;
+         }
+      }
+      result = adt_ary_sort_run_tasks(pTasks, s32NumTasks, s32NumThreads, vlt, reverse);
+      if (result == ADT_NO_ERROR)
+      {
+         void **ppSwap = ppSrc;
+         int32_t s32NewNumRuns = (s32NumRuns + 1) / 2;
+         for (i = 0; i < s32NewNumRuns; i++)
+         {
+            ps32RunBegin[i] = ps32RunBegin[2 * i];
+         }
+         ps32RunBegin[s32NewNumRuns] = s32Len;
+         s32NumRuns = s32NewNumRuns;
+         ppSrc = ppDest;
+         ppDest = ppSwap;
+      }
+   }
+   if (ppSrc != ppData)
+   {
+      memcpy(ppData, ppSrc, ((size_t) s32Len) * ELEM_SIZE);
+   }
+   free(pTasks);
+   free(ps32RunBegin);
+   return result;
+}
+#endif
+
+/**
+ * Returns index of the first occurrence of pElem in ppData or -1 if not found.
+ * Uses the widest SIMD kernel supported by the CPU (AVX2 is detected at runtime).
+ */
+static int32_t adt_ary_find(void * const *ppData, int32_t s32Len, const void *pElem)
+{
+   adt_ary_find_func_t *pKernel;
+   if (s32Len < SIMD_FIND_MIN_LEN)
+   {
+      return adt_ary_find_scalar(ppData, s32Len, pElem);
+   }
+#if (ADT_THREADS_ENABLE)
+   (void) pthread_once(&m_findKernelOnce, adt_ary_find_init);
+   pKernel = m_pFindKernel;
+#else
+   pKernel = adt_ary_find_select(); //nothing to synchronize a cached selection with, the CPU check is cheap
+#endif
+   return pKernel(ppData, s32Len, pElem);
+}
+
+#if (ADT_THREADS_ENABLE)
+static void adt_ary_find_init(void)
+{
+   m_pFindKernel = adt_ary_find_select();
+}
+#endif
+
+/**
+ * Selects the fastest search kernel supported by the CPU
+ */
+static adt_ary_find_func_t* adt_ary_find_select(void)
+{
+#if defined(ADT_ARY_SIMD_AVX2)
+   __builtin_cpu_init();
+   if (__builtin_cpu_supports("avx2"))
+   {
+      return adt_ary_find_avx2;
+   }
+#endif
+#if defined(ADT_ARY_SIMD_SSE2)
+   return adt_ary_find_sse2;
+#elif defined(ADT_ARY_SIMD_NEON)
+   return adt_ary_find_neon;
+#else
+   return adt_ary_find_scalar;
+#endif
+}
+
+static int32_t adt_ary_find_scalar(void * const *ppData, int32_t s32Len, const void *pElem)
+{
+   int32_t s32Index;
+   for (s32Index = 0; s32Index < s32Len; s32Index++)
+   {
+      if (ppData[s32Index] == pElem)
+      {
+         return s32Index;
+      }
+   }
+   return -1;
+}
+
+#if defined(ADT_ARY_SIMD_SSE2)
+/**
+ * Compares 4 pointers per iteration. SSE2 has no 64-bit compare so a match requires both 32-bit halves to be equal.
+ */
+static int32_t adt_ary_find_sse2(void * const *ppData, int32_t s32Len, const void *pElem)
+{
+   int32_t i = 0;
+   const __m128i key = _mm_set1_epi64x((long long) (uintptr_t) pElem);
+   while ( (i < s32Len) && ( (((uintptr_t) &ppData[i]) & 15u) != 0u) )
+   {
+      if (ppData[i] == pElem)
+      {
+         return i;
+      }
+      i++;
+   }
+   for (; (i + 4) <= s32Len; i += 4)
+   {
+      int maskA = _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_load_si128((const __m128i*) &ppData[i]), key));
+      int maskB = _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_load_si128((const __m128i*) &ppData[i + 2]), key));
+      if ( (maskA | maskB) != 0)
+      {
+         if ( (maskA & 0x00FF) == 0x00FF) return i;
+         if ( (maskA & 0xFF00) == 0xFF00) return i + 1;
+         if ( (maskB & 0x00FF) == 0x00FF) return i + 2;
+         if ( (maskB & 0xFF00) == 0xFF00) return i + 3;
+      }
+   }
+   for (; i < s32Len; i++)
+   {
+      if (ppData[i] == pElem)
+      {
+         return i;
+      }
+   }
+   return -1;
+}
+#endif
+
+#if defined(ADT_ARY_SIMD_AVX2)
+/**
+ * Compares 8 pointers per iteration using two 256-bit compares.
+ */
+__attribute__((target("avx2")))
+static int32_t adt_ary_find_avx2(void * const *ppData, int32_t s32Len, const void *pElem)
+{
+   int32_t i = 0;
+   const __m256i key = _mm256_set1_epi64x((long long) (uintptr_t) pElem);
+   while ( (i < s32Len) && ( (((uintptr_t) &ppData[i]) & 31u) != 0u) )
+   {
+      if (ppData[i] == pElem)
+      {
+         return i;
+      }
+      i++;
+   }
+   for (; (i + 8) <= s32Len; i += 8)
+   {
+      __m256i cmpA = _mm256_cmpeq_epi64(_mm256_load_si256((const __m256i*) &ppData[i]), key);
+      __m256i cmpB = _mm256_cmpeq_epi64(_mm256_load_si256((const __m256i*) &ppData[i + 4]), key);
+      if (!_mm256_testz_si256(_mm256_or_si256(cmpA, cmpB), _mm256_or_si256(cmpA, cmpB)))
+      {
+         int maskA = _mm256_movemask_pd(_mm256_castsi256_pd(cmpA));
+         int maskB = _mm256_movemask_pd(_mm256_castsi256_pd(cmpB));
+         if (maskA != 0)
+         {
+            return i + __builtin_ctz((unsigned int) maskA);
+         }
+         return i + 4 + __builtin_ctz((unsigned int) maskB);
+      }
+   }
+   for (; i < s32Len; i++)
+   {
+      if (ppData[i] == pElem)
+      {
+         return i;
+      }
+   }
+   return -1;
+}
+#endif
+
+#if defined(ADT_ARY_SIMD_NEON)
+/**
+ * Compares 4 pointers per iteration using two 128-bit compares.
+ */
+static int32_t adt_ary_find_neon(void * const *ppData, int32_t s32Len, const void *pElem)
+{
+   int32_t i = 0;
+   const uint64x2_t key = vdupq_n_u64((uint64_t) (uintptr_t) pElem);
+   for (; (i + 4) <= s32Len; i += 4)
+   {
+      uint64x2_t cmpA = vceqq_u64(vld1q_u64((const uint64_t*) &ppData[i]), key);
+      uint64x2_t cmpB = vceqq_u64(vld1q_u64((const uint64_t*) &ppData[i + 2]), key);
+      if (vmaxvq_u32(vreinterpretq_u32_u64(vorrq_u64(cmpA, cmpB))) != 0u)
+      {
+         if (vgetq_lane_u64(cmpA, 0) != 0u) return i;
+         if (vgetq_lane_u64(cmpA, 1) != 0u) return i + 1;
+         if (vgetq_lane_u64(cmpB, 0) != 0u) return i + 2;
+         return i + 3;
+      }
+   }
+   for (; i < s32Len; i++)
+   {
+      if (ppData[i] == pElem)
+      {
+         return i;
+      }
+   }
+   return -1;
+}
+#endif
@@ -5,6 +5,7 @@
 #include <stdbool.h>
 #include <assert.h>
 #include <malloc.h>
+#include <string.h>
 #ifdef MEM_LEAK_CHECK
 # include "CMemLeak.h"
 #endif
@@ -13,10 +14,30 @@
 //////////////////////////////////////////////////////////////////////////////
 // CONSTANTS AND DATA TYPES
 //////////////////////////////////////////////////////////////////////////////
+#define ADT_HEAP_ELEM_VALUE(elem) ((((uint64_t) (elem)->u32ValueHigh) << 32) | (elem)->u32Value)
+
 
 //////////////////////////////////////////////////////////////////////////////
 // LOCAL FUNCTION PROTOTYPES
 //////////////////////////////////////////////////////////////////////////////
+static void adt_heap_sift_down(void **ppData, int32_t s32Len, int32_t parentIndex, adt_heap_family heapFamily);
+static bool adt_pq_is_before(const adt_pq_t *self, uint64_t a, uint64_t b);
+static void adt_pq_sift_up(adt_pq_t *self, int32_t s32Index, const adt_pq_elem_t *pElem);
+static void adt_pq_sift_down(adt_pq_t *self, int32_t s32Index, const adt_pq_elem_t *pElem);
+static void adt_pq_pop_hole(adt_pq_t *self);
+static int32_t adt_pq_best_child(const adt_pq_t *self, int32_t s32First);
+static bool adt_iheap_is_before(const adt_iheap_t *self, uint64_t a, uint64_t b);
+static int32_t adt_iheap_position(const adt_iheap_t *self, adt_heap_handle_t handle);
+static void adt_iheap_sift_up(adt_iheap_t *self, int32_t s32Index, adt_iheap_node_t node);
+static void adt_iheap_sift_down(adt_iheap_t *self, int32_t s32Index, adt_iheap_node_t node);
+static void adt_iheap_place(adt_iheap_t *self, int32_t s32Index, adt_iheap_node_t node);
+static int adt_heap_topk_is_before(const adt_heap_topk_t *self, const void *a, const void *b);
+static adt_error_t adt_heap_topk_sift_up(adt_heap_topk_t *self, int32_t s32Index);
+static adt_error_t adt_heap_topk_sift_down(adt_heap_topk_t *self, int32_t s32Index);
+static bool adt_mmheap_is_max_level(int32_t s32Index);
+static int32_t adt_mmheap_max_index(const adt_mmheap_t *self);
+static void adt_mmheap_bubble_up(adt_mmheap_t *self, int32_t s32Index, adt_pq_elem_t elem, bool isMax);
+static void adt_mmheap_trickle_down(adt_mmheap_t *self, int32_t s32Index, adt_pq_elem_t elem, bool isMax);
 
 
 //////////////////////////////////////////////////////////////////////////////
@@ -55,6 +76,7 @@ void adt_heap_elem_create(adt_heap_elem_t *self, void *pItem, uint32_t u32Value)
    if (self != 0){
       self->pItem = pItem;
       self->u32Value = u32Value;
+      self->u32ValueHigh = 0u;
    }
 }
 
@@ -63,146 +85,1108 @@ void adt_heap_elem_destroy(adt_heap_elem_t *self){
    //nothing to do (self->pItem is a weak reference)
 }
 
+adt_heap_elem_t* adt_heap_elem_new_u64(void *pItem, uint64_t u64Value){
+   adt_heap_elem_t *self;
+   self = (adt_heap_elem_t*) malloc(sizeof(adt_heap_elem_t));
+   if ( self != (adt_heap_elem_t*) 0 ){
+      adt_heap_elem_create_u64(self, pItem, u64Value);
+   }
+   return self;
+}
+
+void adt_heap_elem_create_u64(adt_heap_elem_t *self, void *pItem, uint64_t u64Value){
+   if (self != 0){
+      self->pItem = pItem;
+      self->u32Value = (uint32_t) u64Value;
+      self->u32ValueHigh = (uint32_t) (u64Value >> 32);
+   }
+}
+
+/**
+ * Returns the 64-bit priority used when comparing heap elements
+ */
+uint64_t adt_heap_elem_value(const adt_heap_elem_t *self){
+   if (self != 0){
+      return ADT_HEAP_ELEM_VALUE(self);
+   }
+   return 0u;
+}
+
 
 /**
  * resorts the heap starting at startIndex. It propagates upwards (bubble up) toward the root of the tree.
  */
 void adt_heap_sortUp(adt_ary_t *heap, int32_t childIndex, adt_heap_family heapFamily){
-   if ( (heap != 0) && (childIndex>0) ){
-      bool swapItems = false;
-      void **ppChild, **ppParent;
-      adt_heap_elem_t *pChildElem, *pParentElem;
-      //parent index is at floor((childIndex-1)/2)
-      int32_t parentIndex = (childIndex-1)>>1;
-
-      ppChild = adt_ary_get(heap, childIndex);
-      ppParent = adt_ary_get(heap, parentIndex);
-      assert ( (ppChild != 0) && (ppParent != 0) );
-      pChildElem = *ppChild;
-      pParentElem = *ppParent;
-      if (heapFamily == ADT_MIN_HEAP){
-         if (pChildElem->u32Value < pParentElem->u32Value){
-            swapItems = true;
+   if ( (heap != 0) && (childIndex>0) && (childIndex < adt_ary_length(heap)) ){
+      void **ppData = heap->pFirst;
+      void *pChild = ppData[childIndex];
+      uint64_t childValue = ADT_HEAP_ELEM_VALUE((adt_heap_elem_t*) pChild);
+      //move parents down into the hole until the position of the child is found
+      while (childIndex > 0){
+         //parent index is at floor((childIndex-1)/2)
+         int32_t parentIndex = (childIndex-1)>>1;
+         uint64_t parentValue = ADT_HEAP_ELEM_VALUE((adt_heap_elem_t*) ppData[parentIndex]);
+         bool isBefore = (heapFamily == ADT_MIN_HEAP)? (childValue < parentValue) : (childValue > parentValue);
+         if (isBefore == false){
+            break;
          }
+         ppData[childIndex] = ppData[parentIndex];
+         childIndex = parentIndex;
       }
-      else {
-         //implicit ADT_MAX_HEAP
-         if (pChildElem->u32Value > pParentElem->u32Value){
-            swapItems = true;
-         }
+      ppData[childIndex] = pChild;
+   }
+}
+
+
+/**
+ * resorts the list starting at startIndex. It propagates downwards toward the leaf elements of the tree.
+ */
+void adt_heap_sortDown(adt_ary_t *heap, int32_t parentIndex, adt_heap_family heapFamily){
+   if ( (heap != 0) && (parentIndex>=0) && (parentIndex < adt_ary_length(heap)) ){
+      adt_heap_sift_down(heap->pFirst, heap->s32CurLen, parentIndex, heapFamily);
+   }
+}
+
+/**
+ * Turns an array of adt_heap_elem_t into a heap in O(n) using bottom-up heap construction (Floyd),
+ * which is faster than calling adt_heap_sortUp for each element (O(n log n)).
+ */
+void adt_heap_build(adt_ary_t *heap, adt_heap_family heapFamily){
+   if (heap != 0){
+      int32_t parentIndex;
+      //the last parent is the parent of the last element, leaves are already heaps
+      for (parentIndex = (heap->s32CurLen>>1) - 1; parentIndex >= 0; parentIndex--){
+         adt_heap_sift_down(heap->pFirst, heap->s32CurLen, parentIndex, heapFamily);
       }
-      if (swapItems == true){
-         //swap parent and child
-         void *tmp;
-         tmp = *ppChild;
-         *ppChild = *ppParent;
-         *ppParent = tmp;
+   }
+}
 
-         //call recursively on parent (bubble up)
-         if (parentIndex > 0) {
-            adt_heap_sortUp(heap, parentIndex, heapFamily);
-         }
+/**
+ * Moves all elements of the heap src into the heap dst, leaving src empty. Element ownership moves with the elements,
+ * the destructor of src is not called.
+ * A few elements are inserted one by one, otherwise dst is rebuilt in O(n) using adt_heap_build.
+ */
+adt_error_t adt_heap_merge(adt_ary_t *dst, adt_ary_t *src, adt_heap_family heapFamily){
+   int32_t s32DstLen;
+   int32_t s32SrcLen;
+   int32_t s32TotalLen;
+   int32_t s32Log2;
+   adt_error_t result;
+   bool destructorEnable;
+   if ( (dst == 0) || (src == 0) || (dst == src) ){
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   s32DstLen = dst->s32CurLen;
+   s32SrcLen = src->s32CurLen;
+   if (s32SrcLen == 0){
+      return ADT_NO_ERROR;
+   }
+   if (s32SrcLen > (INT32_MAX - s32DstLen)){
+      return ADT_LENGTH_ERROR;
+   }
+   s32TotalLen = s32DstLen + s32SrcLen;
+   result = adt_ary_extend(dst, s32TotalLen);
+   if (result != ADT_NO_ERROR){
+      return result;
+   }
+   memcpy(&dst->pFirst[s32DstLen], src->pFirst, sizeof(void*) * (size_t) s32SrcLen);
+   destructorEnable = src->destructorEnable;
+   adt_ary_destructor_enable(src, false);
+   adt_ary_clear(src);
+   adt_ary_destructor_enable(src, destructorEnable);
+   //inserting k elements costs about k*log2(n) steps, rebuilding costs about 2n steps
+   for (s32Log2 = 0; (s32TotalLen >> s32Log2) > 1; s32Log2++){}
+   if ( ((int64_t) s32SrcLen * s32Log2) < ((int64_t) s32TotalLen * 2) ){
+      int32_t i;
+      for (i = s32DstLen; i < s32TotalLen; i++){
+         adt_heap_sortUp(dst, i, heapFamily);
+      }
+   }
+   else{
+      adt_heap_build(dst, heapFamily);
+   }
+   return ADT_NO_ERROR;
+}
+
+/**
+ * In-place heap sort of an array of adt_heap_elem_t (no additional memory). Elements are sorted in the order they
+ * would be removed from a heap of the given family: ascending for ADT_MIN_HEAP and descending for ADT_MAX_HEAP.
+ * The sorted array is also a valid heap of the same family. The sort is not stable.
+ */
+void adt_heap_sort(adt_ary_t *heap, adt_heap_family heapFamily){
+   if (heap != 0){
+      //a max-heap moves the highest element to the end of the array in each step, giving ascending order
+      adt_heap_family buildFamily = (heapFamily == ADT_MIN_HEAP)? ADT_MAX_HEAP : ADT_MIN_HEAP;
+      void **ppData = heap->pFirst;
+      int32_t s32Len;
+      adt_heap_build(heap, buildFamily);
+      for (s32Len = heap->s32CurLen - 1; s32Len > 0; s32Len--){
+         void *pTop = ppData[0];
+         ppData[0] = ppData[s32Len];
+         ppData[s32Len] = pTop;
+         adt_heap_sift_down(ppData, s32Len, 0, buildFamily);
       }
    }
 }
 
+/************************* priority queue ***************************/
+
+void adt_pq_create(adt_pq_t *self, adt_heap_family family)
+{
+   (void) adt_pq_create_arity(self, family, 2);
+}
 
 /**
- * resorts the list starting at startIndex. It propagates downwards toward the leaf elements of the tree.
+ * Creates a d-ary heap where s32Arity (2, 4 or 8) is the number of children per node
  */
-void adt_heap_sortDown(adt_ary_t *heap, int32_t parentIndex, adt_heap_family heapFamily){
-   if ( (heap != 0) && (parentIndex>=0) ){
-      int32_t curLen = adt_ary_length(heap);
-      if (parentIndex < curLen ){
-         bool swapLeft = false, swapRight = false;
-         void **ppLeft = 0, **ppRight = 0, **ppParent;
-         adt_heap_elem_t *pParentElem;
-         int32_t leftChildIndex, rightChildIndex;
-         uint32_t leftChildValue = 0;
-
-         ppParent = adt_ary_get(heap, parentIndex);
-         assert(ppParent != 0);
-         pParentElem = *ppParent;
-         //children indices at 2i+1, 2i+2
-         leftChildIndex = (parentIndex<<1) + 1;
-         rightChildIndex = leftChildIndex + 1;
-         if(leftChildIndex < curLen){
-            adt_heap_elem_t *pLeftElem;
-            ppLeft = adt_ary_get(heap, leftChildIndex);
-            assert(ppLeft != 0);
-            pLeftElem = *ppLeft;
-            leftChildValue = pLeftElem->u32Value;
-            if (heapFamily == ADT_MIN_HEAP){
-               if (leftChildValue < pParentElem->u32Value){
-                  swapLeft = true;
-               }
-            }
-            else {
-               //implicit ADT_MAX_HEAP
-               if (leftChildValue > pParentElem->u32Value){
-                  swapLeft = true;
-               }
-            }
-         }
-         if( rightChildIndex < curLen ){
-            adt_heap_elem_t *pRightElem;
-            ppRight = adt_ary_get(heap, rightChildIndex);
-            assert(ppRight != 0);
-            pRightElem = *ppRight;
-            if (heapFamily == ADT_MIN_HEAP){
-               if (pRightElem->u32Value < pParentElem->u32Value){
-                  swapRight = true;
-               }
-            }
-            else {
-               //implicit ADT_MAX_HEAP
-               if (pRightElem->u32Value > pParentElem->u32Value){
-                  swapRight = true;
-               }
-            }
-            if ( (swapLeft == true) && (swapRight == true) ){
-               //compare which of the two children has the lowest priority
-               if (heapFamily == ADT_MIN_HEAP){
-                  if (pRightElem->u32Value < leftChildValue){
-                     swapLeft = false;
-                  }
-               }
-               else {
-                  //implicit ADT_MAX_HEAP
-                  if (pRightElem->u32Value > leftChildValue){
-                     swapLeft = false;
-                  }
-               }
-            }
+adt_error_t adt_pq_create_arity(adt_pq_t *self, adt_heap_family family, int32_t s32Arity)
+{
+   if (self == 0)
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   switch (s32Arity)
+   {
+   case 2: self->u32ArityShift = 1u; break;
+   case 4: self->u32ArityShift = 2u; break;
+   case 8: self->u32ArityShift = 3u; break;
+   default: return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   self->pElems = (adt_pq_elem_t*) 0;
+   self->pAlloc = (void*) 0;
+   self->s32CurLen = 0;
+   self->s32AllocLen = 0;
+   self->family = family;
+   return ADT_NO_ERROR;
+}
+
+void adt_pq_destroy(adt_pq_t *self)
+{
+   if (self != 0)
+   {
+      if (self->pAlloc != 0)
+      {
+         free(self->pAlloc);
+      }
+      self->pElems = (adt_pq_elem_t*) 0;
+      self->pAlloc = (void*) 0;
+      self->s32CurLen = 0;
+      self->s32AllocLen = 0;
+   }
+}
+
+adt_pq_t* adt_pq_new(adt_heap_family family)
+{
+   return adt_pq_new_arity(family, 2);
+}
+
+adt_pq_t* adt_pq_new_arity(adt_heap_family family, int32_t s32Arity)
+{
+   adt_pq_t *self = (adt_pq_t*) malloc(sizeof(adt_pq_t));
+   if (self != 0)
+   {
+      if (adt_pq_create_arity(self, family, s32Arity) != ADT_NO_ERROR)
+      {
+         free(self);
+         self = (adt_pq_t*) 0;
+      }
+   }
+   return self;
+}
+
+void adt_pq_delete(adt_pq_t *self)
+{
+   if (self != 0)
+   {
+      adt_pq_destroy(self);
+      free(self);
+   }
+}
+
+void adt_pq_vdelete(void *arg)
+{
+   adt_pq_delete((adt_pq_t*) arg);
+}
+
+/**
+ * Makes sure there is room for at least s32Len elements without reallocation
+ */
+adt_error_t adt_pq_reserve(adt_pq_t *self, int32_t s32Len)
+{
+   if ( (self == 0) || (s32Len < 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (s32Len > self->s32AllocLen)
+   {
+      //children of element i start at (i << shift) + 1. Placing element 0 at (arity - 1) in cache line aligned storage
+      //puts the first child of every node at a multiple of arity.
+      size_t padLen = ((size_t) 1u << self->u32ArityShift) - 1u;
+      size_t allocSize = (sizeof(adt_pq_elem_t) * ((size_t) s32Len + padLen)) + ADT_PQ_CACHE_LINE_SIZE - 1u;
+      adt_pq_elem_t *pElems;
+      void *pAlloc = malloc(allocSize);
+      if (pAlloc == 0)
+      {
+         return ADT_MEM_ERROR;
+      }
+      pElems = (adt_pq_elem_t*) ((((uintptr_t) pAlloc) + ADT_PQ_CACHE_LINE_SIZE - 1u) & ~((uintptr_t) ADT_PQ_CACHE_LINE_SIZE - 1u));
+      pElems += padLen;
+      if (self->pAlloc != 0)
+      {
+         memcpy(pElems, self->pElems, sizeof(adt_pq_elem_t) * (size_t) self->s32CurLen);
+         free(self->pAlloc);
+      }
+      self->pAlloc = pAlloc;
+      self->pElems = pElems;
+      self->s32AllocLen = s32Len;
+   }
+   return ADT_NO_ERROR;
+}
+
+adt_error_t adt_pq_push(adt_pq_t *self, void *pItem, uint64_t u64Priority)
+{
+   adt_pq_elem_t elem;
+   if (self == 0)
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (self->s32CurLen == self->s32AllocLen)
+   {
+      int32_t s32NewLen;
+      adt_error_t result;
+      if (self->s32AllocLen == INT32_MAX)
+      {
+         return ADT_LENGTH_ERROR;
+      }
+      s32NewLen = (self->s32AllocLen < ADT_PQ_MIN_ALLOC_LEN)? ADT_PQ_MIN_ALLOC_LEN :
+            (self->s32AllocLen > (INT32_MAX / 2))? INT32_MAX : (self->s32AllocLen * 2);
+      result = adt_pq_reserve(self, s32NewLen);
+      if (result != ADT_NO_ERROR)
+      {
+         return result;
+      }
+   }
+   elem.pItem = pItem;
+   elem.u64Priority = u64Priority;
+   adt_pq_sift_up(self, self->s32CurLen++, &elem);
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Removes the top element. When pElem is not NULL the removed element is copied into it.
+ */
+adt_error_t adt_pq_pop(adt_pq_t *self, adt_pq_elem_t *pElem)
+{
+   if (self == 0)
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (self->s32CurLen == 0)
+   {
+      return ADT_LENGTH_ERROR;
+   }
+   if (pElem != 0)
+   {
+      *pElem = self->pElems[0];
+   }
+   if (--self->s32CurLen > 0)
+   {
+      adt_pq_pop_hole(self);
+   }
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Returns pointer to the top element or NULL if the queue is empty. The pointer is valid until the queue is modified.
+ */
+const adt_pq_elem_t* adt_pq_peek(const adt_pq_t *self)
+{
+   if ( (self != 0) && (self->s32CurLen > 0) )
+   {
+      return &self->pElems[0];
+   }
+   return (const adt_pq_elem_t*) 0;
+}
+
+/**
+ * Same as adt_pq_pop followed by adt_pq_push but with a single sift down. When pOld is not NULL the removed
+ * top element is copied into it.
+ */
+adt_error_t adt_pq_replace_top(adt_pq_t *self, void *pItem, uint64_t u64Priority, adt_pq_elem_t *pOld)
+{
+   adt_pq_elem_t elem;
+   if (self == 0)
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (self->s32CurLen == 0)
+   {
+      return ADT_LENGTH_ERROR;
+   }
+   if (pOld != 0)
+   {
+      *pOld = self->pElems[0];
+   }
+   elem.pItem = pItem;
+   elem.u64Priority = u64Priority;
+   adt_pq_sift_down(self, 0, &elem);
+   return ADT_NO_ERROR;
+}
+
+int32_t adt_pq_length(const adt_pq_t *self)
+{
+   if (self != 0)
+   {
+      return self->s32CurLen;
+   }
+   return 0;
+}
+
+bool adt_pq_is_empty(const adt_pq_t *self)
+{
+   return (adt_pq_length(self) == 0);
+}
+
+void adt_pq_clear(adt_pq_t *self)
+{
+   if (self != 0)
+   {
+      self->s32CurLen = 0;
+   }
+}
+
+/************************* indexed heap ***************************/
+
+void adt_iheap_create(adt_iheap_t *self, adt_heap_family family)
+{
+   if (self != 0)
+   {
+      self->pNodes = (adt_iheap_node_t*) 0;
+      self->pSlots = (adt_iheap_slot_t*) 0;
+      self->s32CurLen = 0;
+      self->s32SlotLen = 0;
+      self->s32AllocLen = 0;
+      self->firstFree = ADT_HEAP_INVALID_HANDLE;
+      self->family = family;
+   }
+}
+
+void adt_iheap_destroy(adt_iheap_t *self)
+{
+   if (self != 0)
+   {
+      if (self->pNodes != 0)
+      {
+         free(self->pNodes);
+      }
+      if (self->pSlots != 0)
+      {
+         free(self->pSlots);
+      }
+      adt_iheap_create(self, self->family);
+   }
+}
+
+adt_iheap_t* adt_iheap_new(adt_heap_family family)
+{
+   adt_iheap_t *self = (adt_iheap_t*) malloc(sizeof(adt_iheap_t));
+   if (self != 0)
+   {
+      adt_iheap_create(self, family);
+   }
+   return self;
+}
+
+void adt_iheap_delete(adt_iheap_t *self)
+{
+   if (self != 0)
+   {
+      adt_iheap_destroy(self);
+      free(self);
+   }
+}
+
+void adt_iheap_vdelete(void *arg)
+{
+   adt_iheap_delete((adt_iheap_t*) arg);
+}
+
+/**
+ * Makes sure there is room for at least s32Len elements without reallocation
+ */
+adt_error_t adt_iheap_reserve(adt_iheap_t *self, int32_t s32Len)
+{
+   if ( (self == 0) || (s32Len < 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (s32Len > self->s32AllocLen)
+   {
+      adt_iheap_node_t *pNodes = (adt_iheap_node_t*) malloc(sizeof(adt_iheap_node_t) * (size_t) s32Len);
+      adt_iheap_slot_t *pSlots = (adt_iheap_slot_t*) malloc(sizeof(adt_iheap_slot_t) * (size_t) s32Len);
+      if ( (pNodes == 0) || (pSlots == 0) )
+      {
+         if (pNodes != 0)
+         {
+            free(pNodes);
          }
-         if (swapLeft == true){
-            //swap parent and left child
-            void *tmp;
-            tmp = *ppLeft;
-            *ppLeft = *ppParent;
-            *ppParent = tmp;
-
-            //call recursively on left child (trickle down)
-            if ( ( (leftChildIndex<<1) + 1) < curLen) {
-               adt_heap_sortDown(heap, leftChildIndex, heapFamily);
-            }
+         if (pSlots != 0)
+         {
+            free(pSlots);
          }
-         else if (swapRight == true){
-            //swap parent and left child
-            void *tmp;
-            tmp = *ppRight;
-            *ppRight = *ppParent;
-            *ppParent = tmp;
-
-            //call recursively on right child (trickle down)
-            if ( ( (rightChildIndex<<1) + 1) < curLen) {
-               adt_heap_sortDown(heap, rightChildIndex, heapFamily);
-            }
+         return ADT_MEM_ERROR;
+      }
+      if (self->pNodes != 0)
+      {
+         memcpy(pNodes, self->pNodes, sizeof(adt_iheap_node_t) * (size_t) self->s32CurLen);
+         free(self->pNodes);
+      }
+      if (self->pSlots != 0)
+      {
+         memcpy(pSlots, self->pSlots, sizeof(adt_iheap_slot_t) * (size_t) self->s32SlotLen);
+         free(self->pSlots);
+      }
+      self->pNodes = pNodes;
+      self->pSlots = pSlots;
+      self->s32AllocLen = s32Len;
+   }
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Adds an element. When pHandle is not NULL it receives the handle of the new element.
+ */
+adt_error_t adt_iheap_push(adt_iheap_t *self, void *pItem, uint64_t u64Priority, adt_heap_handle_t *pHandle)
+{
+   adt_iheap_node_t node;
+   adt_heap_handle_t handle;
+   if (self == 0)
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (self->firstFree != ADT_HEAP_INVALID_HANDLE)
+   {
+      handle = self->firstFree;
+      self->firstFree = self->pSlots[handle].nextFree;
+   }
+   else
+   {
+      if (self->s32SlotLen == self->s32AllocLen)
+      {
+         int32_t s32NewLen;
+         adt_error_t result;
+         if (self->s32AllocLen == INT32_MAX)
+         {
+            return ADT_LENGTH_ERROR;
          }
-         else{
-            //do nothing
+         s32NewLen = (self->s32AllocLen < ADT_PQ_MIN_ALLOC_LEN)? ADT_PQ_MIN_ALLOC_LEN :
+               (self->s32AllocLen > (INT32_MAX / 2))? INT32_MAX : (self->s32AllocLen * 2);
+         result = adt_iheap_reserve(self, s32NewLen);
+         if (result != ADT_NO_ERROR)
+         {
+            return result;
          }
       }
+      handle = self->s32SlotLen++;
+   }
+   self->pSlots[handle].pItem = pItem;
+   node.u64Priority = u64Priority;
+   node.handle = handle;
+   adt_iheap_sift_up(self, self->s32CurLen++, node);
+   if (pHandle != 0)
+   {
+      *pHandle = handle;
+   }
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Removes the top element. When pElem is not NULL the removed element is copied into it.
+ */
+adt_error_t adt_iheap_pop(adt_iheap_t *self, adt_pq_elem_t *pElem)
+{
+   if (self == 0)
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (self->s32CurLen == 0)
+   {
+      return ADT_LENGTH_ERROR;
+   }
+   return adt_iheap_remove(self, self->pNodes[0].handle, pElem);
+}
+
+/**
+ * Returns handle of the top element or ADT_HEAP_INVALID_HANDLE if the heap is empty
+ */
+adt_heap_handle_t adt_iheap_top(const adt_iheap_t *self)
+{
+   if ( (self != 0) && (self->s32CurLen > 0) )
+   {
+      return self->pNodes[0].handle;
+   }
+   return ADT_HEAP_INVALID_HANDLE;
+}
+
+/**
+ * Copies item and priority of the element with the given handle into pElem
+ */
+adt_error_t adt_iheap_get(const adt_iheap_t *self, adt_heap_handle_t handle, adt_pq_elem_t *pElem)
+{
+   int32_t s32Pos = adt_iheap_position(self, handle);
+   if ( (s32Pos < 0) || (pElem == 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   pElem->pItem = self->pSlots[handle].pItem;
+   pElem->u64Priority = self->pNodes[s32Pos].u64Priority;
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Changes priority of the element with the given handle and moves it up or down as needed
+ */
+adt_error_t adt_iheap_update(adt_iheap_t *self, adt_heap_handle_t handle, uint64_t u64Priority)
+{
+   adt_iheap_node_t node;
+   int32_t s32Pos = adt_iheap_position(self, handle);
+   if (s32Pos < 0)
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   node.u64Priority = u64Priority;
+   node.handle = handle;
+   adt_iheap_place(self, s32Pos, node);
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Same as adt_iheap_update but fails with ADT_INVALID_ARGUMENT_ERROR if the new priority is greater than the current
+ */
+adt_error_t adt_iheap_decrease_key(adt_iheap_t *self, adt_heap_handle_t handle, uint64_t u64Priority)
+{
+   int32_t s32Pos = adt_iheap_position(self, handle);
+   if ( (s32Pos < 0) || (u64Priority > self->pNodes[s32Pos].u64Priority) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   return adt_iheap_update(self, handle, u64Priority);
+}
+
+/**
+ * Same as adt_iheap_update but fails with ADT_INVALID_ARGUMENT_ERROR if the new priority is less than the current
+ */
+adt_error_t adt_iheap_increase_key(adt_iheap_t *self, adt_heap_handle_t handle, uint64_t u64Priority)
+{
+   int32_t s32Pos = adt_iheap_position(self, handle);
+   if ( (s32Pos < 0) || (u64Priority < self->pNodes[s32Pos].u64Priority) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   return adt_iheap_update(self, handle, u64Priority);
+}
+
+/**
+ * Removes the element with the given handle. When pElem is not NULL the removed element is copied into it.
+ * The handle becomes invalid.
+ */
+adt_error_t adt_iheap_remove(adt_iheap_t *self, adt_heap_handle_t handle, adt_pq_elem_t *pElem)
+{
+   adt_iheap_slot_t *pSlot;
+   int32_t s32Pos = adt_iheap_position(self, handle);
+   if (s32Pos < 0)
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   pSlot = &self->pSlots[handle];
+   if (pElem != 0)
+   {
+      pElem->pItem = pSlot->pItem;
+      pElem->u64Priority = self->pNodes[s32Pos].u64Priority;
+   }
+   pSlot->pItem = (void*) 0;
+   pSlot->s32Pos = -1;
+   pSlot->nextFree = self->firstFree;
+   self->firstFree = handle;
+   if (s32Pos < --self->s32CurLen)
+   {
+      adt_iheap_place(self, s32Pos, self->pNodes[self->s32CurLen]);
+   }
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Returns true if handle refers to an element currently in the heap
+ */
+bool adt_iheap_contains(const adt_iheap_t *self, adt_heap_handle_t handle)
+{
+   return (adt_iheap_position(self, handle) >= 0);
+}
+
+int32_t adt_iheap_length(const adt_iheap_t *self)
+{
+   if (self != 0)
+   {
+      return self->s32CurLen;
+   }
+   return 0;
+}
+
+bool adt_iheap_is_empty(const adt_iheap_t *self)
+{
+   return (adt_iheap_length(self) == 0);
+}
+
+/**
+ * Removes all elements, all handles become invalid
+ */
+void adt_iheap_clear(adt_iheap_t *self)
+{
+   if (self != 0)
+   {
+      self->s32CurLen = 0;
+      self->s32SlotLen = 0;
+      self->firstFree = ADT_HEAP_INVALID_HANDLE;
+   }
+}
+
+/************************* top-k ***************************/
+
+adt_error_t adt_heap_topk_create(adt_heap_topk_t *self, int32_t s32MaxLen, adt_vlt_func_t *vlt, bool reverse)
+{
+   if ( (self == 0) || (vlt == 0) || (s32MaxLen < 1) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   self->ppHeap = (void**) malloc(sizeof(void*) * (size_t) s32MaxLen);
+   if (self->ppHeap == 0)
+   {
+      return ADT_MEM_ERROR;
+   }
+   self->s32CurLen = 0;
+   self->s32MaxLen = s32MaxLen;
+   self->vlt = vlt;
+   self->reverse = reverse;
+   return ADT_NO_ERROR;
+}
+
+void adt_heap_topk_destroy(adt_heap_topk_t *self)
+{
+   if ( (self != 0) && (self->ppHeap != 0) )
+   {
+      free(self->ppHeap);
+      self->ppHeap = (void**) 0;
+      self->s32CurLen = 0;
+   }
+}
+
+adt_heap_topk_t* adt_heap_topk_new(int32_t s32MaxLen, adt_vlt_func_t *vlt, bool reverse)
+{
+   adt_heap_topk_t *self = (adt_heap_topk_t*) malloc(sizeof(adt_heap_topk_t));
+   if (self != 0)
+   {
+      if (adt_heap_topk_create(self, s32MaxLen, vlt, reverse) != ADT_NO_ERROR)
+      {
+         free(self);
+         self = (adt_heap_topk_t*) 0;
+      }
+   }
+   return self;
+}
+
+void adt_heap_topk_delete(adt_heap_topk_t *self)
+{
+   if (self != 0)
+   {
+      adt_heap_topk_destroy(self);
+      free(self);
+   }
+}
+
+void adt_heap_topk_vdelete(void *arg)
+{
+   adt_heap_topk_delete((adt_heap_topk_t*) arg);
+}
+
+/**
+ * Offers pElem to the accumulator. When ppRejected is not NULL it receives the element that is no longer kept,
+ * which is either pElem itself or a previously kept element that was pushed out. It receives NULL while the
+ * accumulator is not yet full.
+ */
+adt_error_t adt_heap_topk_push(adt_heap_topk_t *self, void *pElem, void **ppRejected)
+{
+   void *pRejected = (void*) 0;
+   adt_error_t result = ADT_NO_ERROR;
+   if ( (self == 0) || (self->ppHeap == 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (self->s32CurLen < self->s32MaxLen)
+   {
+      self->ppHeap[self->s32CurLen++] = pElem;
+      result = adt_heap_topk_sift_up(self, self->s32CurLen - 1);
+   }
+   else
+   {
+      int isBefore = adt_heap_topk_is_before(self, pElem, self->ppHeap[0]);
+      if (isBefore < 0)
+      {
+         return ADT_OBJECT_COMPARE_ERROR;
+      }
+      if (isBefore != 0)
+      {
+         pRejected = self->ppHeap[0];
+         self->ppHeap[0] = pElem;
+         result = adt_heap_topk_sift_down(self, 0);
+      }
+      else
+      {
+         pRejected = pElem;
+      }
+   }
+   if (ppRejected != 0)
+   {
+      *ppRejected = pRejected;
+   }
+   return result;
+}
+
+/**
+ * Returns the kept element that is ordered last (the K-th element once the accumulator is full), or NULL when empty.
+ */
+void* adt_heap_topk_peek(const adt_heap_topk_t *self)
+{
+   if ( (self != 0) && (self->s32CurLen > 0) )
+   {
+      return self->ppHeap[0];
+   }
+   return (void*) 0;
+}
+
+int32_t adt_heap_topk_length(const adt_heap_topk_t *self)
+{
+   if (self != 0)
+   {
+      return self->s32CurLen;
+   }
+   return 0;
+}
+
+void adt_heap_topk_clear(adt_heap_topk_t *self)
+{
+   if (self != 0)
+   {
+      self->s32CurLen = 0;
+   }
+}
+
+/**
+ * Appends the kept elements to pDest in sorted order (first element is the lowest, or highest when reverse is true)
+ * and leaves the accumulator empty.
+ */
+adt_error_t adt_heap_topk_drain(adt_heap_topk_t *self, adt_ary_t *pDest)
+{
+   int32_t s32Offset;
+   adt_error_t result;
+   if ( (self == 0) || (pDest == 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   s32Offset = adt_ary_length(pDest);
+   result = adt_ary_resize(pDest, s32Offset + self->s32CurLen);
+   while ( (result == ADT_NO_ERROR) && (self->s32CurLen > 0) )
+   {
+      adt_ary_set(pDest, s32Offset + self->s32CurLen - 1, self->ppHeap[0]);
+      self->ppHeap[0] = self->ppHeap[--self->s32CurLen];
+      result = adt_heap_topk_sift_down(self, 0);
+   }
+   return result;
+}
+
+/************************* min-max heap ***************************/
+
+void adt_mmheap_create(adt_mmheap_t *self)
+{
+   if (self != 0)
+   {
+      self->pElems = (adt_pq_elem_t*) 0;
+      self->s32CurLen = 0;
+      self->s32AllocLen = 0;
+   }
+}
+
+void adt_mmheap_destroy(adt_mmheap_t *self)
+{
+   if (self != 0)
+   {
+      if (self->pElems != 0)
+      {
+         free(self->pElems);
+      }
+      self->pElems = (adt_pq_elem_t*) 0;
+      self->s32CurLen = 0;
+      self->s32AllocLen = 0;
+   }
+}
+
+adt_mmheap_t* adt_mmheap_new(void)
+{
+   adt_mmheap_t *self = (adt_mmheap_t*) malloc(sizeof(adt_mmheap_t));
+   if (self != 0)
+   {
+      adt_mmheap_create(self);
+   }
+   return self;
+}
+
+void adt_mmheap_delete(adt_mmheap_t *self)
+{
+   if (self != 0)
+   {
+      adt_mmheap_destroy(self);
+      free(self);
+   }
+}
+
+void adt_mmheap_vdelete(void *arg)
+{
+   adt_mmheap_delete((adt_mmheap_t*) arg);
+}
+
+/**
+ * Makes sure there is room for at least s32Len elements without reallocation
+ */
+adt_error_t adt_mmheap_reserve(adt_mmheap_t *self, int32_t s32Len)
+{
+   if ( (self == 0) || (s32Len < 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (s32Len > self->s32AllocLen)
+   {
+      adt_pq_elem_t *pElems = (adt_pq_elem_t*) malloc(sizeof(adt_pq_elem_t) * (size_t) s32Len);
+      if (pElems == 0)
+      {
+         return ADT_MEM_ERROR;
+      }
+      if (self->pElems != 0)
+      {
+         memcpy(pElems, self->pElems, sizeof(adt_pq_elem_t) * (size_t) self->s32CurLen);
+         free(self->pElems);
+      }
+      self->pElems = pElems;
+      self->s32AllocLen = s32Len;
+   }
+   return ADT_NO_ERROR;
+}
+
+adt_error_t adt_mmheap_push(adt_mmheap_t *self, void *pItem, uint64_t u64Priority)
+{
+   adt_pq_elem_t elem;
+   int32_t s32Index;
+   if (self == 0)
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (self->s32CurLen == self->s32AllocLen)
+   {
+      int32_t s32NewLen;
+      adt_error_t result;
+      if (self->s32AllocLen == INT32_MAX)
+      {
+         return ADT_LENGTH_ERROR;
+      }
+      s32NewLen = (self->s32AllocLen < ADT_MMHEAP_MIN_ALLOC_LEN)? ADT_MMHEAP_MIN_ALLOC_LEN :
+            (self->s32AllocLen > (INT32_MAX / 2))? INT32_MAX : (self->s32AllocLen * 2);
+      result = adt_mmheap_reserve(self, s32NewLen);
+      if (result != ADT_NO_ERROR)
+      {
+         return result;
+      }
+   }
+   elem.pItem = pItem;
+   elem.u64Priority = u64Priority;
+   s32Index = self->s32CurLen++;
+   if (s32Index > 0)
+   {
+      //the new element first decides which of the two chains (min or max levels) it belongs to
+      int32_t s32Parent = (s32Index - 1) >> 1;
+      bool isMax = adt_mmheap_is_max_level(s32Index);
+      uint64_t u64Parent = self->pElems[s32Parent].u64Priority;
+      if ( isMax? (u64Priority < u64Parent) : (u64Priority > u64Parent) )
+      {
+         self->pElems[s32Index] = self->pElems[s32Parent];
+         s32Index = s32Parent;
+         isMax = !isMax;
+      }
+      adt_mmheap_bubble_up(self, s32Index, elem, isMax);
+   }
+   else
+   {
+      self->pElems[0] = elem;
+   }
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Removes the lowest element. When pElem is not NULL the removed element is copied into it.
+ */
+adt_error_t adt_mmheap_pop_min(adt_mmheap_t *self, adt_pq_elem_t *pElem)
+{
+   if (self == 0)
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (self->s32CurLen == 0)
+   {
+      return ADT_LENGTH_ERROR;
+   }
+   if (pElem != 0)
+   {
+      *pElem = self->pElems[0];
+   }
+   if (--self->s32CurLen > 0)
+   {
+      adt_mmheap_trickle_down(self, 0, self->pElems[self->s32CurLen], false);
+   }
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Removes the highest element. When pElem is not NULL the removed element is copied into it.
+ */
+adt_error_t adt_mmheap_pop_max(adt_mmheap_t *self, adt_pq_elem_t *pElem)
+{
+   int32_t s32Index;
+   if (self == 0)
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (self->s32CurLen == 0)
+   {
+      return ADT_LENGTH_ERROR;
+   }
+   s32Index = adt_mmheap_max_index(self);
+   if (pElem != 0)
+   {
+      *pElem = self->pElems[s32Index];
+   }
+   if (s32Index < --self->s32CurLen)
+   {
+      adt_mmheap_trickle_down(self, s32Index, self->pElems[self->s32CurLen], s32Index > 0);
+   }
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Returns pointer to the lowest element or NULL if the heap is empty. The pointer is valid until the heap is modified.
+ */
+const adt_pq_elem_t* adt_mmheap_peek_min(const adt_mmheap_t *self)
+{
+   if ( (self != 0) && (self->s32CurLen > 0) )
+   {
+      return &self->pElems[0];
+   }
+   return (const adt_pq_elem_t*) 0;
+}
+
+/**
+ * Returns pointer to the highest element or NULL if the heap is empty. The pointer is valid until the heap is modified.
+ */
+const adt_pq_elem_t* adt_mmheap_peek_max(const adt_mmheap_t *self)
+{
+   if ( (self != 0) && (self->s32CurLen > 0) )
+   {
+      return &self->pElems[adt_mmheap_max_index(self)];
+   }
+   return (const adt_pq_elem_t*) 0;
+}
+
+/**
+ * Same as adt_mmheap_pop_min followed by adt_mmheap_push but with a single trickle down. When pOld is not NULL
+ * the removed element is copied into it.
+ */
+adt_error_t adt_mmheap_replace_min(adt_mmheap_t *self, void *pItem, uint64_t u64Priority, adt_pq_elem_t *pOld)
+{
+   adt_pq_elem_t elem;
+   if (self == 0)
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (self->s32CurLen == 0)
+   {
+      return ADT_LENGTH_ERROR;
+   }
+   if (pOld != 0)
+   {
+      *pOld = self->pElems[0];
+   }
+   elem.pItem = pItem;
+   elem.u64Priority = u64Priority;
+   adt_mmheap_trickle_down(self, 0, elem, false);
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Same as adt_mmheap_pop_max followed by adt_mmheap_push but with a single trickle down. When pOld is not NULL
+ * the removed element is copied into it.
+ */
+adt_error_t adt_mmheap_replace_max(adt_mmheap_t *self, void *pItem, uint64_t u64Priority, adt_pq_elem_t *pOld)
+{
+   adt_pq_elem_t elem;
+   int32_t s32Index;
+   if (self == 0)
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (self->s32CurLen == 0)
+   {
+      return ADT_LENGTH_ERROR;
+   }
+   s32Index = adt_mmheap_max_index(self);
+   if (pOld != 0)
+   {
+      *pOld = self->pElems[s32Index];
+   }
+   elem.pItem = pItem;
+   elem.u64Priority = u64Priority;
+   if (s32Index == 0)
+   {
+      self->pElems[0] = elem;
+   }
+   else
+   {
+      if (elem.u64Priority < self->pElems[0].u64Priority)
+      {
+         //the new element becomes the lowest element, the old root moves down along the max levels
+         adt_pq_elem_t tmp = self->pElems[0];
+         self->pElems[0] = elem;
+         elem = tmp;
+      }
+      adt_mmheap_trickle_down(self, s32Index, elem, true);
+   }
+   return ADT_NO_ERROR;
+}
+
+int32_t adt_mmheap_length(const adt_mmheap_t *self)
+{
+   if (self != 0)
+   {
+      return self->s32CurLen;
+   }
+   return 0;
+}
+
+bool adt_mmheap_is_empty(const adt_mmheap_t *self)
+{
+   return (adt_mmheap_length(self) == 0);
+}
+
+void adt_mmheap_clear(adt_mmheap_t *self)
+{
+   if (self != 0)
+   {
+      self->s32CurLen = 0;
    }
 }
 
@@ -210,5 +1194,372 @@ void adt_heap_sortDown(adt_ary_t *heap, int32_t parentIndex, adt_heap_family hea
 // LOCAL FUNCTIONS
 //////////////////////////////////////////////////////////////////////////////
 
+/**
+ * Moves the element at parentIndex down into a heap of s32Len elements (hole-based, one write per level)
+ */
+static void adt_heap_sift_down(void **ppData, int32_t s32Len, int32_t parentIndex, adt_heap_family heapFamily){
+   void *pParent = ppData[parentIndex];
+   uint64_t parentValue = ADT_HEAP_ELEM_VALUE((adt_heap_elem_t*) pParent);
+   int32_t childIndex;
+   //children indices at 2i+1, 2i+2
+   while ( (childIndex = (parentIndex<<1) + 1) < s32Len ){
+      uint64_t childValue = ADT_HEAP_ELEM_VALUE((adt_heap_elem_t*) ppData[childIndex]);
+      bool isBefore;
+      if ( (childIndex + 1) < s32Len ){
+         //select right child only when it is strictly better than the left child
+         uint64_t rightValue = ADT_HEAP_ELEM_VALUE((adt_heap_elem_t*) ppData[childIndex + 1]);
+         isBefore = (heapFamily == ADT_MIN_HEAP)? (rightValue < childValue) : (rightValue > childValue);
+         if (isBefore == true){
+            childIndex++;
+            childValue = rightValue;
+         }
+      }
+      isBefore = (heapFamily == ADT_MIN_HEAP)? (childValue < parentValue) : (childValue > parentValue);
+      if (isBefore == false){
+         break;
+      }
+      ppData[parentIndex] = ppData[childIndex];
+      parentIndex = childIndex;
+   }
+   ppData[parentIndex] = pParent;
+}
+
+static bool adt_pq_is_before(const adt_pq_t *self, uint64_t a, uint64_t b)
+{
+   return (self->family == ADT_MIN_HEAP)? (a < b) : (a > b);
+}
+
+/**
+ * Returns the index of the child that shall be closest to the top among the children starting at s32First
+ */
+static int32_t adt_pq_best_child(const adt_pq_t *self, int32_t s32First)
+{
+   const adt_pq_elem_t *pElems = self->pElems;
+   int32_t s32End = s32First + (int32_t) (1u << self->u32ArityShift);
+   int32_t s32Best = s32First;
+   int32_t i;
+   if (s32End > self->s32CurLen)
+   {
+      s32End = self->s32CurLen;
+   }
+   for (i = s32First + 1; i < s32End; i++)
+   {
+      s32Best = adt_pq_is_before(self, pElems[i].u64Priority, pElems[s32Best].u64Priority)? i : s32Best;
+   }
+   return s32Best;
+}
 
+/**
+ * Places *pElem at s32Index (the hole) and moves it toward the root. Parents are moved down instead of swapped.
+ */
+static void adt_pq_sift_up(adt_pq_t *self, int32_t s32Index, const adt_pq_elem_t *pElem)
+{
+   adt_pq_elem_t elem = *pElem;
+   adt_pq_elem_t *pElems = self->pElems;
+   uint32_t u32Shift = self->u32ArityShift;
+   while (s32Index > 0)
+   {
+      int32_t s32Parent = (s32Index - 1) >> u32Shift;
+      if (!adt_pq_is_before(self, elem.u64Priority, pElems[s32Parent].u64Priority))
+      {
+         break;
+      }
+      pElems[s32Index] = pElems[s32Parent];
+      s32Index = s32Parent;
+   }
+   pElems[s32Index] = elem;
+}
 
+/**
+ * Places *pElem at s32Index (the hole) and moves it toward the leaves. pElem may point into the heap beyond s32CurLen.
+ */
+static void adt_pq_sift_down(adt_pq_t *self, int32_t s32Index, const adt_pq_elem_t *pElem)
+{
+   adt_pq_elem_t elem = *pElem;
+   adt_pq_elem_t *pElems = self->pElems;
+   uint32_t u32Shift = self->u32ArityShift;
+   int32_t s32Child;
+   while ( (s32Child = (s32Index << u32Shift) + 1) < self->s32CurLen )
+   {
+      s32Child = adt_pq_best_child(self, s32Child);
+      if (!adt_pq_is_before(self, pElems[s32Child].u64Priority, elem.u64Priority))
+      {
+         break;
+      }
+      pElems[s32Index] = pElems[s32Child];
+      s32Index = s32Child;
+   }
+   pElems[s32Index] = elem;
+}
+
+/**
+ * Fills the hole left at the root after removing the top element (bottom-up heap deletion).
+ * The hole is first moved all the way down along the best child, then the former last element is sifted up
+ * from there. The last element usually belongs near the leaves, which saves one comparison per level compared to
+ * a plain sift down.
+ */
+static void adt_pq_pop_hole(adt_pq_t *self)
+{
+   adt_pq_elem_t *pElems = self->pElems;
+   uint32_t u32Shift = self->u32ArityShift;
+   int32_t s32Index = 0;
+   int32_t s32Child;
+   while ( (s32Child = (s32Index << u32Shift) + 1) < self->s32CurLen )
+   {
+      s32Child = adt_pq_best_child(self, s32Child);
+      pElems[s32Index] = pElems[s32Child];
+      s32Index = s32Child;
+   }
+   adt_pq_sift_up(self, s32Index, &pElems[self->s32CurLen]);
+}
+
+static bool adt_iheap_is_before(const adt_iheap_t *self, uint64_t a, uint64_t b)
+{
+   return (self->family == ADT_MIN_HEAP)? (a < b) : (a > b);
+}
+
+/**
+ * Returns heap position of handle or -1 if the handle is not in use
+ */
+static int32_t adt_iheap_position(const adt_iheap_t *self, adt_heap_handle_t handle)
+{
+   if ( (self != 0) && (handle >= 0) && (handle < self->s32SlotLen) )
+   {
+      return self->pSlots[handle].s32Pos;
+   }
+   return -1;
+}
+
+/**
+ * Places node at s32Index (the hole) and moves it toward the root. Positions of all moved nodes are updated.
+ */
+static void adt_iheap_sift_up(adt_iheap_t *self, int32_t s32Index, adt_iheap_node_t node)
+{
+   adt_iheap_node_t *pNodes = self->pNodes;
+   adt_iheap_slot_t *pSlots = self->pSlots;
+   while (s32Index > 0)
+   {
+      int32_t s32Parent = (s32Index - 1) >> 1;
+      if (!adt_iheap_is_before(self, node.u64Priority, pNodes[s32Parent].u64Priority))
+      {
+         break;
+      }
+      pNodes[s32Index] = pNodes[s32Parent];
+      pSlots[pNodes[s32Index].handle].s32Pos = s32Index;
+      s32Index = s32Parent;
+   }
+   pNodes[s32Index] = node;
+   pSlots[node.handle].s32Pos = s32Index;
+}
+
+/**
+ * Places node at s32Index (the hole) and moves it toward the leaves. Positions of all moved nodes are updated.
+ */
+static void adt_iheap_sift_down(adt_iheap_t *self, int32_t s32Index, adt_iheap_node_t node)
+{
+   adt_iheap_node_t *pNodes = self->pNodes;
+   adt_iheap_slot_t *pSlots = self->pSlots;
+   int32_t s32Child;
+   while ( (s32Child = (s32Index << 1) + 1) < self->s32CurLen )
+   {
+      if ( ((s32Child + 1) < self->s32CurLen) && adt_iheap_is_before(self, pNodes[s32Child + 1].u64Priority, pNodes[s32Child].u64Priority) )
+      {
+         s32Child++;
+      }
+      if (!adt_iheap_is_before(self, pNodes[s32Child].u64Priority, node.u64Priority))
+      {
+         break;
+      }
+      pNodes[s32Index] = pNodes[s32Child];
+      pSlots[pNodes[s32Index].handle].s32Pos = s32Index;
+      s32Index = s32Child;
+   }
+   pNodes[s32Index] = node;
+   pSlots[node.handle].s32Pos = s32Index;
+}
+
+/**
+ * Places node at s32Index and sifts it in whichever direction restores the heap property
+ */
+static void adt_iheap_place(adt_iheap_t *self, int32_t s32Index, adt_iheap_node_t node)
+{
+   if ( (s32Index > 0) && adt_iheap_is_before(self, node.u64Priority, self->pNodes[(s32Index - 1) >> 1].u64Priority) )
+   {
+      adt_iheap_sift_up(self, s32Index, node);
+   }
+   else
+   {
+      adt_iheap_sift_down(self, s32Index, node);
+   }
+}
+
+static int adt_heap_topk_is_before(const adt_heap_topk_t *self, const void *a, const void *b)
+{
+   return self->reverse? self->vlt(b, a) : self->vlt(a, b);
+}
+
+/**
+ * Moves the element at s32Index toward the root while it is ordered after its parent.
+ */
+static adt_error_t adt_heap_topk_sift_up(adt_heap_topk_t *self, int32_t s32Index)
+{
+   void *pElem = self->ppHeap[s32Index];
+   adt_error_t result = ADT_NO_ERROR;
+   while (s32Index > 0)
+   {
+      int32_t s32Parent = (s32Index - 1) >> 1;
+      int isBefore = adt_heap_topk_is_before(self, self->ppHeap[s32Parent], pElem);
+      if (isBefore <= 0)
+      {
+         if (isBefore < 0)
+         {
+            result = ADT_OBJECT_COMPARE_ERROR;
+         }
+         break;
+      }
+      self->ppHeap[s32Index] = self->ppHeap[s32Parent];
+      s32Index = s32Parent;
+   }
+   self->ppHeap[s32Index] = pElem;
+   return result;
+}
+
+/**
+ * Moves the element at s32Index toward the leaves while one of its children is ordered after it.
+ */
+static adt_error_t adt_heap_topk_sift_down(adt_heap_topk_t *self, int32_t s32Index)
+{
+   void *pElem = self->ppHeap[s32Index];
+   int32_t s32Child;
+   adt_error_t result = ADT_NO_ERROR;
+   while ( (s32Child = (s32Index << 1) + 1) < self->s32CurLen )
+   {
+      int isBefore;
+      if ( (s32Child + 1) < self->s32CurLen )
+      {
+         isBefore = adt_heap_topk_is_before(self, self->ppHeap[s32Child], self->ppHeap[s32Child + 1]);
+         if (isBefore < 0)
+         {
+            result = ADT_OBJECT_COMPARE_ERROR;
+            break;
+         }
+         s32Child += (isBefore != 0)? 1 : 0;
+      }
+      isBefore = adt_heap_topk_is_before(self, pElem, self->ppHeap[s32Child]);
+      if (isBefore <= 0)
+      {
+         if (isBefore < 0)
+         {
+            result = ADT_OBJECT_COMPARE_ERROR;
+         }
+         break;
+      }
+      self->ppHeap[s32Index] = self->ppHeap[s32Child];
+      s32Index = s32Child;
+   }
+   self->ppHeap[s32Index] = pElem;
+   return result;
+}
+
+/**
+ * Returns true when s32Index is on an odd level of the tree (a max level)
+ */
+static bool adt_mmheap_is_max_level(int32_t s32Index)
+{
+   uint32_t u32Pos = (uint32_t) s32Index + 1u;
+   uint32_t u32Level = 0u;
+   while (u32Pos > 1u)
+   {
+      u32Pos >>= 1;
+      u32Level++;
+   }
+   return ( (u32Level & 1u) != 0u );
+}
+
+/**
+ * Returns index of the highest element. The heap must not be empty.
+ */
+static int32_t adt_mmheap_max_index(const adt_mmheap_t *self)
+{
+   if (self->s32CurLen < 3)
+   {
+      return self->s32CurLen - 1;
+   }
+   return (self->pElems[2].u64Priority > self->pElems[1].u64Priority)? 2 : 1;
+}
+
+/**
+ * Places elem at s32Index (the hole) and moves it toward the root along grandparents on the same kind of level
+ */
+static void adt_mmheap_bubble_up(adt_mmheap_t *self, int32_t s32Index, adt_pq_elem_t elem, bool isMax)
+{
+   adt_pq_elem_t *pElems = self->pElems;
+   while (s32Index > 2)
+   {
+      int32_t s32Grandparent = (((s32Index - 1) >> 1) - 1) >> 1;
+      uint64_t u64Grandparent = pElems[s32Grandparent].u64Priority;
+      if ( isMax? (elem.u64Priority <= u64Grandparent) : (elem.u64Priority >= u64Grandparent) )
+      {
+         break;
+      }
+      pElems[s32Index] = pElems[s32Grandparent];
+      s32Index = s32Grandparent;
+   }
+   pElems[s32Index] = elem;
+}
+
+/**
+ * Places elem at s32Index (the hole) and moves it toward the leaves. isMax tells whether s32Index is on a max level.
+ * The hole moves two levels at a time, to the best of the children and grandchildren. When elem passes a node on the
+ * opposite kind of level that it does not belong under, the two are exchanged.
+ * elem may be a copy of the element just beyond s32CurLen.
+ */
+static void adt_mmheap_trickle_down(adt_mmheap_t *self, int32_t s32Index, adt_pq_elem_t elem, bool isMax)
+{
+   adt_pq_elem_t *pElems = self->pElems;
+   int32_t s32Len = self->s32CurLen;
+   int32_t s32Child;
+   while ( (s32Child = (s32Index << 1) + 1) < s32Len )
+   {
+      int32_t s32Grandchild = (s32Child << 1) + 1;
+      int32_t s32End = s32Grandchild + 4;
+      int32_t s32Best = s32Child;
+      int32_t i;
+      if (s32End > s32Len)
+      {
+         s32End = s32Len;
+      }
+      if (s32Child + 1 < s32Len)
+      {
+         s32Best = (isMax? (pElems[s32Child + 1].u64Priority > pElems[s32Best].u64Priority) :
+               (pElems[s32Child + 1].u64Priority < pElems[s32Best].u64Priority))? s32Child + 1 : s32Best;
+      }
+      for (i = s32Grandchild; i < s32End; i++)
+      {
+         s32Best = (isMax? (pElems[i].u64Priority > pElems[s32Best].u64Priority) :
+               (pElems[i].u64Priority < pElems[s32Best].u64Priority))? i : s32Best;
+      }
+      if ( isMax? (pElems[s32Best].u64Priority <= elem.u64Priority) : (pElems[s32Best].u64Priority >= elem.u64Priority) )
+      {
+         break;
+      }
+      pElems[s32Index] = pElems[s32Best];
+      s32Index = s32Best;
+      if (s32Best < s32Grandchild)
+      {
+         //a child has no grandchildren that are better than itself, elem stops here
+         break;
+      }
+      else
+      {
+         int32_t s32Parent = (s32Best - 1) >> 1;
+         if ( isMax? (elem.u64Priority < pElems[s32Parent].u64Priority) : (elem.u64Priority > pElems[s32Parent].u64Priority) )
+         {
+            adt_pq_elem_t tmp = pElems[s32Parent];
+            pElems[s32Parent] = elem;
+            elem = tmp;
+         }
+      }
+   }
+   pElems[s32Index] = elem;
+}
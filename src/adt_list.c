@@ -2,18 +2,56 @@
 #include <errno.h>
 #include <malloc.h>
 #include "adt_list.h"
+#include "adt_template.h"
 #ifdef MEM_LEAK_CHECK
 #include "CMemLeak.h"
 #endif
 
+#define ADT_LIST_SORT_MAX_RUNS 32 //enough for INT32_MAX elements
+
+/**
+ * Index entry for one item. pElem is the most recently indexed element holding the item and s32Count is the
+ * number of elements holding the item.
+ */
+typedef struct adt_list_index_entry_tag
+{
+   adt_list_elem_t *pElem;
+   int32_t s32Count;
+} adt_list_index_entry_t;
+
+/**
+ * Neighbours of an element in the chain of elements holding the same item, ordered by when they were indexed.
+ * Only elements whose item is in the list more than once have links.
+ */
+typedef struct adt_list_index_link_tag
+{
+   adt_list_elem_t *pOlder;
+   adt_list_elem_t *pNewer;
+} adt_list_index_link_t;
+
+ADT_HASHMAP_DEFINE(adt_list_item_map, void*, adt_list_index_entry_t, adt_hash_ptr, ADT_EQ_VALUE)
+ADT_HASHMAP_DEFINE(adt_list_link_map, adt_list_elem_t*, adt_list_index_link_t, adt_hash_ptr, ADT_EQ_VALUE)
+
+typedef struct adt_list_index_tag
+{
+   adt_list_item_map_t items; //item -> entry
+   adt_list_link_map_t links; //element -> link
+} adt_list_index_t;
+
 /**************** Private Function Declarations *******************/
 static void  adt_list_elem_create(adt_list_elem_t *self, void* pItem, adt_list_elem_t *pNext, adt_list_elem_t *pPrev);
-static adt_list_elem_t*  adt_list_elem_new(void* pItem, adt_list_elem_t *pNext, adt_list_elem_t *pPrev);
-static void  adt_list_elem_delete(adt_list_elem_t *self);
+static adt_list_elem_t*  adt_list_elem_new(adt_pool_t *pPool, void* pItem, adt_list_elem_t *pNext, adt_list_elem_t *pPrev);
+static void  adt_list_elem_delete(adt_pool_t *pPool, adt_list_elem_t *self);
+static void  adt_list_free_elems(adt_list_t *self);
+static adt_error_t adt_list_index_add(adt_list_t *self, adt_list_elem_t *pElem);
+static void adt_list_index_del(adt_list_t *self, adt_list_elem_t *pElem);
+static void adt_list_index_delete(adt_list_index_t *pIndex);
+static adt_list_elem_t* adt_list_merge_runs(adt_list_elem_t *pLeft, adt_list_elem_t *pRight, adt_vlt_func_t *vlt, bool reverse, adt_error_t *pResult);
 
 static void  adt_u32List_elem_create(adt_u32List_elem_t *self, uint32_t item, adt_u32List_elem_t *pNext, adt_u32List_elem_t *pPrev);
-static adt_u32List_elem_t*  adt_u32List_elem_new(uint32_t item, adt_u32List_elem_t *pNext, adt_u32List_elem_t *pPrev);
-static void  adt_u32List_elem_delete(adt_u32List_elem_t *self);
+static adt_u32List_elem_t*  adt_u32List_elem_new(adt_pool_t *pPool, uint32_t item, adt_u32List_elem_t *pNext, adt_u32List_elem_t *pPrev);
+static void  adt_u32List_elem_delete(adt_pool_t *pPool, adt_u32List_elem_t *self);
+static void  adt_u32List_free_elems(adt_u32List_t *self);
 
 
 
@@ -31,32 +69,61 @@ void  adt_list_create(adt_list_t *self, void (*pDestructor)(void*))
       self->destructorEnable = true;
       self->pFirst = 0;
       self->pLast = 0;
+      self->pPool = (adt_pool_t*) 0;
+      self->pIndex = (struct adt_list_index_tag*) 0;
+      self->s32Length = 0;
+      self->isPoolOwner = false;
+   }
+}
+
+/**
+ * Creates a list which allocates its nodes from a pool owned by the list. s32SlabLen is the number of nodes
+ * allocated at a time (0 selects the default slab size of adt_pool_t).
+ */
+adt_error_t adt_list_create_pooled(adt_list_t *self, void (*pDestructor)(void*), int32_t s32SlabLen)
+{
+   adt_pool_t *pPool;
+   if ( (self == 0) || (s32SlabLen < 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
    }
+   pPool = adt_pool_new((uint32_t) sizeof(adt_list_elem_t), s32SlabLen);
+   if (pPool == 0)
+   {
+      return ADT_MEM_ERROR;
+   }
+   adt_list_create(self, pDestructor);
+   self->pPool = pPool;
+   self->isPoolOwner = true;
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Creates a list which allocates its nodes from pPool. The pool must have an element size of at least
+ * sizeof(adt_list_elem_t) and must outlive the list.
+ */
+adt_error_t adt_list_create_shared(adt_list_t *self, void (*pDestructor)(void*), adt_pool_t *pPool)
+{
+   if ( (self == 0) || (pPool == 0) || (adt_pool_elem_size(pPool) < (uint32_t) sizeof(adt_list_elem_t)) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   adt_list_create(self, pDestructor);
+   self->pPool = pPool;
+   return ADT_NO_ERROR;
 }
 
 void  adt_list_destroy(adt_list_t *self)
 {
    if (self != 0)
    {
-      adt_list_elem_t *iter = self->pFirst;
-      void (*destructor)(void*) = (void (*)(void*)) 0;
-      if (iter == 0)
-      {
-         return; //empty list
-      }
-      if ( (self->destructorEnable != false) && (self->pDestructor != 0) )
-      {
-         destructor = self->pDestructor;
-      }
-      while( iter != 0 )
+      adt_list_free_elems(self);
+      (void) adt_list_index_enable(self, false);
+      if (self->isPoolOwner)
       {
-         adt_list_elem_t *pNext = iter->pNext;
-         if (destructor != 0)
-         {
-            destructor(iter->pItem);
-         }
-         adt_list_elem_delete(iter);
-         iter=pNext;
+         adt_pool_delete(self->pPool);
+         self->pPool = (adt_pool_t*) 0;
+         self->isPoolOwner = false;
       }
    }
 }
@@ -95,6 +162,51 @@ void adt_list_destructor_enable(adt_list_t *self, bool enable){
    }
 }
 
+/**
+ * Enables (or disables and frees) the item index. Enabling builds the index from the current elements in O(n).
+ * When an item is in the list more than once, find and remove use the element that was added last (elements already
+ * in the list when the index is enabled are added in list order, spliced elements count as added by the splice).
+ * Erasing such an element is still O(1) on average, the index links the elements holding the same item.
+ * While the index is enabled, inserting an element can also fail because the index cannot grow, in which case
+ * the list is left unchanged (just like when the node itself cannot be allocated).
+ */
+adt_error_t adt_list_index_enable(adt_list_t *self, bool enable)
+{
+   if (self == 0)
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if ( enable && (self->pIndex == 0) )
+   {
+      adt_list_elem_t *iter;
+      adt_error_t result;
+      self->pIndex = (adt_list_index_t*) malloc(sizeof(adt_list_index_t));
+      if (self->pIndex == 0)
+      {
+         return ADT_MEM_ERROR;
+      }
+      adt_list_item_map_create(&self->pIndex->items);
+      adt_list_link_map_create(&self->pIndex->links);
+      result = adt_list_item_map_reserve(&self->pIndex->items, (uint32_t) self->s32Length);
+      for (iter = self->pFirst; (iter != 0) && (result == ADT_NO_ERROR); iter = iter->pNext)
+      {
+         result = adt_list_index_add(self, iter);
+      }
+      if (result != ADT_NO_ERROR)
+      {
+         adt_list_index_delete(self->pIndex);
+         self->pIndex = (adt_list_index_t*) 0;
+         return ADT_MEM_ERROR;
+      }
+   }
+   else if ( (!enable) && (self->pIndex != 0) )
+   {
+      adt_list_index_delete(self->pIndex);
+      self->pIndex = (adt_list_index_t*) 0;
+   }
+   return ADT_NO_ERROR;
+}
+
 
 /**
  * inserts at end of the list
@@ -103,7 +215,12 @@ void adt_list_insert(adt_list_t *self, void *pItem)
 {
    if (self != 0)
    {
-      adt_list_elem_t *elem = adt_list_elem_new(pItem,0,self->pLast);
+      adt_list_elem_t *elem = adt_list_elem_new(self->pPool, pItem, 0, self->pLast);
+      if ( (elem != 0) && (adt_list_index_add(self, elem) != ADT_NO_ERROR) )
+      {
+         adt_list_elem_delete(self->pPool, elem);
+         elem = (adt_list_elem_t*) 0;
+      }
       if (elem != 0)
       {
          if (self->pLast==0)
@@ -117,6 +234,7 @@ void adt_list_insert(adt_list_t *self, void *pItem)
             self->pLast->pNext=elem;
             self->pLast=elem;
          }
+         self->s32Length++;
       }
    }
 }
@@ -128,7 +246,12 @@ void adt_list_insert_before(adt_list_t *self, adt_list_elem_t *pIter, void *pIte
 {
    if( (self != 0) && (pIter != 0) && (pItem != 0) )
    {
-      adt_list_elem_t *pElem = adt_list_elem_new(pItem,pIter, pIter->pPrev);
+      adt_list_elem_t *pElem = adt_list_elem_new(self->pPool, pItem, pIter, pIter->pPrev);
+      if ( (pElem != 0) && (adt_list_index_add(self, pElem) != ADT_NO_ERROR) )
+      {
+         adt_list_elem_delete(self->pPool, pElem);
+         pElem = (adt_list_elem_t*) 0;
+      }
       if (pElem != 0)
       {
          if (pIter->pPrev != 0)
@@ -141,6 +264,7 @@ void adt_list_insert_before(adt_list_t *self, adt_list_elem_t *pIter, void *pIte
          {
             self->pFirst = pElem;
          }
+         self->s32Length++;
       }
    }
 }
@@ -152,7 +276,12 @@ void adt_list_insert_after(adt_list_t *self, adt_list_elem_t *pIter, void *pItem
 {
    if( (self != 0) && (pIter != 0) && (pItem != 0) )
    {
-      adt_list_elem_t *pElem = adt_list_elem_new(pItem,pIter->pNext, pIter);
+      adt_list_elem_t *pElem = adt_list_elem_new(self->pPool, pItem, pIter->pNext, pIter);
+      if ( (pElem != 0) && (adt_list_index_add(self, pElem) != ADT_NO_ERROR) )
+      {
+         adt_list_elem_delete(self->pPool, pElem);
+         pElem = (adt_list_elem_t*) 0;
+      }
       if (pElem != 0)
       {
          if (pIter->pNext != 0)
@@ -165,6 +294,7 @@ void adt_list_insert_after(adt_list_t *self, adt_list_elem_t *pIter, void *pItem
          {
             self->pLast = pElem;
          }
+         self->s32Length++;
       }
    }
 }
@@ -177,6 +307,14 @@ void adt_list_insert_unique(adt_list_t *self, void *pItem)
    if (self != 0)
    {
       adt_list_elem_t *pIter = self->pFirst; //create a local iterator
+      if (self->pIndex != 0)
+      {
+         if (adt_list_item_map_get(&self->pIndex->items, pItem) == 0)
+         {
+            adt_list_insert(self, pItem);
+         }
+         return;
+      }
       while( pIter != 0 )
       {
          adt_list_elem_t *pNext = pIter->pNext;
@@ -287,6 +425,11 @@ adt_list_elem_t *adt_list_find(const adt_list_t *self, void *pItem)
    if (self != 0)
    {
       adt_list_elem_t *iter = self->pFirst;
+      if (self->pIndex != 0)
+      {
+         adt_list_index_entry_t *pEntry = adt_list_item_map_get(&self->pIndex->items, pItem);
+         return (pEntry != 0)? pEntry->pElem : (adt_list_elem_t*) 0;
+      }
       if (iter == 0)
       {
          return (adt_list_elem_t*) 0; //empty list
@@ -338,33 +481,235 @@ void adt_list_erase(adt_list_t *self, adt_list_elem_t *pIter)
       if (self->pFirst == 0) { assert (self->pLast == 0); }
       if (self->pLast == 0) { assert (self->pFirst == 0); }
 #endif
-      adt_list_elem_delete(pIter);
+      self->s32Length--;
+      adt_list_index_del(self, pIter);
+      adt_list_elem_delete(self->pPool, pIter);
    }
 }
 
 int32_t adt_list_length(const adt_list_t *self)
 {
-   int32_t result=0;
    if (self != 0)
    {
-      adt_list_elem_t *iter = self->pFirst;
-      while(iter != 0)
-      {
-         ++result;
-         iter = iter->pNext;
-      }
+      return self->s32Length;
    }
-   return result;
+   return 0;
 }
 
 void adt_list_clear(adt_list_t *self)
 {
    if (self != 0)
    {
-      adt_list_destroy(self);
+      adt_list_free_elems(self);
       self->pFirst = 0;
       self->pLast = 0;
+      self->s32Length = 0;
+      if (self->pIndex != 0)
+      {
+         adt_list_item_map_clear(&self->pIndex->items);
+         adt_list_link_map_clear(&self->pIndex->links);
+      }
+   }
+}
+
+/**
+ * Moves the elements pFirst to pLast (inclusive) from src into self, before pPos (or to the end of self when pPos is
+ * NULL). Use NULL for both pFirst and pLast to move all elements of src. Nodes are relinked, not copied, which means
+ * both lists must allocate nodes the same way (both with malloc or both from the same pool).
+ * Moving all elements of src is O(1). Moving part of src between two different lists is O(k) for k moved elements,
+ * which is the cost of keeping both cached lengths up to date.
+ */
+adt_error_t adt_list_splice(adt_list_t *self, adt_list_elem_t *pPos, adt_list_t *src, adt_list_elem_t *pFirst, adt_list_elem_t *pLast)
+{
+   int32_t s32Count;
+   if ( (self == 0) || (src == 0) || (self->pPool != src->pPool) || ((pFirst == 0) != (pLast == 0)) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (pFirst == 0)
+   {
+      if (self == src)
+      {
+         return ADT_INVALID_ARGUMENT_ERROR;
+      }
+      pFirst = src->pFirst;
+      pLast = src->pLast;
+      if (pFirst == 0)
+      {
+         return ADT_NO_ERROR; //src is empty
+      }
+      s32Count = src->s32Length;
+   }
+   else if ( (self != src) || (pPos != 0) )
+   {
+      //count the elements and make sure pPos is not inside the range
+      adt_list_elem_t *iter = pFirst;
+      s32Count = 1;
+      while (iter != pLast)
+      {
+         if ( (iter == pPos) || (iter->pNext == 0) )
+         {
+            return ADT_INVALID_ARGUMENT_ERROR;
+         }
+         iter = iter->pNext;
+         s32Count++;
+      }
+      if (iter == pPos)
+      {
+         return ADT_INVALID_ARGUMENT_ERROR;
+      }
+   }
+   else
+   {
+      s32Count = 0; //moving to the end of the same list, no counting needed
+   }
+   if ( (pPos == pLast->pNext) && (self == src) )
+   {
+      return ADT_NO_ERROR; //already in place
+   }
+   if ( (self != src) && (self->pIndex != 0) )
+   {
+      //make room first, adding the moved elements to the index below cannot fail. Each added element creates at most
+      //two links (its own and the one of the single element already holding the item)
+      if ( (adt_list_item_map_reserve(&self->pIndex->items, self->pIndex->items.u32Size + (uint32_t) s32Count) != ADT_NO_ERROR) ||
+           (adt_list_link_map_reserve(&self->pIndex->links, self->pIndex->links.u32Size + 2u * (uint32_t) s32Count) != ADT_NO_ERROR) )
+      {
+         return ADT_MEM_ERROR;
+      }
+   }
+   //unlink range from src
+   if (pFirst->pPrev != 0)
+   {
+      pFirst->pPrev->pNext = pLast->pNext;
+   }
+   else
+   {
+      src->pFirst = pLast->pNext;
+   }
+   if (pLast->pNext != 0)
+   {
+      pLast->pNext->pPrev = pFirst->pPrev;
+   }
+   else
+   {
+      src->pLast = pFirst->pPrev;
+   }
+   //link range into self
+   pLast->pNext = pPos;
+   if (pPos != 0)
+   {
+      pFirst->pPrev = pPos->pPrev;
+      pPos->pPrev = pLast;
+   }
+   else
+   {
+      pFirst->pPrev = self->pLast;
+      self->pLast = pLast;
+   }
+   if (pFirst->pPrev != 0)
+   {
+      pFirst->pPrev->pNext = pFirst;
    }
+   else
+   {
+      self->pFirst = pFirst;
+   }
+   if (self != src)
+   {
+      src->s32Length -= s32Count;
+      self->s32Length += s32Count;
+      if ( (src->pIndex != 0) && (src->s32Length == 0) )
+      {
+         adt_list_item_map_clear(&src->pIndex->items);
+         adt_list_link_map_clear(&src->pIndex->links);
+      }
+      if ( (self->pIndex != 0) || ((src->pIndex != 0) && (src->s32Length != 0)) )
+      {
+         adt_list_elem_t *iter = pFirst;
+         for(;;)
+         {
+            if (src->s32Length != 0)
+            {
+               adt_list_index_del(src, iter);
+            }
+            (void) adt_list_index_add(self, iter);
+            if (iter == pLast)
+            {
+               break;
+            }
+            iter = iter->pNext;
+         }
+      }
+   }
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Moves all elements of src to the end of self in O(1)
+ */
+adt_error_t adt_list_concat(adt_list_t *self, adt_list_t *src)
+{
+   return adt_list_splice(self, (adt_list_elem_t*) 0, src, (adt_list_elem_t*) 0, (adt_list_elem_t*) 0);
+}
+
+/**
+ * Stable sort of the items in ascending order (descending when reverse is true) using vlt to compare items.
+ * This is a merge sort that relinks the existing nodes, no memory is allocated. Sorted runs of 1, 2, 4 ... elements
+ * are merged as soon as two runs of the same length exist, which keeps the merges working on recently visited nodes.
+ * If vlt reports an error (negative return value) the sort continues treating the pair as equal and
+ * ADT_OBJECT_COMPARE_ERROR is returned. All elements are still in the list in that case.
+ */
+adt_error_t adt_list_sort(adt_list_t *self, adt_vlt_func_t *vlt, bool reverse)
+{
+   adt_error_t result = ADT_NO_ERROR;
+   adt_list_elem_t *pRuns[ADT_LIST_SORT_MAX_RUNS]; //pRuns[i] is NULL or a sorted run of 2^i elements
+   adt_list_elem_t *pElem;
+   adt_list_elem_t *pPrev;
+   int32_t s32NumRuns = 0;
+   int32_t i;
+   if ( (self == 0) || (vlt == 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   //runs are linked through pNext only, pPrev is restored at the end
+   pElem = self->pFirst;
+   while (pElem != 0)
+   {
+      adt_list_elem_t *pNext = pElem->pNext;
+      adt_list_elem_t *pCarry = pElem;
+      pCarry->pNext = (adt_list_elem_t*) 0;
+      for (i = 0; (i < s32NumRuns) && (pRuns[i] != 0); i++)
+      {
+         //pRuns[i] holds earlier elements than pCarry
+         pCarry = adt_list_merge_runs(pRuns[i], pCarry, vlt, reverse, &result);
+         pRuns[i] = (adt_list_elem_t*) 0;
+      }
+      if (i == s32NumRuns)
+      {
+         s32NumRuns++;
+      }
+      pRuns[i] = pCarry;
+      pElem = pNext;
+   }
+   pElem = (adt_list_elem_t*) 0;
+   for (i = 0; i < s32NumRuns; i++)
+   {
+      if (pRuns[i] != 0)
+      {
+         pElem = (pElem == 0)? pRuns[i] : adt_list_merge_runs(pRuns[i], pElem, vlt, reverse, &result);
+      }
+   }
+   //restore backward links
+   self->pFirst = pElem;
+   pPrev = (adt_list_elem_t*) 0;
+   while (pElem != 0)
+   {
+      pElem->pPrev = pPrev;
+      pPrev = pElem;
+      pElem = pElem->pNext;
+   }
+   self->pLast = pPrev;
+   return result;
 }
 
 /******* adt_u32List API *************/
@@ -374,23 +719,63 @@ void  adt_u32List_create(adt_u32List_t *self)
    {
       self->pFirst = 0;
       self->pLast = 0;
+      self->pPool = (adt_pool_t*) 0;
+      self->s32Length = 0;
+      self->isPoolOwner = false;
+   }
+}
+
+/**
+ * Creates a list which allocates its nodes from a pool owned by the list. s32SlabLen is the number of nodes
+ * allocated at a time (0 selects the default slab size of adt_pool_t).
+ */
+adt_error_t adt_u32List_create_pooled(adt_u32List_t *self, int32_t s32SlabLen)
+{
+   adt_pool_t *pPool;
+   if ( (self == 0) || (s32SlabLen < 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   pPool = adt_pool_new((uint32_t) sizeof(adt_u32List_elem_t), s32SlabLen);
+   if (pPool == 0)
+   {
+      return ADT_MEM_ERROR;
+   }
+   adt_u32List_create(self);
+   self->pPool = pPool;
+   self->isPoolOwner = true;
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Creates a list which allocates its nodes from pPool. The pool must have an element size of at least
+ * sizeof(adt_u32List_elem_t) and must outlive the list.
+ */
+adt_error_t adt_u32List_create_shared(adt_u32List_t *self, adt_pool_t *pPool)
+{
+   if ( (self == 0) || (pPool == 0) || (adt_pool_elem_size(pPool) < (uint32_t) sizeof(adt_u32List_elem_t)) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
    }
+   adt_u32List_create(self);
+   self->pPool = pPool;
+   return ADT_NO_ERROR;
 }
 
 void  adt_u32List_destroy(adt_u32List_t *self)
 {
    if (self != 0)
    {
-      adt_u32List_elem_t *iter = self->pFirst;
-      if (iter == 0)
+      if (self->isPoolOwner)
       {
-         return; //empty list
+         //all nodes are returned to the system with the pool
+         adt_pool_delete(self->pPool);
+         self->pPool = (adt_pool_t*) 0;
+         self->isPoolOwner = false;
       }
-      while( iter != 0 )
+      else
       {
-         adt_u32List_elem_t *pNext = iter->pNext;
-         adt_u32List_elem_delete(iter);
-         iter=pNext;
+         adt_u32List_free_elems(self);
       }
    }
 }
@@ -430,7 +815,7 @@ void adt_u32List_insert(adt_u32List_t *self, uint32_t item)
 {
    if (self != 0)
    {
-      adt_u32List_elem_t *elem = adt_u32List_elem_new(item, 0, self->pLast);
+      adt_u32List_elem_t *elem = adt_u32List_elem_new(self->pPool, item, 0, self->pLast);
       if (elem != 0)
       {
          if (self->pLast==0)
@@ -443,6 +828,7 @@ void adt_u32List_insert(adt_u32List_t *self, uint32_t item)
             self->pLast->pNext=elem;
             self->pLast=elem;
          }
+         self->s32Length++;
       }
    }
 }
@@ -451,7 +837,7 @@ void adt_u32List_insert_before(adt_u32List_t *self, adt_u32List_elem_t *pIter, u
 {
    if( (self != 0) && (pIter != 0) )
    {
-      adt_u32List_elem_t *pElem = adt_u32List_elem_new(item, pIter, pIter->pPrev);
+      adt_u32List_elem_t *pElem = adt_u32List_elem_new(self->pPool, item, pIter, pIter->pPrev);
       if (pElem != 0)
       {
          if (pIter->pPrev != 0)
@@ -464,6 +850,7 @@ void adt_u32List_insert_before(adt_u32List_t *self, adt_u32List_elem_t *pIter, u
          {
             self->pFirst = pElem;
          }
+         self->s32Length++;
       }
    }
 }
@@ -472,7 +859,7 @@ void adt_u32List_insert_after(adt_u32List_t *self, adt_u32List_elem_t *pIter, ui
 {
    if( (self != 0) && (pIter != 0) )
    {
-      adt_u32List_elem_t *pElem = adt_u32List_elem_new(item,pIter->pNext, pIter);
+      adt_u32List_elem_t *pElem = adt_u32List_elem_new(self->pPool, item, pIter->pNext, pIter);
       if (pElem != 0)
       {
          if (pIter->pNext != 0)
@@ -485,6 +872,7 @@ void adt_u32List_insert_after(adt_u32List_t *self, adt_u32List_elem_t *pIter, ui
          {
             self->pLast = pElem;
          }
+         self->s32Length++;
       }
    }
 }
@@ -524,7 +912,8 @@ void adt_u32List_erase(adt_u32List_t *self, adt_u32List_elem_t *pIter)
       if (self->pFirst == 0) { assert (self->pLast == 0); }
       if (self->pLast == 0) { assert (self->pFirst == 0); }
 #endif
-      adt_u32List_elem_delete(pIter);
+      self->s32Length--;
+      adt_u32List_elem_delete(self->pPool, pIter);
    }
 }
 
@@ -603,26 +992,21 @@ adt_u32List_elem_t* adt_u32List_find(const adt_u32List_t *self, uint32_t item)
 
 int32_t adt_u32List_length(const adt_u32List_t *self)
 {
-   int32_t result=0;
    if (self != 0)
    {
-      adt_u32List_elem_t *iter = self->pFirst;
-      while(iter != 0)
-      {
-         ++result;
-         iter = iter->pNext;
-      }
+      return self->s32Length;
    }
-   return result;
+   return 0;
 }
 
 void adt_u32List_clear(adt_u32List_t *self)
 {
    if (self != 0)
    {
-      adt_u32List_destroy(self);
+      adt_u32List_free_elems(self);
       self->pFirst = 0;
       self->pLast = 0;
+      self->s32Length = 0;
    }
 }
 
@@ -638,9 +1022,9 @@ void  adt_list_elem_create(adt_list_elem_t *self, void *pItem, adt_list_elem_t *
    }
 }
 
-adt_list_elem_t*  adt_list_elem_new(void *pItem, adt_list_elem_t *pNext, adt_list_elem_t *pPrev)
+adt_list_elem_t*  adt_list_elem_new(adt_pool_t *pPool, void *pItem, adt_list_elem_t *pNext, adt_list_elem_t *pPrev)
 {
-   adt_list_elem_t *self = (adt_list_elem_t*) malloc(sizeof(adt_list_elem_t));
+   adt_list_elem_t *self = (pPool != 0)? (adt_list_elem_t*) adt_pool_alloc(pPool) : (adt_list_elem_t*) malloc(sizeof(adt_list_elem_t));
    if (self != 0)
    {
       adt_list_elem_create(self,pItem,pNext,pPrev);
@@ -652,14 +1036,168 @@ adt_list_elem_t*  adt_list_elem_new(void *pItem, adt_list_elem_t *pNext, adt_lis
    return self;
 }
 
-void adt_list_elem_delete(adt_list_elem_t *self)
+void adt_list_elem_delete(adt_pool_t *pPool, adt_list_elem_t *self)
 {
    if (self != 0)
    {
-      free(self);
+      if (pPool != 0)
+      {
+         adt_pool_free(pPool, self);
+      }
+      else
+      {
+         free(self);
+      }
    }
 }
 
+/**
+ * Calls the destructor (if enabled) on all items and frees all nodes. Does not reset pFirst/pLast.
+ */
+static void  adt_list_free_elems(adt_list_t *self)
+{
+   adt_list_elem_t *iter = self->pFirst;
+   void (*destructor)(void*) = (void (*)(void*)) 0;
+   if ( (self->destructorEnable != false) && (self->pDestructor != 0) )
+   {
+      destructor = self->pDestructor;
+   }
+   while( iter != 0 )
+   {
+      adt_list_elem_t *pNext = iter->pNext;
+      if (destructor != 0)
+      {
+         destructor(iter->pItem);
+      }
+      adt_list_elem_delete(self->pPool, iter);
+      iter=pNext;
+   }
+}
+
+/**
+ * Adds pElem to the index of self (if enabled). pElem becomes the element returned by adt_list_find for its item.
+ */
+static adt_error_t adt_list_index_add(adt_list_t *self, adt_list_elem_t *pElem)
+{
+   if (self->pIndex != 0)
+   {
+      adt_list_index_entry_t *pEntry = adt_list_item_map_get(&self->pIndex->items, pElem->pItem);
+      if (pEntry != 0)
+      {
+         adt_list_link_map_t *pLinks = &self->pIndex->links;
+         adt_list_index_link_t link;
+         //reserve both links up front so the chain is never left half updated
+         if (adt_list_link_map_reserve(pLinks, pLinks->u32Size + 2u) != ADT_NO_ERROR)
+         {
+            return ADT_MEM_ERROR;
+         }
+         if (pEntry->s32Count == 1)
+         {
+            link.pOlder = (adt_list_elem_t*) 0;
+            link.pNewer = pElem;
+            (void) adt_list_link_map_set(pLinks, pEntry->pElem, link);
+         }
+         else
+         {
+            adt_list_link_map_get(pLinks, pEntry->pElem)->pNewer = pElem;
+         }
+         link.pOlder = pEntry->pElem;
+         link.pNewer = (adt_list_elem_t*) 0;
+         (void) adt_list_link_map_set(pLinks, pElem, link);
+         pEntry->pElem = pElem;
+         pEntry->s32Count++;
+      }
+      else
+      {
+         adt_list_index_entry_t entry;
+         entry.pElem = pElem;
+         entry.s32Count = 1;
+         return adt_list_item_map_set(&self->pIndex->items, pElem->pItem, entry);
+      }
+   }
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Removes pElem from the index of self (if enabled) in O(1) on average. When pElem was the element returned by
+ * adt_list_find for its item, the element indexed before it takes its place.
+ */
+static void adt_list_index_del(adt_list_t *self, adt_list_elem_t *pElem)
+{
+   if (self->pIndex != 0)
+   {
+      adt_list_index_entry_t *pEntry = adt_list_item_map_get(&self->pIndex->items, pElem->pItem);
+      assert(pEntry != 0);
+      if (--pEntry->s32Count == 0)
+      {
+         (void) adt_list_item_map_remove(&self->pIndex->items, pElem->pItem);
+      }
+      else
+      {
+         adt_list_link_map_t *pLinks = &self->pIndex->links;
+         adt_list_index_link_t *pLink = adt_list_link_map_get(pLinks, pElem);
+         adt_list_index_link_t link;
+         assert(pLink != 0);
+         link = *pLink;
+         (void) adt_list_link_map_remove(pLinks, pElem);
+         if (link.pOlder != 0)
+         {
+            adt_list_link_map_get(pLinks, link.pOlder)->pNewer = link.pNewer;
+         }
+         if (link.pNewer != 0)
+         {
+            adt_list_link_map_get(pLinks, link.pNewer)->pOlder = link.pOlder;
+         }
+         else
+         {
+            pEntry->pElem = link.pOlder; //pElem was the newest element
+         }
+         if (pEntry->s32Count == 1)
+         {
+            (void) adt_list_link_map_remove(pLinks, pEntry->pElem); //a single element needs no link
+         }
+      }
+   }
+}
+
+static void adt_list_index_delete(adt_list_index_t *pIndex)
+{
+   adt_list_item_map_destroy(&pIndex->items);
+   adt_list_link_map_destroy(&pIndex->links);
+   free(pIndex);
+}
+
+/**
+ * Merges two sorted runs (NULL-terminated through pNext) into one. Elements of pLeft come first among equal elements.
+ */
+static adt_list_elem_t* adt_list_merge_runs(adt_list_elem_t *pLeft, adt_list_elem_t *pRight, adt_vlt_func_t *vlt, bool reverse, adt_error_t *pResult)
+{
+   adt_list_elem_t *pHead = (adt_list_elem_t*) 0;
+   adt_list_elem_t **ppTail = &pHead;
+   while ( (pLeft != 0) && (pRight != 0) )
+   {
+      int isBefore = reverse? vlt(pLeft->pItem, pRight->pItem) : vlt(pRight->pItem, pLeft->pItem);
+      if (isBefore < 0)
+      {
+         *pResult = ADT_OBJECT_COMPARE_ERROR;
+         isBefore = 0;
+      }
+      if (isBefore != 0)
+      {
+         *ppTail = pRight;
+         pRight = pRight->pNext;
+      }
+      else
+      {
+         *ppTail = pLeft;
+         pLeft = pLeft->pNext;
+      }
+      ppTail = &(*ppTail)->pNext;
+   }
+   *ppTail = (pLeft != 0)? pLeft : pRight;
+   return pHead;
+}
+
 static void  adt_u32List_elem_create(adt_u32List_elem_t *self, uint32_t item, adt_u32List_elem_t *pNext, adt_u32List_elem_t *pPrev)
 {
    if (self != 0)
@@ -670,9 +1208,9 @@ static void  adt_u32List_elem_create(adt_u32List_elem_t *self, uint32_t item, ad
    }
 }
 
-static adt_u32List_elem_t*  adt_u32List_elem_new(uint32_t item, adt_u32List_elem_t *pNext, adt_u32List_elem_t *pPrev)
+static adt_u32List_elem_t*  adt_u32List_elem_new(adt_pool_t *pPool, uint32_t item, adt_u32List_elem_t *pNext, adt_u32List_elem_t *pPrev)
 {
-   adt_u32List_elem_t *self = (adt_u32List_elem_t*) malloc(sizeof(adt_u32List_elem_t));
+   adt_u32List_elem_t *self = (pPool != 0)? (adt_u32List_elem_t*) adt_pool_alloc(pPool) : (adt_u32List_elem_t*) malloc(sizeof(adt_u32List_elem_t));
    if (self != 0)
    {
       adt_u32List_elem_create(self,item,pNext,pPrev);
@@ -684,10 +1222,31 @@ static adt_u32List_elem_t*  adt_u32List_elem_new(uint32_t item, adt_u32List_elem
    return self;
 }
 
-static void  adt_u32List_elem_delete(adt_u32List_elem_t *self)
+static void  adt_u32List_elem_delete(adt_pool_t *pPool, adt_u32List_elem_t *self)
 {
    if (self != 0)
    {
-      free(self);
+      if (pPool != 0)
+      {
+         adt_pool_free(pPool, self);
+      }
+      else
+      {
+         free(self);
+      }
+   }
+}
+
+/**
+ * Frees all nodes. Does not reset pFirst/pLast.
+ */
+static void  adt_u32List_free_elems(adt_u32List_t *self)
+{
+   adt_u32List_elem_t *iter = self->pFirst;
+   while( iter != 0 )
+   {
+      adt_u32List_elem_t *pNext = iter->pNext;
+      adt_u32List_elem_delete(self->pPool, iter);
+      iter=pNext;
    }
 }
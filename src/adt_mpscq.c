@@ -0,0 +1,248 @@
+/*****************************************************************************
+* \file      adt_mpscq.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Lock-free intrusive multi-producer single-consumer queue
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <malloc.h>
+#include <errno.h>
+#include "adt_mpscq.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#if (ADT_ATOMICS_ENABLE)
+#define LOAD_RELAXED(obj)        atomic_load_explicit(&(obj), memory_order_relaxed)
+#define LOAD_ACQUIRE(obj)        atomic_load_explicit(&(obj), memory_order_acquire)
+#define STORE_RELAXED(obj, val)  atomic_store_explicit(&(obj), (val), memory_order_relaxed)
+#define STORE_RELEASE(obj, val)  atomic_store_explicit(&(obj), (val), memory_order_release)
+#define EXCHANGE(obj, val)       atomic_exchange_explicit(&(obj), (val), memory_order_acq_rel)
+#else
+#define LOAD_RELAXED(obj)        (obj)
+#define LOAD_ACQUIRE(obj)        (obj)
+#define STORE_RELAXED(obj, val)  ((obj) = (val))
+#define STORE_RELEASE(obj, val)  ((obj) = (val))
+#define EXCHANGE(obj, val)       adt_mpscq_exchange(&(obj), (val))
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+#if (!ADT_ATOMICS_ENABLE)
+static adt_mpscq_node_t* adt_mpscq_exchange(adt_mpscq_node_t **ppObj, adt_mpscq_node_t *pVal);
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+void adt_mpscq_create(adt_mpscq_t *self)
+{
+   if (self != 0)
+   {
+      STORE_RELAXED(self->stub.pNext, (adt_mpscq_node_t*) 0);
+      STORE_RELAXED(self->pHead, &self->stub);
+      self->pTail = &self->stub;
+   }
+}
+
+/**
+ * The queue does not own its elements, any elements still in the queue are left untouched
+ */
+void adt_mpscq_destroy(adt_mpscq_t *self)
+{
+   adt_mpscq_create(self);
+}
+
+adt_mpscq_t* adt_mpscq_new(void)
+{
+   adt_mpscq_t *self = (adt_mpscq_t*) malloc(sizeof(adt_mpscq_t));
+   if (self != 0)
+   {
+      adt_mpscq_create(self);
+   }
+   else
+   {
+      errno = ENOMEM;
+   }
+   return self;
+}
+
+void adt_mpscq_delete(adt_mpscq_t *self)
+{
+   if (self != 0)
+   {
+      adt_mpscq_destroy(self);
+      free(self);
+   }
+}
+
+void adt_mpscq_vdelete(void *arg)
+{
+   adt_mpscq_delete((adt_mpscq_t*) arg);
+}
+
+/**
+ * Adds pNode to the queue. Can be called from any thread, pNode must not already be in a queue.
+ */
+void adt_mpscq_push(adt_mpscq_t *self, adt_mpscq_node_t *pNode)
+{
+   if ( (self != 0) && (pNode != 0) )
+   {
+      adt_mpscq_node_t *pPrev;
+      STORE_RELAXED(pNode->pNext, (adt_mpscq_node_t*) 0);
+      pPrev = EXCHANGE(self->pHead, pNode);
+      //until this store the consumer cannot see pNode (or anything pushed after it)
+      STORE_RELEASE(pPrev->pNext, pNode);
+   }
+}
+
+/**
+ * Removes and returns the oldest node, or NULL when the queue is empty (or the oldest push is still in progress).
+ * Consumer thread only.
+ */
+adt_mpscq_node_t* adt_mpscq_pop(adt_mpscq_t *self)
+{
+   adt_mpscq_node_t *pTail;
+   adt_mpscq_node_t *pNext;
+   if (self == 0)
+   {
+      return (adt_mpscq_node_t*) 0;
+   }
+   pTail = self->pTail;
+   pNext = LOAD_ACQUIRE(pTail->pNext);
+   if (pTail == &self->stub)
+   {
+      if (pNext == 0)
+      {
+         return (adt_mpscq_node_t*) 0;
+      }
+      //skip the stub
+      self->pTail = pNext;
+      pTail = pNext;
+      pNext = LOAD_ACQUIRE(pNext->pNext);
+   }
+   if (pNext != 0)
+   {
+      self->pTail = pNext;
+      return pTail;
+   }
+   if (pTail != LOAD_ACQUIRE(self->pHead))
+   {
+      return (adt_mpscq_node_t*) 0; //a producer has exchanged pHead but not yet linked its node after pTail
+   }
+   //pTail is the last node, push the stub behind it so pTail can be handed out
+   adt_mpscq_push(self, &self->stub);
+   pNext = LOAD_ACQUIRE(pTail->pNext);
+   if (pNext != 0)
+   {
+      self->pTail = pNext;
+      return pTail;
+   }
+   return (adt_mpscq_node_t*) 0;
+}
+
+/**
+ * Removes the nodes pushed before this call and returns them as a NULL-terminated chain in FIFO order.
+ * A push that is still in progress may be left for the next call. Use adt_mpscq_node_next to walk the chain.
+ * Consumer thread only.
+ */
+adt_mpscq_node_t* adt_mpscq_pop_all(adt_mpscq_t *self)
+{
+   adt_mpscq_node_t *pFirst = (adt_mpscq_node_t*) 0;
+   adt_mpscq_node_t *pLast = (adt_mpscq_node_t*) 0;
+   adt_mpscq_node_t *pNode;
+   adt_mpscq_node_t *pHead;
+   bool isStubHead;
+   if (self == 0)
+   {
+      return (adt_mpscq_node_t*) 0;
+   }
+   //stop at the newest node of the snapshot so a steady stream of pushes cannot keep the consumer here.
+   //pop never returns the stub, when it is the newest node stop once the nodes ahead of it have been taken
+   pHead = LOAD_ACQUIRE(self->pHead);
+   isStubHead = (bool) (pHead == &self->stub);
+   while ( !(isStubHead && (self->pTail == &self->stub)) && ((pNode = adt_mpscq_pop(self)) != 0) )
+   {
+      //popped nodes belong to the consumer, their links can be reused for the chain
+      if (pLast != 0)
+      {
+         STORE_RELAXED(pLast->pNext, pNode);
+      }
+      else
+      {
+         pFirst = pNode;
+      }
+      pLast = pNode;
+      if (pNode == pHead)
+      {
+         break;
+      }
+   }
+   if (pLast != 0)
+   {
+      STORE_RELAXED(pLast->pNext, (adt_mpscq_node_t*) 0);
+   }
+   return pFirst;
+}
+
+/**
+ * Returns the node after pNode in a chain returned by adt_mpscq_pop_all
+ */
+adt_mpscq_node_t* adt_mpscq_node_next(const adt_mpscq_node_t *pNode)
+{
+   if (pNode != 0)
+   {
+      return LOAD_RELAXED(((adt_mpscq_node_t*) pNode)->pNext);
+   }
+   return (adt_mpscq_node_t*) 0;
+}
+
+/**
+ * Consumer thread only. Returns true when pop would return NULL.
+ */
+bool adt_mpscq_is_empty(adt_mpscq_t *self)
+{
+   if (self != 0)
+   {
+      adt_mpscq_node_t *pTail = self->pTail;
+      return (bool) ( (pTail == &self->stub) && (LOAD_ACQUIRE(pTail->pNext) == 0) );
+   }
+   return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+#if (!ADT_ATOMICS_ENABLE)
+static adt_mpscq_node_t* adt_mpscq_exchange(adt_mpscq_node_t **ppObj, adt_mpscq_node_t *pVal)
+{
+   adt_mpscq_node_t *pOld = *ppObj;
+   *ppObj = pVal;
+   return pOld;
+}
+#endif
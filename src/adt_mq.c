@@ -0,0 +1,419 @@
+/*****************************************************************************
+* \file      adt_mq.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Relaxed concurrent priority queue (MultiQueue)
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <malloc.h>
+#include "adt_mq.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#if (ADT_THREADS_ENABLE)
+# ifdef _MSC_VER
+#  define THREAD_LOCAL __declspec(thread)
+# else
+#  define THREAD_LOCAL __thread
+# endif
+#else
+# define THREAD_LOCAL
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static adt_mq_queue_t* adt_mq_queue(const adt_mq_t *self, int32_t s32Index);
+static int32_t adt_mq_random_index(const adt_mq_t *self);
+static adt_mq_queue_t* adt_mq_random_queue(const adt_mq_t *self);
+static bool adt_mq_trylock(adt_mq_queue_t *pQueue);
+static void adt_mq_lock(adt_mq_queue_t *pQueue);
+static void adt_mq_unlock(adt_mq_queue_t *pQueue);
+static bool adt_mq_is_before(const adt_mq_t *self, const adt_mq_queue_t *pQueue, const adt_mq_queue_t *pOther);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static THREAD_LOCAL uint64_t m_u64RandState = 0u; //per-thread state of random queue selection
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * s32NumQueues is typically ADT_MQ_QUEUES_PER_THREAD times the number of threads using the queue.
+ */
+adt_error_t adt_mq_create(adt_mq_t *self, adt_heap_family family, int32_t s32NumQueues)
+{
+   uint32_t u32Stride;
+   int32_t i;
+   if ( (self == 0) || (s32NumQueues < 1) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   u32Stride = (uint32_t) ((sizeof(adt_mq_queue_t) + ADT_MQ_CACHE_LINE_SIZE - 1) & ~((size_t) ADT_MQ_CACHE_LINE_SIZE - 1));
+   if ( (uint32_t) s32NumQueues > ((UINT32_MAX - ADT_MQ_CACHE_LINE_SIZE) / u32Stride) )
+   {
+      return ADT_LENGTH_ERROR;
+   }
+   self->pAlloc = malloc((size_t) u32Stride * (size_t) s32NumQueues + ADT_MQ_CACHE_LINE_SIZE - 1);
+   if (self->pAlloc == 0)
+   {
+      return ADT_MEM_ERROR;
+   }
+   //separate queues by whole cache lines so that threads working on neighbouring queues do not share lines
+   self->pQueues = (uint8_t*) (((uintptr_t) self->pAlloc + ADT_MQ_CACHE_LINE_SIZE - 1) & ~((uintptr_t) ADT_MQ_CACHE_LINE_SIZE - 1));
+   self->u32Stride = u32Stride;
+   self->s32NumQueues = s32NumQueues;
+   self->s32NumSamples = ADT_MQ_DEFAULT_SAMPLES;
+   self->family = family;
+   for (i = 0; i < s32NumQueues; i++)
+   {
+      adt_mq_queue_t *pQueue = adt_mq_queue(self, i);
+#if (ADT_THREADS_ENABLE)
+      if (pthread_mutex_init(&pQueue->lock, (const pthread_mutexattr_t*) 0) != 0)
+      {
+         while (i > 0)
+         {
+            pQueue = adt_mq_queue(self, --i);
+            pthread_mutex_destroy(&pQueue->lock);
+            adt_pq_destroy(&pQueue->pq);
+         }
+         free(self->pAlloc);
+         self->pAlloc = (void*) 0;
+         self->pQueues = (uint8_t*) 0;
+         self->s32NumQueues = 0;
+         return ADT_MEM_ERROR;
+      }
+#endif
+      adt_pq_create(&pQueue->pq, family);
+   }
+   return ADT_NO_ERROR;
+}
+
+void adt_mq_destroy(adt_mq_t *self)
+{
+   if ( (self != 0) && (self->pAlloc != 0) )
+   {
+      int32_t i;
+      for (i = 0; i < self->s32NumQueues; i++)
+      {
+         adt_mq_queue_t *pQueue = adt_mq_queue(self, i);
+#if (ADT_THREADS_ENABLE)
+         pthread_mutex_destroy(&pQueue->lock);
+#endif
+         adt_pq_destroy(&pQueue->pq);
+      }
+      free(self->pAlloc);
+      self->pAlloc = (void*) 0;
+      self->pQueues = (uint8_t*) 0;
+      self->s32NumQueues = 0;
+   }
+}
+
+adt_mq_t* adt_mq_new(adt_heap_family family, int32_t s32NumQueues)
+{
+   adt_mq_t *self = (adt_mq_t*) malloc(sizeof(adt_mq_t));
+   if (self != 0)
+   {
+      if (adt_mq_create(self, family, s32NumQueues) != ADT_NO_ERROR)
+      {
+         free(self);
+         self = (adt_mq_t*) 0;
+      }
+   }
+   return self;
+}
+
+void adt_mq_delete(adt_mq_t *self)
+{
+   if (self != 0)
+   {
+      adt_mq_destroy(self);
+      free(self);
+   }
+}
+
+void adt_mq_vdelete(void *arg)
+{
+   adt_mq_delete((adt_mq_t*) arg);
+}
+
+/**
+ * Sets the number of randomly chosen queues compared by adt_mq_pop (1 to ADT_MQ_MAX_SAMPLES).
+ * One sample gives the weakest ordering, the default of two is the usual MultiQueue trade-off.
+ * Must not be called while other threads use the queue.
+ */
+adt_error_t adt_mq_set_samples(adt_mq_t *self, int32_t s32NumSamples)
+{
+   if ( (self == 0) || (s32NumSamples < 1) || (s32NumSamples > ADT_MQ_MAX_SAMPLES) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   self->s32NumSamples = s32NumSamples;
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Reserves room for s32Len elements in each queue so that pushing does not allocate memory until a queue grows
+ * beyond s32Len elements.
+ */
+adt_error_t adt_mq_reserve(adt_mq_t *self, int32_t s32Len)
+{
+   int32_t i;
+   if ( (self == 0) || (self->pAlloc == 0) || (s32Len < 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   for (i = 0; i < self->s32NumQueues; i++)
+   {
+      adt_mq_queue_t *pQueue = adt_mq_queue(self, i);
+      adt_error_t result;
+      adt_mq_lock(pQueue);
+      result = adt_pq_reserve(&pQueue->pq, s32Len);
+      adt_mq_unlock(pQueue);
+      if (result != ADT_NO_ERROR)
+      {
+         return result;
+      }
+   }
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Adds the element to a random queue. When the lock of the chosen queue is taken another queue is tried instead
+ * of waiting.
+ */
+adt_error_t adt_mq_push(adt_mq_t *self, void *pItem, uint64_t u64Priority)
+{
+   adt_mq_queue_t *pQueue;
+   adt_error_t result;
+   int32_t i;
+   if ( (self == 0) || (self->pAlloc == 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   pQueue = adt_mq_random_queue(self);
+   for (i = 1; !adt_mq_trylock(pQueue); i++)
+   {
+      if (i >= ADT_MQ_LOCK_ATTEMPTS)
+      {
+         adt_mq_lock(pQueue);
+         break;
+      }
+      pQueue = adt_mq_random_queue(self);
+   }
+   result = adt_pq_push(&pQueue->pq, pItem, u64Priority);
+   adt_mq_unlock(pQueue);
+   return result;
+}
+
+/**
+ * Removes the top element of the best of s32NumSamples randomly chosen queues. Queues whose lock is taken are
+ * skipped. When the sampled queues are empty all queues are searched, so ADT_LENGTH_ERROR is only returned when
+ * every queue was found empty.
+ */
+adt_error_t adt_mq_pop(adt_mq_t *self, adt_pq_elem_t *pElem)
+{
+   adt_mq_queue_t *pLocked[ADT_MQ_MAX_SAMPLES];
+   int32_t s32Attempt;
+   int32_t s32Start;
+   int32_t i;
+   if ( (self == 0) || (self->pAlloc == 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   for (s32Attempt = 0; s32Attempt < ADT_MQ_LOCK_ATTEMPTS; s32Attempt++)
+   {
+      adt_mq_queue_t *pBest = (adt_mq_queue_t*) 0;
+      int32_t s32NumLocked = 0;
+      for (i = 0; i < self->s32NumSamples; i++)
+      {
+         adt_mq_queue_t *pQueue = adt_mq_random_queue(self);
+         bool isSampled = false;
+         int32_t j;
+         //without threads the same queue can be sampled twice since trylock always succeeds
+         for (j = 0; j < s32NumLocked; j++)
+         {
+            isSampled = isSampled || (pLocked[j] == pQueue);
+         }
+         if ( (isSampled == false) && adt_mq_trylock(pQueue) )
+         {
+            pLocked[s32NumLocked++] = pQueue;
+            if ( (pQueue->pq.s32CurLen > 0) && ( (pBest == 0) || adt_mq_is_before(self, pQueue, pBest) ) )
+            {
+               pBest = pQueue;
+            }
+         }
+      }
+      if (pBest != 0)
+      {
+         adt_pq_pop(&pBest->pq, pElem);
+      }
+      for (i = 0; i < s32NumLocked; i++)
+      {
+         adt_mq_unlock(pLocked[i]);
+      }
+      if (pBest != 0)
+      {
+         return ADT_NO_ERROR;
+      }
+      if (s32NumLocked > 0)
+      {
+         break; //sampled queues are empty, the whole structure is probably close to empty
+      }
+   }
+   s32Start = adt_mq_random_index(self);
+   for (i = 0; i < self->s32NumQueues; i++)
+   {
+      adt_mq_queue_t *pQueue = adt_mq_queue(self, (s32Start + i) % self->s32NumQueues);
+      adt_mq_lock(pQueue);
+      if (pQueue->pq.s32CurLen > 0)
+      {
+         adt_pq_pop(&pQueue->pq, pElem);
+         adt_mq_unlock(pQueue);
+         return ADT_NO_ERROR;
+      }
+      adt_mq_unlock(pQueue);
+   }
+   return ADT_LENGTH_ERROR;
+}
+
+/**
+ * Returns approximate number of elements. The result may already be outdated when other threads use the queue.
+ */
+int32_t adt_mq_length(adt_mq_t *self)
+{
+   int32_t s32Len = 0;
+   if ( (self != 0) && (self->pAlloc != 0) )
+   {
+      int32_t i;
+      for (i = 0; i < self->s32NumQueues; i++)
+      {
+         adt_mq_queue_t *pQueue = adt_mq_queue(self, i);
+         adt_mq_lock(pQueue);
+         s32Len += adt_pq_length(&pQueue->pq);
+         adt_mq_unlock(pQueue);
+      }
+   }
+   return s32Len;
+}
+
+int32_t adt_mq_num_queues(const adt_mq_t *self)
+{
+   if (self != 0)
+   {
+      return self->s32NumQueues;
+   }
+   return 0;
+}
+
+void adt_mq_clear(adt_mq_t *self)
+{
+   if ( (self != 0) && (self->pAlloc != 0) )
+   {
+      int32_t i;
+      for (i = 0; i < self->s32NumQueues; i++)
+      {
+         adt_mq_queue_t *pQueue = adt_mq_queue(self, i);
+         adt_mq_lock(pQueue);
+         adt_pq_clear(&pQueue->pq);
+         adt_mq_unlock(pQueue);
+      }
+   }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static adt_mq_queue_t* adt_mq_queue(const adt_mq_t *self, int32_t s32Index)
+{
+   return (adt_mq_queue_t*) (self->pQueues + ((size_t) self->u32Stride * (size_t) s32Index));
+}
+
+/**
+ * xorshift64* with per-thread state. The state is seeded from the address of the thread-local variable,
+ * which is different in each thread.
+ */
+static int32_t adt_mq_random_index(const adt_mq_t *self)
+{
+   uint64_t x = m_u64RandState;
+   if (x == 0u)
+   {
+      x = ((uint64_t) (uintptr_t) &m_u64RandState * 0x9E3779B97F4A7C15ull) | 1u;
+   }
+   x ^= x >> 12;
+   x ^= x << 25;
+   x ^= x >> 27;
+   m_u64RandState = x;
+   //map upper 32 bits of the output to [0, s32NumQueues) without division
+   return (int32_t) ((((x * 0x2545F4914F6CDD1Dull) >> 32) * (uint64_t) self->s32NumQueues) >> 32);
+}
+
+static adt_mq_queue_t* adt_mq_random_queue(const adt_mq_t *self)
+{
+   return adt_mq_queue(self, adt_mq_random_index(self));
+}
+
+static bool adt_mq_trylock(adt_mq_queue_t *pQueue)
+{
+#if (ADT_THREADS_ENABLE)
+   return (pthread_mutex_trylock(&pQueue->lock) == 0);
+#else
+   (void) pQueue;
+   return true;
+#endif
+}
+
+static void adt_mq_lock(adt_mq_queue_t *pQueue)
+{
+#if (ADT_THREADS_ENABLE)
+   pthread_mutex_lock(&pQueue->lock);
+#else
+   (void) pQueue;
+#endif
+}
+
+static void adt_mq_unlock(adt_mq_queue_t *pQueue)
+{
+#if (ADT_THREADS_ENABLE)
+   pthread_mutex_unlock(&pQueue->lock);
+#else
+   (void) pQueue;
+#endif
+}
+
+/**
+ * Returns true when the top element of pQueue comes before the top element of pOther. Both queues must be non-empty.
+ */
+static bool adt_mq_is_before(const adt_mq_t *self, const adt_mq_queue_t *pQueue, const adt_mq_queue_t *pOther)
+{
+   uint64_t a = pQueue->pq.pElems[0].u64Priority;
+   uint64_t b = pOther->pq.pElems[0].u64Priority;
+   return (self->family == ADT_MIN_HEAP) ? (a < b) : (a > b);
+}
@@ -0,0 +1,431 @@
+/*****************************************************************************
+* \file      adt_pairheap.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Pairing heap with O(1) insert and meld
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <malloc.h>
+#include "adt_pairheap.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static bool adt_pairheap_is_before(const adt_pairheap_t *self, uint64_t a, uint64_t b);
+static adt_pairheap_node_t* adt_pairheap_link(const adt_pairheap_t *self, adt_pairheap_node_t *pFirst, adt_pairheap_node_t *pSecond);
+static void adt_pairheap_cut(adt_pairheap_node_t *pNode);
+static adt_pairheap_node_t* adt_pairheap_merge_pairs(const adt_pairheap_t *self, adt_pairheap_node_t *pFirst);
+static void adt_pairheap_free_nodes(adt_pairheap_t *self);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Creates a heap which allocates nodes from its own pool
+ */
+adt_error_t adt_pairheap_create(adt_pairheap_t *self, adt_heap_family family)
+{
+   if (self == 0)
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   self->pPool = adt_pool_new((uint32_t) sizeof(adt_pairheap_node_t), 0);
+   if (self->pPool == 0)
+   {
+      return ADT_MEM_ERROR;
+   }
+   self->pRoot = (adt_pairheap_node_t*) 0;
+   self->s32CurLen = 0;
+   self->isPoolOwner = true;
+   self->family = family;
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Creates a heap which allocates nodes from pPool. The pool must have an element size of at least
+ * sizeof(adt_pairheap_node_t) and must outlive the heap.
+ */
+adt_error_t adt_pairheap_create_shared(adt_pairheap_t *self, adt_heap_family family, adt_pool_t *pPool)
+{
+   if ( (self == 0) || (pPool == 0) || (adt_pool_elem_size(pPool) < (uint32_t) sizeof(adt_pairheap_node_t)) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   self->pPool = pPool;
+   self->pRoot = (adt_pairheap_node_t*) 0;
+   self->s32CurLen = 0;
+   self->isPoolOwner = false;
+   self->family = family;
+   return ADT_NO_ERROR;
+}
+
+void adt_pairheap_destroy(adt_pairheap_t *self)
+{
+   if ( (self != 0) && (self->pPool != 0) )
+   {
+      if (self->isPoolOwner)
+      {
+         //all nodes are returned to the system with the pool
+         adt_pool_delete(self->pPool);
+      }
+      else
+      {
+         adt_pairheap_free_nodes(self);
+      }
+      self->pPool = (adt_pool_t*) 0;
+      self->pRoot = (adt_pairheap_node_t*) 0;
+      self->s32CurLen = 0;
+   }
+}
+
+adt_pairheap_t* adt_pairheap_new(adt_heap_family family)
+{
+   adt_pairheap_t *self = (adt_pairheap_t*) malloc(sizeof(adt_pairheap_t));
+   if (self != 0)
+   {
+      if (adt_pairheap_create(self, family) != ADT_NO_ERROR)
+      {
+         free(self);
+         self = (adt_pairheap_t*) 0;
+      }
+   }
+   return self;
+}
+
+void adt_pairheap_delete(adt_pairheap_t *self)
+{
+   if (self != 0)
+   {
+      adt_pairheap_destroy(self);
+      free(self);
+   }
+}
+
+void adt_pairheap_vdelete(void *arg)
+{
+   adt_pairheap_delete((adt_pairheap_t*) arg);
+}
+
+/**
+ * O(1) insert. When ppNode is not NULL it receives the node (handle) of the new element.
+ */
+adt_error_t adt_pairheap_push(adt_pairheap_t *self, void *pItem, uint64_t u64Priority, adt_pairheap_node_t **ppNode)
+{
+   adt_pairheap_node_t *pNode;
+   if ( (self == 0) || (self->pPool == 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   pNode = (adt_pairheap_node_t*) adt_pool_alloc(self->pPool);
+   if (pNode == 0)
+   {
+      return ADT_MEM_ERROR;
+   }
+   pNode->pChild = (adt_pairheap_node_t*) 0;
+   pNode->pNext = (adt_pairheap_node_t*) 0;
+   pNode->pPrev = (adt_pairheap_node_t*) 0;
+   pNode->pItem = pItem;
+   pNode->u64Priority = u64Priority;
+   self->pRoot = (self->pRoot == 0) ? pNode : adt_pairheap_link(self, self->pRoot, pNode);
+   self->s32CurLen++;
+   if (ppNode != 0)
+   {
+      *ppNode = pNode;
+   }
+   return ADT_NO_ERROR;
+}
+
+adt_error_t adt_pairheap_pop(adt_pairheap_t *self, adt_pq_elem_t *pElem)
+{
+   if (self == 0)
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (self->pRoot == 0)
+   {
+      return ADT_LENGTH_ERROR;
+   }
+   return adt_pairheap_remove(self, self->pRoot, pElem);
+}
+
+/**
+ * Returns the top node or NULL when the heap is empty
+ */
+const adt_pairheap_node_t* adt_pairheap_peek(const adt_pairheap_t *self)
+{
+   if (self != 0)
+   {
+      return self->pRoot;
+   }
+   return (const adt_pairheap_node_t*) 0;
+}
+
+/**
+ * Moves the element toward the top of the heap: u64Priority must be lower than or equal to the current priority
+ * for ADT_MIN_HEAP and higher than or equal to it for ADT_MAX_HEAP. O(1), the node is cut from its parent and
+ * linked with the root.
+ */
+adt_error_t adt_pairheap_decrease_key(adt_pairheap_t *self, adt_pairheap_node_t *pNode, uint64_t u64Priority)
+{
+   if ( (self == 0) || (pNode == 0) || (self->pRoot == 0) || adt_pairheap_is_before(self, pNode->u64Priority, u64Priority) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   pNode->u64Priority = u64Priority;
+   if (pNode != self->pRoot)
+   {
+      adt_pairheap_cut(pNode);
+      self->pRoot = adt_pairheap_link(self, self->pRoot, pNode);
+   }
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Removes any element from the heap using its node. When pElem is not NULL it receives the removed element.
+ */
+adt_error_t adt_pairheap_remove(adt_pairheap_t *self, adt_pairheap_node_t *pNode, adt_pq_elem_t *pElem)
+{
+   adt_pairheap_node_t *pSubHeap;
+   if ( (self == 0) || (pNode == 0) || (self->pRoot == 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (pElem != 0)
+   {
+      pElem->pItem = pNode->pItem;
+      pElem->u64Priority = pNode->u64Priority;
+   }
+   pSubHeap = adt_pairheap_merge_pairs(self, pNode->pChild);
+   if (pNode == self->pRoot)
+   {
+      self->pRoot = pSubHeap;
+   }
+   else
+   {
+      adt_pairheap_cut(pNode);
+      if (pSubHeap != 0)
+      {
+         self->pRoot = adt_pairheap_link(self, self->pRoot, pSubHeap);
+      }
+   }
+   adt_pool_free(self->pPool, pNode);
+   self->s32CurLen--;
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Moves all elements of src into dst in O(1), leaving src empty. Nodes (handles) of src stay valid and now belong
+ * to dst. When both heaps own their pools the pool of src is merged into the pool of dst (also O(1)).
+ */
+adt_error_t adt_pairheap_meld(adt_pairheap_t *dst, adt_pairheap_t *src)
+{
+   if ( (dst == 0) || (src == 0) || (dst == src) || (dst->pPool == 0) || (src->pPool == 0) ||
+        (dst->family != src->family) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (dst->pPool != src->pPool)
+   {
+      adt_error_t result;
+      if ( (dst->isPoolOwner == false) || (src->isPoolOwner == false) )
+      {
+         return ADT_INVALID_ARGUMENT_ERROR;
+      }
+      result = adt_pool_merge(dst->pPool, src->pPool);
+      if (result != ADT_NO_ERROR)
+      {
+         return result;
+      }
+   }
+   if (src->pRoot != 0)
+   {
+      dst->pRoot = (dst->pRoot == 0) ? src->pRoot : adt_pairheap_link(dst, dst->pRoot, src->pRoot);
+      dst->s32CurLen += src->s32CurLen;
+      src->pRoot = (adt_pairheap_node_t*) 0;
+      src->s32CurLen = 0;
+   }
+   return ADT_NO_ERROR;
+}
+
+int32_t adt_pairheap_length(const adt_pairheap_t *self)
+{
+   if (self != 0)
+   {
+      return self->s32CurLen;
+   }
+   return 0;
+}
+
+bool adt_pairheap_is_empty(const adt_pairheap_t *self)
+{
+   if (self != 0)
+   {
+      return (self->s32CurLen == 0);
+   }
+   return true;
+}
+
+void adt_pairheap_clear(adt_pairheap_t *self)
+{
+   if ( (self != 0) && (self->pPool != 0) )
+   {
+      adt_pairheap_free_nodes(self);
+   }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static bool adt_pairheap_is_before(const adt_pairheap_t *self, uint64_t a, uint64_t b)
+{
+   return (self->family == ADT_MIN_HEAP) ? (a < b) : (a > b);
+}
+
+/**
+ * Links two root nodes (without siblings). The node ordered last becomes the first child of the other node,
+ * which is returned. pFirst wins ties.
+ */
+static adt_pairheap_node_t* adt_pairheap_link(const adt_pairheap_t *self, adt_pairheap_node_t *pFirst, adt_pairheap_node_t *pSecond)
+{
+   adt_pairheap_node_t *pParent = pFirst;
+   adt_pairheap_node_t *pChild = pSecond;
+   if (adt_pairheap_is_before(self, pSecond->u64Priority, pFirst->u64Priority))
+   {
+      pParent = pSecond;
+      pChild = pFirst;
+   }
+   pChild->pPrev = pParent;
+   pChild->pNext = pParent->pChild;
+   if (pParent->pChild != 0)
+   {
+      pParent->pChild->pPrev = pChild;
+   }
+   pParent->pChild = pChild;
+   pParent->pNext = (adt_pairheap_node_t*) 0;
+   pParent->pPrev = (adt_pairheap_node_t*) 0;
+   return pParent;
+}
+
+/**
+ * Detaches a non-root node (with its subtree) from its parent and siblings
+ */
+static void adt_pairheap_cut(adt_pairheap_node_t *pNode)
+{
+   if (pNode->pPrev->pChild == pNode)
+   {
+      pNode->pPrev->pChild = pNode->pNext; //first child, pPrev is the parent
+   }
+   else
+   {
+      pNode->pPrev->pNext = pNode->pNext;
+   }
+   if (pNode->pNext != 0)
+   {
+      pNode->pNext->pPrev = pNode->pPrev;
+   }
+   pNode->pNext = (adt_pairheap_node_t*) 0;
+   pNode->pPrev = (adt_pairheap_node_t*) 0;
+}
+
+/**
+ * Standard two-pass pairing of a sibling list: link siblings in pairs from left to right, then link the pairs
+ * from right to left. Returns the new root (NULL for an empty list).
+ */
+static adt_pairheap_node_t* adt_pairheap_merge_pairs(const adt_pairheap_t *self, adt_pairheap_node_t *pFirst)
+{
+   adt_pairheap_node_t *pPairs = (adt_pairheap_node_t*) 0; //linked pairs in reverse order through pNext
+   adt_pairheap_node_t *pRoot;
+   while (pFirst != 0)
+   {
+      adt_pairheap_node_t *pSecond = pFirst->pNext;
+      adt_pairheap_node_t *pPair;
+      if (pSecond == 0)
+      {
+         pPair = pFirst;
+         pFirst = (adt_pairheap_node_t*) 0;
+      }
+      else
+      {
+         adt_pairheap_node_t *pRest = pSecond->pNext;
+         pFirst->pNext = (adt_pairheap_node_t*) 0;
+         pSecond->pNext = (adt_pairheap_node_t*) 0;
+         pPair = adt_pairheap_link(self, pFirst, pSecond);
+         pFirst = pRest;
+      }
+      pPair->pPrev = (adt_pairheap_node_t*) 0;
+      pPair->pNext = pPairs;
+      pPairs = pPair;
+   }
+   if (pPairs == 0)
+   {
+      return (adt_pairheap_node_t*) 0;
+   }
+   pRoot = pPairs;
+   pPairs = pPairs->pNext;
+   pRoot->pNext = (adt_pairheap_node_t*) 0;
+   while (pPairs != 0)
+   {
+      adt_pairheap_node_t *pNext = pPairs->pNext;
+      pPairs->pNext = (adt_pairheap_node_t*) 0;
+      pRoot = adt_pairheap_link(self, pPairs, pRoot);
+      pPairs = pNext;
+   }
+   return pRoot;
+}
+
+/**
+ * Returns all nodes to the pool in O(n) without recursion, by splicing the children of each visited node into
+ * the list of nodes still to visit.
+ */
+static void adt_pairheap_free_nodes(adt_pairheap_t *self)
+{
+   adt_pairheap_node_t *pNode = self->pRoot;
+   while (pNode != 0)
+   {
+      adt_pairheap_node_t *pNext;
+      if (pNode->pChild != 0)
+      {
+         adt_pairheap_node_t *pLast = pNode->pChild;
+         while (pLast->pNext != 0)
+         {
+            pLast = pLast->pNext;
+         }
+         pLast->pNext = pNode->pNext;
+         pNode->pNext = pNode->pChild;
+      }
+      pNext = pNode->pNext;
+      adt_pool_free(self->pPool, pNode);
+      pNode = pNext;
+   }
+   self->pRoot = (adt_pairheap_node_t*) 0;
+   self->s32CurLen = 0;
+}
@@ -0,0 +1,273 @@
+/*****************************************************************************
+* \file      adt_pool.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Fixed-size element pool (slab allocator with free list)
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <malloc.h>
+#include "adt_pool.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define ELEM_ALIGN 8u
+#define MAX_ELEM_SIZE 0x10000000u
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static adt_error_t adt_pool_add_slab(adt_pool_t *self);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * u32ElemSize is the size of each element in bytes. s32SlabLen is the number of elements allocated at a time,
+ * use 0 for slabs of about ADT_POOL_DEFAULT_SLAB_SIZE bytes. No memory is allocated until the first call to
+ * adt_pool_alloc.
+ */
+adt_error_t adt_pool_create(adt_pool_t *self, uint32_t u32ElemSize, int32_t s32SlabLen)
+{
+   if ( (self == 0) || (u32ElemSize == 0u) || (u32ElemSize > MAX_ELEM_SIZE) || (s32SlabLen < 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   //free elements hold a pointer, all elements are 8-byte aligned
+   if (u32ElemSize < (uint32_t) sizeof(void*))
+   {
+      u32ElemSize = (uint32_t) sizeof(void*);
+   }
+   u32ElemSize = (u32ElemSize + ELEM_ALIGN - 1u) & ~(ELEM_ALIGN - 1u);
+   if (s32SlabLen == 0)
+   {
+      s32SlabLen = (int32_t) (ADT_POOL_DEFAULT_SLAB_SIZE / u32ElemSize);
+   }
+   if (s32SlabLen < ADT_POOL_MIN_SLAB_LEN)
+   {
+      s32SlabLen = ADT_POOL_MIN_SLAB_LEN;
+   }
+   if ( (uint64_t) s32SlabLen * u32ElemSize > (uint64_t) (INT32_MAX - ADT_POOL_CACHE_LINE_SIZE) )
+   {
+      return ADT_LENGTH_ERROR;
+   }
+   self->pFree = (void*) 0;
+   self->pLastFree = (void*) 0;
+   self->pSlabs = (void*) 0;
+   self->pLastSlab = (void*) 0;
+   self->u32ElemSize = u32ElemSize;
+   self->s32SlabLen = s32SlabLen;
+   self->s32NumUsed = 0;
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Frees all slabs. Elements still in use become invalid.
+ */
+void adt_pool_destroy(adt_pool_t *self)
+{
+   if (self != 0)
+   {
+      void *pSlab = self->pSlabs;
+      while (pSlab != 0)
+      {
+         void *pNext = *(void**) pSlab;
+         free(pSlab);
+         pSlab = pNext;
+      }
+      self->pFree = (void*) 0;
+      self->pLastFree = (void*) 0;
+      self->pSlabs = (void*) 0;
+      self->pLastSlab = (void*) 0;
+      self->s32NumUsed = 0;
+   }
+}
+
+adt_pool_t* adt_pool_new(uint32_t u32ElemSize, int32_t s32SlabLen)
+{
+   adt_pool_t *self = (adt_pool_t*) malloc(sizeof(adt_pool_t));
+   if (self != 0)
+   {
+      if (adt_pool_create(self, u32ElemSize, s32SlabLen) != ADT_NO_ERROR)
+      {
+         free(self);
+         self = (adt_pool_t*) 0;
+      }
+   }
+   return self;
+}
+
+void adt_pool_delete(adt_pool_t *self)
+{
+   if (self != 0)
+   {
+      adt_pool_destroy(self);
+      free(self);
+   }
+}
+
+void adt_pool_vdelete(void *arg)
+{
+   adt_pool_delete((adt_pool_t*) arg);
+}
+
+/**
+ * Returns an uninitialized element or NULL when out of memory
+ */
+void* adt_pool_alloc(adt_pool_t *self)
+{
+   void *pElem;
+   if (self == 0)
+   {
+      return (void*) 0;
+   }
+   if ( (self->pFree == 0) && (adt_pool_add_slab(self) != ADT_NO_ERROR) )
+   {
+      return (void*) 0;
+   }
+   pElem = self->pFree;
+   self->pFree = *(void**) pElem;
+   if (self->pFree == 0)
+   {
+      self->pLastFree = (void*) 0;
+   }
+   self->s32NumUsed++;
+   return pElem;
+}
+
+/**
+ * Returns an element to the pool. The element must have been allocated from the same pool (or a pool merged into it).
+ */
+void adt_pool_free(adt_pool_t *self, void *pElem)
+{
+   if ( (self != 0) && (pElem != 0) )
+   {
+      *(void**) pElem = self->pFree;
+      if (self->pFree == 0)
+      {
+         self->pLastFree = pElem;
+      }
+      self->pFree = pElem;
+      self->s32NumUsed--;
+   }
+}
+
+/**
+ * Moves all slabs and free elements of src into dst in O(1). Elements allocated from src can afterwards be freed
+ * to dst. Both pools must have the same element size.
+ */
+adt_error_t adt_pool_merge(adt_pool_t *dst, adt_pool_t *src)
+{
+   if ( (dst == 0) || (src == 0) || (dst == src) || (dst->u32ElemSize != src->u32ElemSize) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (src->pSlabs != 0)
+   {
+      *(void**) src->pLastSlab = dst->pSlabs;
+      if (dst->pSlabs == 0)
+      {
+         dst->pLastSlab = src->pLastSlab;
+      }
+      dst->pSlabs = src->pSlabs;
+   }
+   if (src->pFree != 0)
+   {
+      *(void**) src->pLastFree = dst->pFree;
+      if (dst->pFree == 0)
+      {
+         dst->pLastFree = src->pLastFree;
+      }
+      dst->pFree = src->pFree;
+   }
+   dst->s32NumUsed += src->s32NumUsed;
+   src->pFree = (void*) 0;
+   src->pLastFree = (void*) 0;
+   src->pSlabs = (void*) 0;
+   src->pLastSlab = (void*) 0;
+   src->s32NumUsed = 0;
+   return ADT_NO_ERROR;
+}
+
+int32_t adt_pool_num_used(const adt_pool_t *self)
+{
+   if (self != 0)
+   {
+      return self->s32NumUsed;
+   }
+   return 0;
+}
+
+uint32_t adt_pool_elem_size(const adt_pool_t *self)
+{
+   if (self != 0)
+   {
+      return self->u32ElemSize;
+   }
+   return 0u;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Allocates a new slab and puts its elements on the free list in address order
+ */
+static adt_error_t adt_pool_add_slab(adt_pool_t *self)
+{
+   size_t allocSize = sizeof(void*) + (ADT_POOL_CACHE_LINE_SIZE - 1) + ((size_t) self->u32ElemSize * (size_t) self->s32SlabLen);
+   uint8_t *pSlab = (uint8_t*) malloc(allocSize);
+   uint8_t *pElem;
+   int32_t i;
+   if (pSlab == 0)
+   {
+      return ADT_MEM_ERROR;
+   }
+   //slab header (next slab) is followed by elements starting at the next cache line boundary
+   *(void**) pSlab = (void*) 0;
+   if (self->pLastSlab != 0)
+   {
+      *(void**) self->pLastSlab = pSlab;
+   }
+   else
+   {
+      self->pSlabs = pSlab;
+   }
+   self->pLastSlab = pSlab;
+   pElem = (uint8_t*) (((uintptr_t) pSlab + sizeof(void*) + (ADT_POOL_CACHE_LINE_SIZE - 1)) & ~((uintptr_t) ADT_POOL_CACHE_LINE_SIZE - 1));
+   self->pFree = pElem;
+   for (i = 0; i < (self->s32SlabLen - 1); i++)
+   {
+      *(void**) pElem = pElem + self->u32ElemSize;
+      pElem += self->u32ElemSize;
+   }
+   *(void**) pElem = (void*) 0;
+   self->pLastFree = pElem;
+   return ADT_NO_ERROR;
+}
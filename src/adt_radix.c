@@ -0,0 +1,336 @@
+/*****************************************************************************
+* \file      adt_radix.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     LSD radix sort for integer keys
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <malloc.h>
+#include <string.h>
+#include <stdbool.h>
+#include "adt_radix.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define RADIX_SIZE (((size_t) 1u) << ADT_RADIX_BITS)
+#define RADIX_MASK (RADIX_SIZE - 1u)
+#define RADIX_PASSES_U32 ((32 + ADT_RADIX_BITS - 1) / ADT_RADIX_BITS)
+#define RADIX_PASSES_U64 ((64 + ADT_RADIX_BITS - 1) / ADT_RADIX_BITS)
+#define PREFETCH_DISTANCE 16 //number of elements ahead to prefetch destination slots
+
+#if defined(__GNUC__)
+#define RADIX_PREFETCH_WRITE(addr) __builtin_prefetch((addr), 1)
+#else
+#define RADIX_PREFETCH_WRITE(addr)
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static adt_error_t adt_radix_alloc(size_t keySize, size_t len, size_t numPasses, bool hasValues, void **ppTmpKeys, void ***pppTmpValues, size_t **ppHist);
+static void adt_radix_prefix_sum(size_t *pHist);
+static void adt_radix_insertion_sort_u32(uint32_t *pKeys, void **ppValues, size_t len);
+static void adt_radix_insertion_sort_u64(uint64_t *pKeys, void **ppValues, size_t len);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+adt_error_t adt_radix_sort_u32(uint32_t *pKeys, void **ppValues, size_t len)
+{
+   uint32_t *pTmpKeys;
+   void **ppTmpValues;
+   size_t *pHist;
+   uint32_t *pSrcKeys = pKeys;
+   uint32_t *pDestKeys;
+   void **ppSrcValues = ppValues;
+   void **ppDestValues;
+   size_t i;
+   int pass;
+   adt_error_t result;
+
+   if (pKeys == 0)
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (len < ADT_RADIX_MIN_LEN)
+   {
+      adt_radix_insertion_sort_u32(pKeys, ppValues, len);
+      return ADT_NO_ERROR;
+   }
+   result = adt_radix_alloc(sizeof(uint32_t), len, RADIX_PASSES_U32, ppValues != 0, (void**) &pTmpKeys, &ppTmpValues, &pHist);
+   if (result != ADT_NO_ERROR)
+   {
+      return result;
+   }
+#if (RADIX_PASSES_U32 == 3)
+   for (i = 0; i < len; i++)
+   {
+      uint32_t u32Key = pKeys[i];
+      pHist[u32Key & RADIX_MASK]++;
+      pHist[RADIX_SIZE + ((u32Key >> ADT_RADIX_BITS) & RADIX_MASK)]++;
+      pHist[(2u * RADIX_SIZE) + (u32Key >> (2 * ADT_RADIX_BITS))]++;
+   }
+#else
+   for (i = 0; i < len; i++)
+   {
+      uint32_t u32Key = pKeys[i];
+      for (pass = 0; pass < RADIX_PASSES_U32; pass++)
+      {
+         pHist[(((size_t) pass) * RADIX_SIZE) + ((u32Key >> (pass * ADT_RADIX_BITS)) & RADIX_MASK)]++;
+      }
+   }
+#endif
+   pDestKeys = pTmpKeys;
+   ppDestValues = ppTmpValues;
+   for (pass = 0; pass < RADIX_PASSES_U32; pass++)
+   {
+      size_t *pOffset = &pHist[((size_t) pass) * RADIX_SIZE];
+      int shift = pass * ADT_RADIX_BITS;
+      if (pOffset[(pSrcKeys[0] >> shift) & RADIX_MASK] == len)
+      {
+         continue; //all keys have the same digit
+      }
+      adt_radix_prefix_sum(pOffset);
+      for (i = 0; i < len; i++)
+      {
+         uint32_t u32Key = pSrcKeys[i];
+         size_t dest;
+         if ( (i + PREFETCH_DISTANCE) < len)
+         {
+            RADIX_PREFETCH_WRITE(&pDestKeys[pOffset[(pSrcKeys[i + PREFETCH_DISTANCE] >> shift) & RADIX_MASK]]);
+         }
+         dest = pOffset[(u32Key >> shift) & RADIX_MASK]++;
+         pDestKeys[dest] = u32Key;
+         if (ppSrcValues != 0)
+         {
+            ppDestValues[dest] = ppSrcValues[i];
+         }
+      }
+      {
+         uint32_t *pSwapKeys = pSrcKeys;
+         void **ppSwapValues = ppSrcValues;
+         pSrcKeys = pDestKeys;
+         pDestKeys = pSwapKeys;
+         ppSrcValues = ppDestValues;
+         ppDestValues = ppSwapValues;
+      }
+   }
+   if (pSrcKeys != pKeys)
+   {
+      memcpy(pKeys, pSrcKeys, len * sizeof(uint32_t));
+      if (ppValues != 0)
+      {
+         memcpy(ppValues, ppSrcValues, len * sizeof(void*));
+      }
+   }
+   free(pHist);
+   free(pTmpKeys);
+   if (ppTmpValues != 0)
+   {
+      free(ppTmpValues);
+   }
+   return ADT_NO_ERROR;
+}
+
+adt_error_t adt_radix_sort_u64(uint64_t *pKeys, void **ppValues, size_t len)
+{
+   uint64_t *pTmpKeys;
+   void **ppTmpValues;
+   size_t *pHist;
+   uint64_t *pSrcKeys = pKeys;
+   uint64_t *pDestKeys;
+   void **ppSrcValues = ppValues;
+   void **ppDestValues;
+   size_t i;
+   int pass;
+   adt_error_t result;
+
+   if (pKeys == 0)
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (len < ADT_RADIX_MIN_LEN)
+   {
+      adt_radix_insertion_sort_u64(pKeys, ppValues, len);
+      return ADT_NO_ERROR;
+   }
+   result = adt_radix_alloc(sizeof(uint64_t), len, RADIX_PASSES_U64, ppValues != 0, (void**) &pTmpKeys, &ppTmpValues, &pHist);
+   if (result != ADT_NO_ERROR)
+   {
+      return result;
+   }
+   for (i = 0; i < len; i++)
+   {
+      uint64_t u64Key = pKeys[i];
+      for (pass = 0; pass < RADIX_PASSES_U64; pass++)
+      {
+         pHist[(((size_t) pass) * RADIX_SIZE) + ((size_t) ((u64Key >> (pass * ADT_RADIX_BITS)) & RADIX_MASK))]++;
+      }
+   }
+   pDestKeys = pTmpKeys;
+   ppDestValues = ppTmpValues;
+   for (pass = 0; pass < RADIX_PASSES_U64; pass++)
+   {
+      size_t *pOffset = &pHist[((size_t) pass) * RADIX_SIZE];
+      int shift = pass * ADT_RADIX_BITS;
+      if (pOffset[(size_t) ((pSrcKeys[0] >> shift) & RADIX_MASK)] == len)
+      {
+         continue; //all keys have the same digit
+      }
+      adt_radix_prefix_sum(pOffset);
+      for (i = 0; i < len; i++)
+      {
+         uint64_t u64Key = pSrcKeys[i];
+         size_t dest;
+         if ( (i + PREFETCH_DISTANCE) < len)
+         {
+            RADIX_PREFETCH_WRITE(&pDestKeys[pOffset[(size_t) ((pSrcKeys[i + PREFETCH_DISTANCE] >> shift) & RADIX_MASK)]]);
+         }
+         dest = pOffset[(size_t) ((u64Key >> shift) & RADIX_MASK)]++;
+         pDestKeys[dest] = u64Key;
+         if (ppSrcValues != 0)
+         {
+            ppDestValues[dest] = ppSrcValues[i];
+         }
+      }
+      {
+         uint64_t *pSwapKeys = pSrcKeys;
+         void **ppSwapValues = ppSrcValues;
+         pSrcKeys = pDestKeys;
+         pDestKeys = pSwapKeys;
+         ppSrcValues = ppDestValues;
+         ppDestValues = ppSwapValues;
+      }
+   }
+   if (pSrcKeys != pKeys)
+   {
+      memcpy(pKeys, pSrcKeys, len * sizeof(uint64_t));
+      if (ppValues != 0)
+      {
+         memcpy(ppValues, ppSrcValues, len * sizeof(void*));
+      }
+   }
+   free(pHist);
+   free(pTmpKeys);
+   if (ppTmpValues != 0)
+   {
+      free(ppTmpValues);
+   }
+   return ADT_NO_ERROR;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Allocates temporary key/value buffers and zero-initialized histograms for all passes
+ */
+static adt_error_t adt_radix_alloc(size_t keySize, size_t len, size_t numPasses, bool hasValues, void **ppTmpKeys, void ***pppTmpValues, size_t **ppHist)
+{
+   if (len > (SIZE_MAX / sizeof(uint64_t)))
+   {
+      return ADT_LENGTH_ERROR;
+   }
+   *ppTmpKeys = malloc(len * keySize);
+   *pppTmpValues = hasValues? (void**) malloc(len * sizeof(void*)) : (void**) 0;
+   *ppHist = (size_t*) calloc(numPasses * RADIX_SIZE, sizeof(size_t));
+   if ( (*ppTmpKeys == 0) || (*ppHist == 0) || (hasValues && (*pppTmpValues == 0)) )
+   {
+      if (*ppTmpKeys != 0) free(*ppTmpKeys);
+      if (*pppTmpValues != 0) free(*pppTmpValues);
+      if (*ppHist != 0) free(*ppHist);
+      return ADT_MEM_ERROR;
+   }
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Converts a histogram into exclusive prefix sums (start offset of each bucket)
+ */
+static void adt_radix_prefix_sum(size_t *pHist)
+{
+   size_t sum = 0u;
+   size_t i;
+   for (i = 0; i < RADIX_SIZE; i++)
+   {
+      size_t count = pHist[i];
+      pHist[i] = sum;
+      sum += count;
+   }
+}
+
+static void adt_radix_insertion_sort_u32(uint32_t *pKeys, void **ppValues, size_t len)
+{
+   size_t i;
+   for (i = 1; i < len; i++)
+   {
+      uint32_t u32Key = pKeys[i];
+      void *pValue = (ppValues != 0)? ppValues[i] : (void*) 0;
+      size_t j = i;
+      while ( (j > 0) && (pKeys[j - 1] > u32Key) )
+      {
+         pKeys[j] = pKeys[j - 1];
+         if (ppValues != 0)
+         {
+            ppValues[j] = ppValues[j - 1];
+         }
+         j--;
+      }
+      pKeys[j] = u32Key;
+      if (ppValues != 0)
+      {
+         ppValues[j] = pValue;
+      }
+   }
+}
+
+static void adt_radix_insertion_sort_u64(uint64_t *pKeys, void **ppValues, size_t len)
+{
+   size_t i;
+   for (i = 1; i < len; i++)
+   {
+      uint64_t u64Key = pKeys[i];
+      void *pValue = (ppValues != 0)? ppValues[i] : (void*) 0;
+      size_t j = i;
+      while ( (j > 0) && (pKeys[j - 1] > u64Key) )
+      {
+         pKeys[j] = pKeys[j - 1];
+         if (ppValues != 0)
+         {
+            ppValues[j] = ppValues[j - 1];
+         }
+         j--;
+      }
+      pKeys[j] = u64Key;
+      if (ppValues != 0)
+      {
+         ppValues[j] = pValue;
+      }
+   }
+}
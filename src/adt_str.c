@@ -827,6 +827,25 @@ int adt_str_vlt(const void *a, const void *b)
    return adt_str_lt ((const adt_str_t*) a, (const adt_str_t*) b);
 }
 
+/**
+ * Returns the first 8 bytes of the string as a big-endian number.
+ * Strings shorter than 8 bytes are padded with 0xFF since adt_str_lt places a string before its own prefix.
+ * Byte order is the same as code point order for UTF-8, so the key works for both supported encodings.
+ */
+uint64_t adt_str_prefix_key(const void *pElem, void *arg)
+{
+   const adt_str_t *self = (const adt_str_t*) pElem;
+   uint64_t u64Key = 0u;
+   int32_t i;
+   (void) arg;
+   for (i = 0; i < 8; i++)
+   {
+      uint8_t u8Byte = (i < self->s32Cur)? self->pAlloc[i] : 0xFFu;
+      u64Key = (u64Key << 8) | u8Byte;
+   }
+   return u64Key;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 // PRIVATE FUNCTIONS
 //////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,435 @@
+/*****************************************************************************
+* \file      adt_timerwheel.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Hierarchical timing wheel
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <malloc.h>
+#include "adt_timerwheel.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#if ((ADT_TIMERWHEEL_SLOT_BITS * ADT_TIMERWHEEL_LEVELS) >= 64)
+#error "ADT_TIMERWHEEL_SLOT_BITS * ADT_TIMERWHEEL_LEVELS must be less than 64"
+#endif
+
+#define NUM_WHEEL_SLOTS (ADT_TIMERWHEEL_LEVELS * ADT_TIMERWHEEL_SLOTS)
+#define DUE_SLOT NUM_WHEEL_SLOTS //timers scheduled at an already processed tick
+#define SLOT_MASK ((uint64_t) ADT_TIMERWHEEL_SLOTS - 1u)
+#define LEVEL_SHIFT(level) ((level) * ADT_TIMERWHEEL_SLOT_BITS)
+#define MAX_DELTA ((((uint64_t) 1u) << LEVEL_SHIFT(ADT_TIMERWHEEL_LEVELS)) - 1u)
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static int32_t adt_timerwheel_slot(const adt_timerwheel_t *self, uint64_t u64Expires);
+static void adt_timerwheel_link(adt_timerwheel_t *self, adt_timer_t *pTimer, int32_t s32Slot);
+static void adt_timerwheel_unlink(adt_timerwheel_t *self, adt_timer_t *pTimer);
+static adt_timer_t* adt_timerwheel_detach(adt_timerwheel_t *self, int32_t s32Slot);
+static void adt_timerwheel_cascade(adt_timerwheel_t *self, int32_t s32Slot);
+static bool adt_timerwheel_next_tick(adt_timerwheel_t *self, uint64_t u64Now);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+void adt_timer_create(adt_timer_t *self, void *pItem)
+{
+   if (self != 0)
+   {
+      self->pNext = (adt_timer_t*) 0;
+      self->ppPrev = (adt_timer_t**) 0;
+      self->u64Expires = 0u;
+      self->pItem = pItem;
+      self->s32Slot = -1;
+   }
+}
+
+bool adt_timer_is_scheduled(const adt_timer_t *self)
+{
+   return (self != 0) && (self->ppPrev != 0);
+}
+
+/**
+ * u64Now is the current time in ticks, timers with expiry time up to and including u64Now are returned by the
+ * first call to adt_timerwheel_advance.
+ */
+adt_error_t adt_timerwheel_create(adt_timerwheel_t *self, uint64_t u64Now)
+{
+   int32_t i;
+   if (self == 0)
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   self->ppSlots = (adt_timer_t**) malloc(sizeof(adt_timer_t*) * (NUM_WHEEL_SLOTS + 1));
+   self->ps32SlotLen = (int32_t*) malloc(sizeof(int32_t) * (NUM_WHEEL_SLOTS + 1));
+   if ( (self->ppSlots == 0) || (self->ps32SlotLen == 0) )
+   {
+      if (self->ppSlots != 0)
+      {
+         free(self->ppSlots);
+         self->ppSlots = (adt_timer_t**) 0;
+      }
+      if (self->ps32SlotLen != 0)
+      {
+         free(self->ps32SlotLen);
+         self->ps32SlotLen = (int32_t*) 0;
+      }
+      return ADT_MEM_ERROR;
+   }
+   for (i = 0; i <= NUM_WHEEL_SLOTS; i++)
+   {
+      self->ppSlots[i] = (adt_timer_t*) 0;
+      self->ps32SlotLen[i] = 0;
+   }
+   for (i = 0; i < ADT_TIMERWHEEL_LEVELS; i++)
+   {
+      self->s32LevelLen[i] = 0;
+   }
+   self->s32CurLen = 0;
+   self->u64Tick = u64Now;
+   return ADT_NO_ERROR;
+}
+
+/**
+ * All timers still in the wheel become unscheduled. Timer memory is owned by the user and is not freed.
+ */
+void adt_timerwheel_destroy(adt_timerwheel_t *self)
+{
+   if ( (self != 0) && (self->ppSlots != 0) )
+   {
+      int32_t i;
+      for (i = 0; i <= NUM_WHEEL_SLOTS; i++)
+      {
+         adt_timer_t *pTimer = adt_timerwheel_detach(self, i);
+         while (pTimer != 0)
+         {
+            adt_timer_t *pNext = pTimer->pNext;
+            pTimer->pNext = (adt_timer_t*) 0;
+            pTimer->ppPrev = (adt_timer_t**) 0;
+            pTimer = pNext;
+         }
+      }
+      free(self->ppSlots);
+      free(self->ps32SlotLen);
+      self->ppSlots = (adt_timer_t**) 0;
+      self->ps32SlotLen = (int32_t*) 0;
+   }
+}
+
+adt_timerwheel_t* adt_timerwheel_new(uint64_t u64Now)
+{
+   adt_timerwheel_t *self = (adt_timerwheel_t*) malloc(sizeof(adt_timerwheel_t));
+   if (self != 0)
+   {
+      if (adt_timerwheel_create(self, u64Now) != ADT_NO_ERROR)
+      {
+         free(self);
+         self = (adt_timerwheel_t*) 0;
+      }
+   }
+   return self;
+}
+
+void adt_timerwheel_delete(adt_timerwheel_t *self)
+{
+   if (self != 0)
+   {
+      adt_timerwheel_destroy(self);
+      free(self);
+   }
+}
+
+void adt_timerwheel_vdelete(void *arg)
+{
+   adt_timerwheel_delete((adt_timerwheel_t*) arg);
+}
+
+/**
+ * Schedules pTimer to expire at tick u64Expires. A timer which is already scheduled is first cancelled.
+ * Expiry times which have already passed make the timer expire at the next call to adt_timerwheel_advance.
+ */
+adt_error_t adt_timerwheel_schedule(adt_timerwheel_t *self, adt_timer_t *pTimer, uint64_t u64Expires)
+{
+   if ( (self == 0) || (pTimer == 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (pTimer->ppPrev != 0)
+   {
+      adt_timerwheel_unlink(self, pTimer);
+   }
+   pTimer->u64Expires = u64Expires;
+   adt_timerwheel_link(self, pTimer, adt_timerwheel_slot(self, u64Expires));
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Removes pTimer from the wheel. Cancelling a timer which is not scheduled has no effect.
+ */
+adt_error_t adt_timerwheel_cancel(adt_timerwheel_t *self, adt_timer_t *pTimer)
+{
+   if ( (self == 0) || (pTimer == 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   if (pTimer->ppPrev != 0)
+   {
+      adt_timerwheel_unlink(self, pTimer);
+   }
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Processes all ticks up to and including u64Now. Expired timers are removed from the wheel and appended to pExpired
+ * (as adt_timer_t pointers) in order of expiry tick. Timers expiring at the same tick are appended in unspecified order.
+ * Runs of ticks where the lower levels of the wheel are empty are skipped without visiting each tick.
+ * If pExpired cannot grow, ADT_MEM_ERROR is returned and the expired timers stay in the wheel, to be returned by
+ * the next call.
+ */
+adt_error_t adt_timerwheel_advance(adt_timerwheel_t *self, uint64_t u64Now, adt_ary_t *pExpired)
+{
+   adt_timer_t *pHead;
+   adt_timer_t **ppTail;
+   adt_timer_t *pTimer;
+   int32_t s32Count = 0;
+   int32_t s32Offset;
+   int32_t i;
+   adt_error_t result;
+   if ( (self == 0) || (pExpired == 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   //chain all expired timers through pNext, starting with timers which were scheduled in the past
+   s32Count = self->ps32SlotLen[DUE_SLOT];
+   pHead = adt_timerwheel_detach(self, DUE_SLOT);
+   ppTail = &pHead;
+   while (*ppTail != 0)
+   {
+      ppTail = &(*ppTail)->pNext;
+   }
+   while (adt_timerwheel_next_tick(self, u64Now))
+   {
+      int32_t s32Slot = (int32_t) (self->u64Tick & SLOT_MASK);
+      if (s32Slot == 0)
+      {
+         int32_t s32Level;
+         for (s32Level = 1; s32Level < ADT_TIMERWHEEL_LEVELS; s32Level++)
+         {
+            int32_t s32Index = (int32_t) ((self->u64Tick >> LEVEL_SHIFT(s32Level)) & SLOT_MASK);
+            adt_timerwheel_cascade(self, (s32Level * ADT_TIMERWHEEL_SLOTS) + s32Index);
+            if (s32Index != 0)
+            {
+               break;
+            }
+         }
+      }
+      if (self->ps32SlotLen[s32Slot] > 0)
+      {
+         s32Count += self->ps32SlotLen[s32Slot];
+         *ppTail = adt_timerwheel_detach(self, s32Slot);
+         while (*ppTail != 0)
+         {
+            ppTail = &(*ppTail)->pNext;
+         }
+      }
+      self->u64Tick++;
+   }
+   if (s32Count == 0)
+   {
+      return ADT_NO_ERROR;
+   }
+   s32Offset = adt_ary_length(pExpired);
+   result = adt_ary_extend(pExpired, s32Offset + s32Count);
+   pTimer = pHead;
+   for (i = 0; pTimer != 0; i++)
+   {
+      adt_timer_t *pNext = pTimer->pNext;
+      if (result == ADT_NO_ERROR)
+      {
+         pTimer->pNext = (adt_timer_t*) 0;
+         pTimer->ppPrev = (adt_timer_t**) 0;
+         adt_ary_set(pExpired, s32Offset + i, pTimer);
+      }
+      else
+      {
+         adt_timerwheel_link(self, pTimer, DUE_SLOT);
+      }
+      pTimer = pNext;
+   }
+   return result;
+}
+
+/**
+ * Returns number of scheduled timers
+ */
+int32_t adt_timerwheel_length(const adt_timerwheel_t *self)
+{
+   if (self != 0)
+   {
+      return self->s32CurLen;
+   }
+   return 0;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Level n holds timers expiring between 2^(bits*n) and 2^(bits*(n+1))-1 ticks from now, in the slot given by
+ * bits [bits*n, bits*(n+1)) of the expiry time. Timers beyond the last level are placed as far away as possible and
+ * are placed again when that slot is cascaded.
+ */
+static int32_t adt_timerwheel_slot(const adt_timerwheel_t *self, uint64_t u64Expires)
+{
+   uint64_t u64Delta;
+   int32_t s32Level;
+   if (u64Expires < self->u64Tick)
+   {
+      return DUE_SLOT;
+   }
+   u64Delta = u64Expires - self->u64Tick;
+   if (u64Delta > MAX_DELTA)
+   {
+      u64Delta = MAX_DELTA;
+      u64Expires = self->u64Tick + MAX_DELTA;
+   }
+   for (s32Level = 0; s32Level < (ADT_TIMERWHEEL_LEVELS - 1); s32Level++)
+   {
+      if (u64Delta < (((uint64_t) 1u) << LEVEL_SHIFT(s32Level + 1)))
+      {
+         break;
+      }
+   }
+   return (s32Level * ADT_TIMERWHEEL_SLOTS) + (int32_t) ((u64Expires >> LEVEL_SHIFT(s32Level)) & SLOT_MASK);
+}
+
+static void adt_timerwheel_link(adt_timerwheel_t *self, adt_timer_t *pTimer, int32_t s32Slot)
+{
+   adt_timer_t **ppHead = &self->ppSlots[s32Slot];
+   pTimer->pNext = *ppHead;
+   if (*ppHead != 0)
+   {
+      (*ppHead)->ppPrev = &pTimer->pNext;
+   }
+   *ppHead = pTimer;
+   pTimer->ppPrev = ppHead;
+   pTimer->s32Slot = s32Slot;
+   self->ps32SlotLen[s32Slot]++;
+   if (s32Slot < NUM_WHEEL_SLOTS)
+   {
+      self->s32LevelLen[s32Slot >> ADT_TIMERWHEEL_SLOT_BITS]++;
+   }
+   self->s32CurLen++;
+}
+
+static void adt_timerwheel_unlink(adt_timerwheel_t *self, adt_timer_t *pTimer)
+{
+   *pTimer->ppPrev = pTimer->pNext;
+   if (pTimer->pNext != 0)
+   {
+      pTimer->pNext->ppPrev = pTimer->ppPrev;
+   }
+   pTimer->pNext = (adt_timer_t*) 0;
+   pTimer->ppPrev = (adt_timer_t**) 0;
+   self->ps32SlotLen[pTimer->s32Slot]--;
+   if (pTimer->s32Slot < NUM_WHEEL_SLOTS)
+   {
+      self->s32LevelLen[pTimer->s32Slot >> ADT_TIMERWHEEL_SLOT_BITS]--;
+   }
+   self->s32CurLen--;
+}
+
+/**
+ * Empties a slot and returns its timers as a list linked through pNext. The ppPrev fields are left as they are.
+ */
+static adt_timer_t* adt_timerwheel_detach(adt_timerwheel_t *self, int32_t s32Slot)
+{
+   adt_timer_t *pHead = self->ppSlots[s32Slot];
+   int32_t s32Len = self->ps32SlotLen[s32Slot];
+   self->ppSlots[s32Slot] = (adt_timer_t*) 0;
+   self->ps32SlotLen[s32Slot] = 0;
+   if (s32Slot < NUM_WHEEL_SLOTS)
+   {
+      self->s32LevelLen[s32Slot >> ADT_TIMERWHEEL_SLOT_BITS] -= s32Len;
+   }
+   self->s32CurLen -= s32Len;
+   return pHead;
+}
+
+/**
+ * Moves all timers of a slot in a higher level to their slots in the lower levels
+ */
+static void adt_timerwheel_cascade(adt_timerwheel_t *self, int32_t s32Slot)
+{
+   adt_timer_t *pTimer = adt_timerwheel_detach(self, s32Slot);
+   while (pTimer != 0)
+   {
+      adt_timer_t *pNext = pTimer->pNext;
+      adt_timerwheel_link(self, pTimer, adt_timerwheel_slot(self, pTimer->u64Expires));
+      pTimer = pNext;
+   }
+}
+
+/**
+ * Moves u64Tick to the next tick up to u64Now which has work to do and returns true, or sets u64Tick to u64Now+1
+ * and returns false when there is none. When the n lowest levels are empty nothing happens until the next tick
+ * which is a multiple of 2^(bits*n), where a slot of level n is cascaded.
+ */
+static bool adt_timerwheel_next_tick(adt_timerwheel_t *self, uint64_t u64Now)
+{
+   int32_t s32Level = 0;
+   uint64_t u64Next;
+   if (self->u64Tick > u64Now)
+   {
+      return false;
+   }
+   while ( (s32Level < ADT_TIMERWHEEL_LEVELS) && (self->s32LevelLen[s32Level] == 0) )
+   {
+      s32Level++;
+   }
+   if (s32Level == 0)
+   {
+      return true;
+   }
+   if (s32Level == ADT_TIMERWHEEL_LEVELS)
+   {
+      self->u64Tick = u64Now + 1u;
+      return false;
+   }
+   u64Next = ((self->u64Tick + (((uint64_t) 1u) << LEVEL_SHIFT(s32Level)) - 1u) >> LEVEL_SHIFT(s32Level)) << LEVEL_SHIFT(s32Level);
+   if (u64Next > u64Now)
+   {
+      self->u64Tick = u64Now + 1u;
+      return false;
+   }
+   self->u64Tick = u64Next;
+   return true;
+}
@@ -0,0 +1,534 @@
+/*****************************************************************************
+* \file      adt_ulist.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unrolled linked list (several items per node)
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <malloc.h>
+#include <string.h>
+#include "adt_ulist.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define HALF_NODE_LEN (ADT_ULIST_NODE_LEN / 2)
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static adt_ulist_node_t* adt_ulist_node_new(adt_ulist_t *self, adt_ulist_node_t *pPrev);
+static void adt_ulist_node_delete(adt_ulist_t *self, adt_ulist_node_t *pNode);
+static adt_error_t adt_ulist_insert_at(adt_ulist_t *self, adt_ulist_node_t *pNode, int32_t s32Index, void *pItem, adt_ulist_iter_t *pResult);
+static adt_ulist_iter_t* adt_ulist_iter_set(adt_ulist_iter_t *pIter, adt_ulist_node_t *pNode, int32_t s32Index);
+static void adt_ulist_free_nodes(adt_ulist_t *self);
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+void adt_ulist_create(adt_ulist_t *self, void (*pDestructor)(void*))
+{
+   if (self != 0)
+   {
+      self->pFirst = (adt_ulist_node_t*) 0;
+      self->pLast = (adt_ulist_node_t*) 0;
+      self->pDestructor = pDestructor;
+      self->s32Length = 0;
+      self->destructorEnable = true;
+   }
+}
+
+void adt_ulist_destroy(adt_ulist_t *self)
+{
+   if (self != 0)
+   {
+      adt_ulist_free_nodes(self);
+   }
+}
+
+adt_ulist_t* adt_ulist_new(void (*pDestructor)(void*))
+{
+   adt_ulist_t *self = (adt_ulist_t*) malloc(sizeof(adt_ulist_t));
+   if (self != 0)
+   {
+      adt_ulist_create(self, pDestructor);
+   }
+   return self;
+}
+
+void adt_ulist_delete(adt_ulist_t *self)
+{
+   if (self != 0)
+   {
+      adt_ulist_destroy(self);
+      free(self);
+   }
+}
+
+void adt_ulist_vdelete(void *arg)
+{
+   adt_ulist_delete((adt_ulist_t*) arg);
+}
+
+void adt_ulist_destructor_enable(adt_ulist_t *self, bool enable)
+{
+   if (self != 0)
+   {
+      self->destructorEnable = enable;
+   }
+}
+
+/**
+ * Inserts pItem at the end of the list
+ */
+adt_error_t adt_ulist_insert(adt_ulist_t *self, void *pItem)
+{
+   if (self == 0)
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   return adt_ulist_insert_at(self, self->pLast, (self->pLast != 0)? self->pLast->s32Len : 0, pItem, (adt_ulist_iter_t*) 0);
+}
+
+/**
+ * Inserts pItem at the beginning of the list
+ */
+adt_error_t adt_ulist_insert_front(adt_ulist_t *self, void *pItem)
+{
+   if (self == 0)
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   return adt_ulist_insert_at(self, self->pFirst, 0, pItem, (adt_ulist_iter_t*) 0);
+}
+
+/**
+ * Inserts pItem before the item at pIter. pIter keeps pointing to the same item as before.
+ */
+adt_error_t adt_ulist_insert_before(adt_ulist_t *self, adt_ulist_iter_t *pIter, void *pItem)
+{
+   adt_ulist_iter_t inserted;
+   adt_error_t result;
+   if ( (self == 0) || (pIter == 0) || (pIter->pNode == 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   result = adt_ulist_insert_at(self, pIter->pNode, pIter->s32Index, pItem, &inserted);
+   if (result == ADT_NO_ERROR)
+   {
+      //the item at pIter is now right after the inserted item
+      if ( (inserted.s32Index + 1) < inserted.pNode->s32Len )
+      {
+         (void) adt_ulist_iter_set(pIter, inserted.pNode, inserted.s32Index + 1);
+      }
+      else
+      {
+         (void) adt_ulist_iter_set(pIter, inserted.pNode->pNext, 0);
+      }
+   }
+   return result;
+}
+
+/**
+ * Inserts pItem after the item at pIter. pIter keeps pointing to the same item as before.
+ */
+adt_error_t adt_ulist_insert_after(adt_ulist_t *self, adt_ulist_iter_t *pIter, void *pItem)
+{
+   adt_ulist_iter_t inserted;
+   adt_error_t result;
+   if ( (self == 0) || (pIter == 0) || (pIter->pNode == 0) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   result = adt_ulist_insert_at(self, pIter->pNode, pIter->s32Index + 1, pItem, &inserted);
+   if (result == ADT_NO_ERROR)
+   {
+      //the item at pIter is now right before the inserted item
+      if (inserted.s32Index > 0)
+      {
+         (void) adt_ulist_iter_set(pIter, inserted.pNode, inserted.s32Index - 1);
+      }
+      else
+      {
+         (void) adt_ulist_iter_set(pIter, inserted.pNode->pPrev, inserted.pNode->pPrev->s32Len - 1);
+      }
+   }
+   return result;
+}
+
+/**
+ * Removes the item at pIter (without calling the destructor). Afterwards pIter points to the item that followed the
+ * erased item. Returns pIter, or NULL when the erased item was the last item in the list.
+ */
+adt_ulist_iter_t* adt_ulist_erase(adt_ulist_t *self, adt_ulist_iter_t *pIter)
+{
+   adt_ulist_node_t *pNode;
+   int32_t s32Index;
+   if ( (self == 0) || (pIter == 0) || (pIter->pNode == 0) )
+   {
+      return (adt_ulist_iter_t*) 0;
+   }
+   pNode = pIter->pNode;
+   s32Index = pIter->s32Index;
+   pNode->s32Len--;
+   memmove(&pNode->ppItems[s32Index], &pNode->ppItems[s32Index + 1], sizeof(void*) * (size_t) (pNode->s32Len - s32Index));
+   self->s32Length--;
+   if (pNode->s32Len == 0)
+   {
+      adt_ulist_node_t *pNext = pNode->pNext;
+      adt_ulist_node_delete(self, pNode);
+      return adt_ulist_iter_set(pIter, pNext, 0);
+   }
+   if ( (pNode->pNext != 0) && ((pNode->s32Len + pNode->pNext->s32Len) <= HALF_NODE_LEN) )
+   {
+      adt_ulist_node_t *pNext = pNode->pNext;
+      memcpy(&pNode->ppItems[pNode->s32Len], &pNext->ppItems[0], sizeof(void*) * (size_t) pNext->s32Len);
+      pNode->s32Len += pNext->s32Len;
+      adt_ulist_node_delete(self, pNext);
+   }
+   else if ( (pNode->pPrev != 0) && ((pNode->pPrev->s32Len + pNode->s32Len) <= HALF_NODE_LEN) )
+   {
+      adt_ulist_node_t *pPrev = pNode->pPrev;
+      memcpy(&pPrev->ppItems[pPrev->s32Len], &pNode->ppItems[0], sizeof(void*) * (size_t) pNode->s32Len);
+      s32Index += pPrev->s32Len;
+      pPrev->s32Len += pNode->s32Len;
+      adt_ulist_node_delete(self, pNode);
+      pNode = pPrev;
+   }
+   if (s32Index >= pNode->s32Len)
+   {
+      return adt_ulist_iter_set(pIter, pNode->pNext, 0);
+   }
+   return adt_ulist_iter_set(pIter, pNode, s32Index);
+}
+
+/**
+ * Removes the first occurrence of pItem. Returns true if it was found.
+ */
+bool adt_ulist_remove(adt_ulist_t *self, void *pItem)
+{
+   adt_ulist_iter_t iter;
+   if (adt_ulist_find(self, pItem, &iter) != 0)
+   {
+      (void) adt_ulist_erase(self, &iter);
+      return true;
+   }
+   return false;
+}
+
+void* adt_ulist_first(const adt_ulist_t *self)
+{
+   if ( (self != 0) && (self->pFirst != 0) )
+   {
+      return self->pFirst->ppItems[0];
+   }
+   return (void*) 0;
+}
+
+void* adt_ulist_last(const adt_ulist_t *self)
+{
+   if ( (self != 0) && (self->pLast != 0) )
+   {
+      return self->pLast->ppItems[self->pLast->s32Len - 1];
+   }
+   return (void*) 0;
+}
+
+/**
+ * Sets pIter to the first item. Returns pIter or NULL if the list is empty.
+ */
+adt_ulist_iter_t* adt_ulist_iter_first(const adt_ulist_t *self, adt_ulist_iter_t *pIter)
+{
+   if ( (self == 0) || (pIter == 0) )
+   {
+      return (adt_ulist_iter_t*) 0;
+   }
+   return adt_ulist_iter_set(pIter, self->pFirst, 0);
+}
+
+/**
+ * Sets pIter to the last item. Returns pIter or NULL if the list is empty.
+ */
+adt_ulist_iter_t* adt_ulist_iter_last(const adt_ulist_t *self, adt_ulist_iter_t *pIter)
+{
+   if ( (self == 0) || (pIter == 0) )
+   {
+      return (adt_ulist_iter_t*) 0;
+   }
+   return adt_ulist_iter_set(pIter, self->pLast, (self->pLast != 0)? self->pLast->s32Len - 1 : 0);
+}
+
+/**
+ * Moves pIter to the next item. Returns pIter or NULL when there are no more items.
+ */
+adt_ulist_iter_t* adt_ulist_iter_next(adt_ulist_iter_t *pIter)
+{
+   adt_ulist_node_t *pNode;
+   if ( (pIter == 0) || (pIter->pNode == 0) )
+   {
+      return (adt_ulist_iter_t*) 0;
+   }
+   pNode = pIter->pNode;
+   if (++pIter->s32Index < pNode->s32Len)
+   {
+      pIter->pItem = pNode->ppItems[pIter->s32Index];
+      return pIter;
+   }
+   return adt_ulist_iter_set(pIter, pNode->pNext, 0);
+}
+
+/**
+ * Moves pIter to the previous item. Returns pIter or NULL when there are no more items.
+ */
+adt_ulist_iter_t* adt_ulist_iter_prev(adt_ulist_iter_t *pIter)
+{
+   if ( (pIter == 0) || (pIter->pNode == 0) )
+   {
+      return (adt_ulist_iter_t*) 0;
+   }
+   if (pIter->s32Index > 0)
+   {
+      return adt_ulist_iter_set(pIter, pIter->pNode, pIter->s32Index - 1);
+   }
+   return adt_ulist_iter_set(pIter, pIter->pNode->pPrev, (pIter->pNode->pPrev != 0)? pIter->pNode->pPrev->s32Len - 1 : 0);
+}
+
+/**
+ * Finds the first occurrence of pItem and sets pIter to it. Returns pIter or NULL if not found.
+ */
+adt_ulist_iter_t* adt_ulist_find(const adt_ulist_t *self, void *pItem, adt_ulist_iter_t *pIter)
+{
+   if ( (self != 0) && (pIter != 0) )
+   {
+      adt_ulist_node_t *pNode;
+      for (pNode = self->pFirst; pNode != 0; pNode = pNode->pNext)
+      {
+         int32_t i;
+         for (i = 0; i < pNode->s32Len; i++)
+         {
+            if (pNode->ppItems[i] == pItem)
+            {
+               return adt_ulist_iter_set(pIter, pNode, i);
+            }
+         }
+      }
+   }
+   return (adt_ulist_iter_t*) 0;
+}
+
+int32_t adt_ulist_length(const adt_ulist_t *self)
+{
+   if (self != 0)
+   {
+      return self->s32Length;
+   }
+   return 0;
+}
+
+bool adt_ulist_is_empty(const adt_ulist_t *self)
+{
+   return (adt_ulist_length(self) == 0);
+}
+
+void adt_ulist_clear(adt_ulist_t *self)
+{
+   if (self != 0)
+   {
+      adt_ulist_free_nodes(self);
+   }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Allocates an empty node and links it after pPrev (or first in the list when pPrev is NULL)
+ */
+static adt_ulist_node_t* adt_ulist_node_new(adt_ulist_t *self, adt_ulist_node_t *pPrev)
+{
+   adt_ulist_node_t *pNode = (adt_ulist_node_t*) malloc(sizeof(adt_ulist_node_t));
+   if (pNode != 0)
+   {
+      pNode->s32Len = 0;
+      pNode->pPrev = pPrev;
+      pNode->pNext = (pPrev != 0)? pPrev->pNext : self->pFirst;
+      if (pNode->pNext != 0)
+      {
+         pNode->pNext->pPrev = pNode;
+      }
+      else
+      {
+         self->pLast = pNode;
+      }
+      if (pPrev != 0)
+      {
+         pPrev->pNext = pNode;
+      }
+      else
+      {
+         self->pFirst = pNode;
+      }
+   }
+   return pNode;
+}
+
+/**
+ * Unlinks and frees pNode
+ */
+static void adt_ulist_node_delete(adt_ulist_t *self, adt_ulist_node_t *pNode)
+{
+   if (pNode->pPrev != 0)
+   {
+      pNode->pPrev->pNext = pNode->pNext;
+   }
+   else
+   {
+      self->pFirst = pNode->pNext;
+   }
+   if (pNode->pNext != 0)
+   {
+      pNode->pNext->pPrev = pNode->pPrev;
+   }
+   else
+   {
+      self->pLast = pNode->pPrev;
+   }
+   free(pNode);
+}
+
+/**
+ * Inserts pItem at s32Index (0 to s32Len) of pNode, or into a new node when pNode is NULL (empty list).
+ * A full node is split in two halves, except when inserting at either end of it where a neighbour with free
+ * space (or a new node) is used instead. This keeps nodes full when items are appended in order.
+ * When pResult is not NULL it is set to the position of the inserted item.
+ */
+static adt_error_t adt_ulist_insert_at(adt_ulist_t *self, adt_ulist_node_t *pNode, int32_t s32Index, void *pItem, adt_ulist_iter_t *pResult)
+{
+   if (pNode == 0)
+   {
+      pNode = adt_ulist_node_new(self, (adt_ulist_node_t*) 0);
+      if (pNode == 0)
+      {
+         return ADT_MEM_ERROR;
+      }
+      s32Index = 0;
+   }
+   else if (pNode->s32Len == ADT_ULIST_NODE_LEN)
+   {
+      if ( (s32Index == 0) && (pNode->pPrev != 0) && (pNode->pPrev->s32Len < ADT_ULIST_NODE_LEN) )
+      {
+         pNode = pNode->pPrev;
+         s32Index = pNode->s32Len;
+      }
+      else if ( (s32Index == ADT_ULIST_NODE_LEN) && (pNode->pNext != 0) && (pNode->pNext->s32Len < ADT_ULIST_NODE_LEN) )
+      {
+         pNode = pNode->pNext;
+         s32Index = 0;
+      }
+      else if ( (s32Index == 0) || (s32Index == ADT_ULIST_NODE_LEN) )
+      {
+         pNode = adt_ulist_node_new(self, (s32Index == 0)? pNode->pPrev : pNode);
+         if (pNode == 0)
+         {
+            return ADT_MEM_ERROR;
+         }
+         s32Index = 0;
+      }
+      else
+      {
+         adt_ulist_node_t *pNew = adt_ulist_node_new(self, pNode);
+         if (pNew == 0)
+         {
+            return ADT_MEM_ERROR;
+         }
+         memcpy(&pNew->ppItems[0], &pNode->ppItems[HALF_NODE_LEN], sizeof(void*) * (size_t) (ADT_ULIST_NODE_LEN - HALF_NODE_LEN));
+         pNew->s32Len = ADT_ULIST_NODE_LEN - HALF_NODE_LEN;
+         pNode->s32Len = HALF_NODE_LEN;
+         if (s32Index > HALF_NODE_LEN)
+         {
+            pNode = pNew;
+            s32Index -= HALF_NODE_LEN;
+         }
+      }
+   }
+   memmove(&pNode->ppItems[s32Index + 1], &pNode->ppItems[s32Index], sizeof(void*) * (size_t) (pNode->s32Len - s32Index));
+   pNode->ppItems[s32Index] = pItem;
+   pNode->s32Len++;
+   self->s32Length++;
+   if (pResult != 0)
+   {
+      (void) adt_ulist_iter_set(pResult, pNode, s32Index);
+   }
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Sets pIter to s32Index of pNode. Returns pIter, or NULL when pNode is NULL (end of list).
+ */
+static adt_ulist_iter_t* adt_ulist_iter_set(adt_ulist_iter_t *pIter, adt_ulist_node_t *pNode, int32_t s32Index)
+{
+   pIter->pNode = pNode;
+   pIter->s32Index = s32Index;
+   if (pNode == 0)
+   {
+      pIter->pItem = (void*) 0;
+      return (adt_ulist_iter_t*) 0;
+   }
+   pIter->pItem = pNode->ppItems[s32Index];
+   return pIter;
+}
+
+/**
+ * Calls the destructor (if enabled) on all items, frees all nodes and leaves the list empty
+ */
+static void adt_ulist_free_nodes(adt_ulist_t *self)
+{
+   adt_ulist_node_t *pNode = self->pFirst;
+   void (*destructor)(void*) = (void (*)(void*)) 0;
+   if ( (self->destructorEnable != false) && (self->pDestructor != 0) )
+   {
+      destructor = self->pDestructor;
+   }
+   while (pNode != 0)
+   {
+      adt_ulist_node_t *pNext = pNode->pNext;
+      if (destructor != 0)
+      {
+         int32_t i;
+         for (i = 0; i < pNode->s32Len; i++)
+         {
+            destructor(pNode->ppItems[i]);
+         }
+      }
+      free(pNode);
+      pNode = pNext;
+   }
+   self->pFirst = (adt_ulist_node_t*) 0;
+   self->pLast = (adt_ulist_node_t*) 0;
+   self->s32Length = 0;
+}
@@ -0,0 +1,672 @@
+/*****************************************************************************
+* \file      adt_vec.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Vector storing fixed-size elements inline (no pointer indirection)
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <malloc.h>
+#include <string.h>
+#include <assert.h>
+#include "adt_vec.h"
+#include "adt_radix.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define SORT_RUN_LEN 16 //runs shorter than this are sorted using insertion sort before merging
+#define ELEM_PTR(base, index, size) ((base) + ((size_t) (index)) * (size))
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static adt_error_t adt_vec_grow(adt_vec_t *self, int32_t s32MinLen);
+static void adt_vec_flip_u32(adt_vec_t *self, uint32_t u32Flip);
+static void adt_vec_flip_u64(adt_vec_t *self, uint64_t u64Flip);
+static int32_t adt_vec_normalize_index(const adt_vec_t *self, int32_t s32Index);
+static int adt_vec_is_before(adt_vlt_func_t *vlt, const uint8_t *a, const uint8_t *b, bool reverse);
+static adt_error_t adt_vec_insertion_sort(uint8_t *pBegin, int32_t s32Len, uint32_t u32ElemSize, uint8_t *pTmp, adt_vlt_func_t *vlt, bool reverse);
+static adt_error_t adt_vec_merge(uint8_t *pDest, const uint8_t *pLeft, int32_t s32LeftLen, const uint8_t *pRight, int32_t s32RightLen, uint32_t u32ElemSize, adt_vlt_func_t *vlt, bool reverse);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+adt_error_t adt_vec_create(adt_vec_t *self, uint32_t u32ElemSize, void (*pDestructor)(void*))
+{
+   if ( (self != 0) && (u32ElemSize > 0u) )
+   {
+      self->pAlloc = (uint8_t*) 0;
+      self->u32ElemSize = u32ElemSize;
+      self->s32AllocLen = 0;
+      self->s32CurLen = 0;
+      self->pDestructor = pDestructor;
+      return ADT_NO_ERROR;
+   }
+   return ADT_INVALID_ARGUMENT_ERROR;
+}
+
+void adt_vec_destroy(adt_vec_t *self)
+{
+   if (self != 0)
+   {
+      adt_vec_clear(self);
+      if (self->pAlloc != 0)
+      {
+         free(self->pAlloc);
+      }
+      self->pAlloc = (uint8_t*) 0;
+      self->s32AllocLen = 0;
+   }
+}
+
+adt_vec_t* adt_vec_new(uint32_t u32ElemSize, void (*pDestructor)(void*))
+{
+   adt_vec_t *self = (adt_vec_t*) malloc(sizeof(adt_vec_t));
+   if (self != 0)
+   {
+      if (adt_vec_create(self, u32ElemSize, pDestructor) != ADT_NO_ERROR)
+      {
+         free(self);
+         self = (adt_vec_t*) 0;
+      }
+   }
+   return self;
+}
+
+void adt_vec_delete(adt_vec_t *self)
+{
+   if (self != 0)
+   {
+      adt_vec_destroy(self);
+      free(self);
+   }
+}
+
+void adt_vec_vdelete(void *arg)
+{
+   adt_vec_delete((adt_vec_t*) arg);
+}
+
+/**
+ * Copies u32ElemSize bytes from pElem to the end of the vector
+ */
+adt_error_t adt_vec_push(adt_vec_t *self, const void *pElem)
+{
+   if ( (self != 0) && (pElem != 0) )
+   {
+      adt_error_t result = adt_vec_grow(self, self->s32CurLen + 1);
+      if (result == ADT_NO_ERROR)
+      {
+         memcpy(ELEM_PTR(self->pAlloc, self->s32CurLen, self->u32ElemSize), pElem, self->u32ElemSize);
+         self->s32CurLen++;
+      }
+      return result;
+   }
+   return ADT_INVALID_ARGUMENT_ERROR;
+}
+
+/**
+ * Removes the last element from the vector, copying it to pDest.
+ * When pDest is NULL the element is discarded (calling pDestructor when set).
+ */
+adt_error_t adt_vec_pop(adt_vec_t *self, void *pDest)
+{
+   if (self != 0)
+   {
+      uint8_t *pElem;
+      if (self->s32CurLen == 0)
+      {
+         return ADT_LENGTH_ERROR;
+      }
+      pElem = ELEM_PTR(self->pAlloc, self->s32CurLen - 1, self->u32ElemSize);
+      if (pDest != 0)
+      {
+         memcpy(pDest, pElem, self->u32ElemSize);
+      }
+      else if (self->pDestructor != 0)
+      {
+         self->pDestructor(pElem);
+      }
+      self->s32CurLen--;
+      return ADT_NO_ERROR;
+   }
+   return ADT_INVALID_ARGUMENT_ERROR;
+}
+
+/**
+ * Inserts a copy of pElem before the element currently at s32Index.
+ * s32Index equal to the current length appends the element to the end of the vector.
+ */
+adt_error_t adt_vec_insert(adt_vec_t *self, int32_t s32Index, const void *pElem)
+{
+   if ( (self != 0) && (pElem != 0) )
+   {
+      adt_error_t result;
+      uint8_t *pPos;
+      if ( (s32Index < 0) || (s32Index > self->s32CurLen) )
+      {
+         return ADT_INDEX_OUT_OF_BOUNDS_ERROR;
+      }
+      result = adt_vec_grow(self, self->s32CurLen + 1);
+      if (result != ADT_NO_ERROR)
+      {
+         return result;
+      }
+      pPos = ELEM_PTR(self->pAlloc, s32Index, self->u32ElemSize);
+      memmove(pPos + self->u32ElemSize, pPos, ((size_t) (self->s32CurLen - s32Index)) * self->u32ElemSize);
+      memcpy(pPos, pElem, self->u32ElemSize);
+      self->s32CurLen++;
+      return ADT_NO_ERROR;
+   }
+   return ADT_INVALID_ARGUMENT_ERROR;
+}
+
+adt_error_t adt_vec_erase(adt_vec_t *self, int32_t s32Index)
+{
+   return adt_vec_splice(self, s32Index, 1);
+}
+
+/**
+ * removes s32Len elements from vector starting from s32Index (s32Index can be both positive or negative)
+ */
+adt_error_t adt_vec_splice(adt_vec_t *self, int32_t s32Index, int32_t s32Len)
+{
+   if ( (self != 0) && (s32Len > 0) )
+   {
+      int32_t s32ElemsRemain;
+      uint8_t *pDest;
+      s32Index = adt_vec_normalize_index(self, s32Index);
+      if (s32Index < 0)
+      {
+         return ADT_INDEX_OUT_OF_BOUNDS_ERROR;
+      }
+      if (s32Len > (self->s32CurLen - s32Index))
+      {
+         return ADT_LENGTH_ERROR; //s32Len is too large
+      }
+      pDest = ELEM_PTR(self->pAlloc, s32Index, self->u32ElemSize);
+      if (self->pDestructor != 0)
+      {
+         int32_t i;
+         for (i = 0; i < s32Len; i++)
+         {
+            self->pDestructor(ELEM_PTR(pDest, i, self->u32ElemSize));
+         }
+      }
+      s32ElemsRemain = self->s32CurLen - (s32Index + s32Len);
+      if (s32ElemsRemain > 0)
+      {
+         memmove(pDest, ELEM_PTR(pDest, s32Len, self->u32ElemSize), ((size_t) s32ElemsRemain) * self->u32ElemSize);
+      }
+      self->s32CurLen -= s32Len;
+      return ADT_NO_ERROR;
+   }
+   return ADT_INVALID_ARGUMENT_ERROR;
+}
+
+/**
+ * Returns pointer to element at s32Index (negative index counts from the end).
+ * Returns NULL when the index is outside vector bounds.
+ * The pointer is invalidated by any operation that changes the vector length.
+ */
+void* adt_vec_get(const adt_vec_t *self, int32_t s32Index)
+{
+   if (self != 0)
+   {
+      s32Index = adt_vec_normalize_index(self, s32Index);
+      if (s32Index >= 0)
+      {
+         return ELEM_PTR(self->pAlloc, s32Index, self->u32ElemSize);
+      }
+   }
+   return (void*) 0;
+}
+
+void* adt_vec_data(const adt_vec_t *self)
+{
+   if (self != 0)
+   {
+      return self->pAlloc;
+   }
+   return (void*) 0;
+}
+
+/**
+ * Makes sure there is room for at least s32Len elements without reallocation
+ */
+adt_error_t adt_vec_reserve(adt_vec_t *self, int32_t s32Len)
+{
+   if ( (self != 0) && (s32Len >= 0) )
+   {
+      if (s32Len > self->s32AllocLen)
+      {
+         uint8_t *pAlloc = (uint8_t*) malloc(((size_t) s32Len) * self->u32ElemSize);
+         if (pAlloc == 0)
+         {
+            return ADT_MEM_ERROR;
+         }
+         if (self->pAlloc != 0)
+         {
+            memcpy(pAlloc, self->pAlloc, ((size_t) self->s32CurLen) * self->u32ElemSize);
+            free(self->pAlloc);
+         }
+         self->pAlloc = pAlloc;
+         self->s32AllocLen = s32Len;
+      }
+      return ADT_NO_ERROR;
+   }
+   return ADT_INVALID_ARGUMENT_ERROR;
+}
+
+/**
+ * Changes vector length to s32Len. New elements are zero-initialized.
+ */
+adt_error_t adt_vec_resize(adt_vec_t *self, int32_t s32Len)
+{
+   if ( (self != 0) && (s32Len >= 0) )
+   {
+      if (s32Len > self->s32CurLen)
+      {
+         adt_error_t result = adt_vec_grow(self, s32Len);
+         if (result != ADT_NO_ERROR)
+         {
+            return result;
+         }
+         memset(ELEM_PTR(self->pAlloc, self->s32CurLen, self->u32ElemSize), 0, ((size_t) (s32Len - self->s32CurLen)) * self->u32ElemSize);
+         self->s32CurLen = s32Len;
+      }
+      else if (s32Len < self->s32CurLen)
+      {
+         return adt_vec_splice(self, s32Len, self->s32CurLen - s32Len);
+      }
+      return ADT_NO_ERROR;
+   }
+   return ADT_INVALID_ARGUMENT_ERROR;
+}
+
+/**
+ * Removes all elements but keeps allocated memory
+ */
+void adt_vec_clear(adt_vec_t *self)
+{
+   if (self != 0)
+   {
+      if ( (self->pDestructor != 0) && (self->s32CurLen > 0) )
+      {
+         int32_t i;
+         for (i = 0; i < self->s32CurLen; i++)
+         {
+            self->pDestructor(ELEM_PTR(self->pAlloc, i, self->u32ElemSize));
+         }
+      }
+      self->s32CurLen = 0;
+   }
+}
+
+int32_t adt_vec_length(const adt_vec_t *self)
+{
+   if (self != 0)
+   {
+      return self->s32CurLen;
+   }
+   return -1;
+}
+
+bool adt_vec_is_empty(const adt_vec_t *self)
+{
+   if (self != 0)
+   {
+      return self->s32CurLen > 0? false : true;
+   }
+   return false;
+}
+
+uint32_t adt_vec_elem_size(const adt_vec_t *self)
+{
+   if (self != 0)
+   {
+      return self->u32ElemSize;
+   }
+   return 0u;
+}
+
+/**
+ * Stable merge sort of the vector elements.
+ * If reverse is true it will be sorted in descending order, otherwise it will
+ * be sorted in ascending order.
+ * In case vlt reports an error the vector still contains all of its elements but in unspecified order.
+ */
+adt_error_t adt_vec_sort(adt_vec_t *self, adt_vlt_func_t *vlt, bool reverse)
+{
+   if ( (self != 0) && (vlt != 0) )
+   {
+      uint32_t u32ElemSize = self->u32ElemSize;
+      int32_t s32Len = self->s32CurLen;
+      uint8_t *pTmp;
+      uint8_t *pSrc;
+      uint8_t *pDest;
+      int32_t s32Begin;
+      int32_t s32Width;
+      adt_error_t result = ADT_NO_ERROR;
+
+      if (s32Len < 2)
+      {
+         return ADT_NO_ERROR;
+      }
+      pTmp = (uint8_t*) malloc(((size_t) s32Len) * u32ElemSize);
+      if (pTmp == 0)
+      {
+         return ADT_MEM_ERROR;
+      }
+      for (s32Begin = 0; s32Begin < s32Len; s32Begin += SORT_RUN_LEN)
+      {
+         int32_t s32RunLen = (s32Len - s32Begin) < SORT_RUN_LEN ? (s32Len - s32Begin) : SORT_RUN_LEN;
+         result = adt_vec_insertion_sort(ELEM_PTR(self->pAlloc, s32Begin, u32ElemSize), s32RunLen, u32ElemSize, pTmp, vlt, reverse);
+         if (result != ADT_NO_ERROR)
+         {
+            free(pTmp);
+            return result;
+         }
+      }
+      pSrc = self->pAlloc;
+      pDest = pTmp;
+      for (s32Width = SORT_RUN_LEN; s32Width < s32Len; s32Width *= 2)
+      {
+         for (s32Begin = 0; s32Begin < s32Len; s32Begin += 2 * s32Width)
+         {
+            int32_t s32Mid = (s32Begin + s32Width) < s32Len ? (s32Begin + s32Width) : s32Len;
+            int32_t s32End = (s32Mid + s32Width) < s32Len ? (s32Mid + s32Width) : s32Len;
+            result = adt_vec_merge(ELEM_PTR(pDest, s32Begin, u32ElemSize),
+                  ELEM_PTR(pSrc, s32Begin, u32ElemSize), s32Mid - s32Begin,
+                  ELEM_PTR(pSrc, s32Mid, u32ElemSize), s32End - s32Mid, u32ElemSize, vlt, reverse);
+            if (result != ADT_NO_ERROR)
+            {
+               break;
+            }
+         }
+         if (result != ADT_NO_ERROR)
+         {
+            break; //pSrc still holds all elements
+         }
+         else
+         {
+            uint8_t *pSwap = pSrc;
+            pSrc = pDest;
+            pDest = pSwap;
+         }
+      }
+      if (pSrc != self->pAlloc)
+      {
+         memcpy(self->pAlloc, pSrc, ((size_t) s32Len) * u32ElemSize);
+      }
+      free(pTmp);
+      return result;
+   }
+   return ADT_INVALID_ARGUMENT_ERROR;
+}
+
+/**
+ * Sorts a vector of uint32_t using radix sort. Element size must be 4.
+ */
+adt_error_t adt_vec_sort_u32(adt_vec_t *self, bool reverse)
+{
+   adt_error_t result;
+   if ( (self == 0) || (self->u32ElemSize != sizeof(uint32_t)) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   adt_vec_flip_u32(self, reverse? UINT32_MAX : 0u);
+   result = adt_radix_sort_u32((uint32_t*) self->pAlloc, (void**) 0, (size_t) self->s32CurLen);
+   adt_vec_flip_u32(self, reverse? UINT32_MAX : 0u);
+   return result;
+}
+
+/**
+ * Sorts a vector of int32_t using radix sort. Element size must be 4.
+ */
+adt_error_t adt_vec_sort_i32(adt_vec_t *self, bool reverse)
+{
+   adt_error_t result;
+   uint32_t u32Flip = reverse? INT32_MAX : 0x80000000u; //flipping the sign bit maps int32_t to uint32_t while preserving order
+   if ( (self == 0) || (self->u32ElemSize != sizeof(int32_t)) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   adt_vec_flip_u32(self, u32Flip);
+   result = adt_radix_sort_u32((uint32_t*) self->pAlloc, (void**) 0, (size_t) self->s32CurLen);
+   adt_vec_flip_u32(self, u32Flip);
+   return result;
+}
+
+/**
+ * Sorts a vector of uint64_t using radix sort. Element size must be 8.
+ */
+adt_error_t adt_vec_sort_u64(adt_vec_t *self, bool reverse)
+{
+   adt_error_t result;
+   if ( (self == 0) || (self->u32ElemSize != sizeof(uint64_t)) )
+   {
+      return ADT_INVALID_ARGUMENT_ERROR;
+   }
+   adt_vec_flip_u64(self, reverse? UINT64_MAX : 0u);
+   result = adt_radix_sort_u64((uint64_t*) self->pAlloc, (void**) 0, (size_t) self->s32CurLen);
+   adt_vec_flip_u64(self, reverse? UINT64_MAX : 0u);
+   return result;
+}
+
+/**
+ * Binary search in a vector sorted in ascending order (according to vlt).
+ * Returns the index of the first element equal to pKey or -1 if not found.
+ */
+int32_t adt_vec_bsearch(const adt_vec_t *self, const void *pKey, adt_vlt_func_t *vlt)
+{
+   if ( (self != 0) && (pKey != 0) && (vlt != 0) )
+   {
+      int32_t s32Low = 0;
+      int32_t s32High = self->s32CurLen;
+      while (s32Low < s32High)
+      {
+         int32_t s32Mid = s32Low + ((s32High - s32Low) >> 1);
+         int result = vlt(ELEM_PTR(self->pAlloc, s32Mid, self->u32ElemSize), pKey);
+         if (result < 0)
+         {
+            return -1;
+         }
+         if (result != 0)
+         {
+            s32Low = s32Mid + 1;
+         }
+         else
+         {
+            s32High = s32Mid;
+         }
+      }
+      if ( (s32Low < self->s32CurLen) && (vlt(pKey, ELEM_PTR(self->pAlloc, s32Low, self->u32ElemSize)) == 0) )
+      {
+         return s32Low;
+      }
+   }
+   return -1;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Makes room for at least s32MinLen elements. Allocated length doubles each time it needs to grow.
+ */
+static adt_error_t adt_vec_grow(adt_vec_t *self, int32_t s32MinLen)
+{
+   if (s32MinLen > self->s32AllocLen)
+   {
+      int32_t s32NewLen;
+      if (s32MinLen == INT32_MAX)
+      {
+         return ADT_LENGTH_ERROR;
+      }
+      s32NewLen = (self->s32AllocLen < ADT_VEC_MIN_ALLOC_LEN)? ADT_VEC_MIN_ALLOC_LEN : self->s32AllocLen;
+      while (s32NewLen < s32MinLen)
+      {
+         s32NewLen = (s32NewLen > (INT32_MAX / 2))? s32MinLen : (s32NewLen * 2);
+      }
+      return adt_vec_reserve(self, s32NewLen);
+   }
+   return ADT_NO_ERROR;
+}
+
+/**
+ * XORs every 32-bit element with u32Flip so that radix order matches the requested order and signedness
+ */
+static void adt_vec_flip_u32(adt_vec_t *self, uint32_t u32Flip)
+{
+   if (u32Flip != 0u)
+   {
+      uint32_t *pData = (uint32_t*) self->pAlloc;
+      int32_t i;
+      for (i = 0; i < self->s32CurLen; i++)
+      {
+         pData[i] ^= u32Flip;
+      }
+   }
+}
+
+/**
+ * XORs every 64-bit element with u64Flip so that radix order matches the requested order and signedness
+ */
+static void adt_vec_flip_u64(adt_vec_t *self, uint64_t u64Flip)
+{
+   if (u64Flip != 0u)
+   {
+      uint64_t *pData = (uint64_t*) self->pAlloc;
+      int32_t i;
+      for (i = 0; i < self->s32CurLen; i++)
+      {
+         pData[i] ^= u64Flip;
+      }
+   }
+}
+
+/**
+ * Converts negative index into positive index. Returns -1 in case index is out of bounds
+ */
+static int32_t adt_vec_normalize_index(const adt_vec_t *self, int32_t s32Index)
+{
+   if (s32Index < 0)
+   {
+      s32Index = self->s32CurLen + s32Index;
+   }
+   if ( (s32Index < 0) || (s32Index >= self->s32CurLen) )
+   {
+      return -1;
+   }
+   return s32Index;
+}
+
+/**
+ * Returns 1 if a shall be placed before b, 0 if not and -1 on error
+ */
+static int adt_vec_is_before(adt_vlt_func_t *vlt, const uint8_t *a, const uint8_t *b, bool reverse)
+{
+   return reverse? vlt(b, a) : vlt(a, b);
+}
+
+/**
+ * Sorts a short run of elements in place. The insertion position is found before any data is moved,
+ * which leaves the run intact in case vlt reports an error.
+ */
+static adt_error_t adt_vec_insertion_sort(uint8_t *pBegin, int32_t s32Len, uint32_t u32ElemSize, uint8_t *pTmp, adt_vlt_func_t *vlt, bool reverse)
+{
+   int32_t i;
+   for (i = 1; i < s32Len; i++)
+   {
+      uint8_t *pElem = ELEM_PTR(pBegin, i, u32ElemSize);
+      int32_t j = i;
+      while (j > 0)
+      {
+         int result = adt_vec_is_before(vlt, pElem, ELEM_PTR(pBegin, j - 1, u32ElemSize), reverse);
+         if (result < 0)
+         {
+            return ADT_OBJECT_COMPARE_ERROR;
+         }
+         if (result == 0)
+         {
+            break;
+         }
+         j--;
+      }
+      if (j < i)
+      {
+         uint8_t *pPos = ELEM_PTR(pBegin, j, u32ElemSize);
+         memcpy(pTmp, pElem, u32ElemSize);
+         memmove(pPos + u32ElemSize, pPos, ((size_t) (i - j)) * u32ElemSize);
+         memcpy(pPos, pTmp, u32ElemSize);
+      }
+   }
+   return ADT_NO_ERROR;
+}
+
+/**
+ * Merges two sorted runs into pDest. Elements from the left run wins ties which makes the sort stable.
+ */
+static adt_error_t adt_vec_merge(uint8_t *pDest, const uint8_t *pLeft, int32_t s32LeftLen, const uint8_t *pRight, int32_t s32RightLen, uint32_t u32ElemSize, adt_vlt_func_t *vlt, bool reverse)
+{
+   while ( (s32LeftLen > 0) && (s32RightLen > 0) )
+   {
+      int result = adt_vec_is_before(vlt, pRight, pLeft, reverse);
+      if (result < 0)
+      {
+         return ADT_OBJECT_COMPARE_ERROR;
+      }
+      if (result != 0)
+      {
+         memcpy(pDest, pRight, u32ElemSize);
+         pRight += u32ElemSize;
+         s32RightLen--;
+      }
+      else
+      {
+         memcpy(pDest, pLeft, u32ElemSize);
+         pLeft += u32ElemSize;
+         s32LeftLen--;
+      }
+      pDest += u32ElemSize;
+   }
+   if (s32LeftLen > 0)
+   {
+      memcpy(pDest, pLeft, ((size_t) s32LeftLen) * u32ElemSize);
+   }
+   if (s32RightLen > 0)
+   {
+      memcpy(pDest, pRight, ((size_t) s32RightLen) * u32ElemSize);
+   }
+   return ADT_NO_ERROR;
+}
@@ -28,6 +28,16 @@ CuSuite* testsuite_adt_priorityHeap(void);
 CuSuite* testsuite_adt_u32Set(void);
 CuSuite* testsuite_adt_ringbuf(void);
 CuSuite* testsuite_adt_bytes(void);
+CuSuite* testsuite_adt_vec(void);
+CuSuite* testsuite_adt_template(void);
+CuSuite* testsuite_adt_radix(void);
+CuSuite* testsuite_adt_timerwheel(void);
+CuSuite* testsuite_adt_mq(void);
+CuSuite* testsuite_adt_pool(void);
+CuSuite* testsuite_adt_pairheap(void);
+CuSuite* testsuite_adt_ilist(void);
+CuSuite* testsuite_adt_ulist(void);
+CuSuite* testsuite_adt_mpscq(void);
 
 #ifdef MEM_LEAK_CHECK
 void vfree(void* p)
@@ -55,6 +65,16 @@ void RunAllTests(void)
 	CuSuiteAddSuite(suite, testsuite_adt_u32Set());
 	CuSuiteAddSuite(suite, testsuite_adt_ringbuf());
 	CuSuiteAddSuite(suite, testsuite_adt_bytes());
+	CuSuiteAddSuite(suite, testsuite_adt_vec());
+	CuSuiteAddSuite(suite, testsuite_adt_template());
+	CuSuiteAddSuite(suite, testsuite_adt_radix());
+	CuSuiteAddSuite(suite, testsuite_adt_timerwheel());
+	CuSuiteAddSuite(suite, testsuite_adt_mq());
+	CuSuiteAddSuite(suite, testsuite_adt_pool());
+	CuSuiteAddSuite(suite, testsuite_adt_pairheap());
+	CuSuiteAddSuite(suite, testsuite_adt_ilist());
+	CuSuiteAddSuite(suite, testsuite_adt_ulist());
+	CuSuiteAddSuite(suite, testsuite_adt_mpscq());
 
 
 
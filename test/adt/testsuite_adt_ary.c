@@ -73,6 +73,32 @@ static void test_adt_ary_sort_array_with_seven_items(CuTest* tc);
 static void test_adt_ary_reverse_sort_array_with_seven_items(CuTest* tc);
 static void test_adt_ary_sort_strings_array_with_four_items(CuTest* tc);
 static void test_adt_ary_indexOf(CuTest* tc);
+static void test_adt_ary_bsearch(CuTest* tc);
+static void test_adt_ary_lower_and_upper_bound(CuTest* tc);
+static void test_adt_ary_insert_sorted(CuTest* tc);
+static void test_adt_ary_unique_sorted(CuTest* tc);
+static void test_adt_ary_merge_sorted(CuTest* tc);
+static void test_adt_ary_sort_is_stable(CuTest* tc);
+static void test_adt_ary_sort_parallel(CuTest* tc);
+static void test_adt_ary_unshift_many(CuTest* tc);
+static void test_adt_ary_reserve_front(CuTest* tc);
+static void test_adt_ary_push_growth(CuTest* tc);
+static void test_adt_ary_insert_sorted_large(CuTest* tc);
+static void test_adt_ary_insert_range(CuTest* tc);
+static void test_adt_ary_push_many(CuTest* tc);
+static void test_adt_ary_retain(CuTest* tc);
+static void test_adt_ary_indexOf_long_arrays(CuTest* tc);
+static void test_adt_ary_create_inline(CuTest* tc);
+static void test_adt_ary_new_inline(CuTest* tc);
+static void test_adt_ary_radix_sort(CuTest* tc);
+static void test_adt_ary_sort_by_key(CuTest* tc);
+static void test_adt_ary_sort_by_key_strings(CuTest* tc);
+static void test_adt_ary_partial_sort(CuTest* tc);
+static void test_adt_ary_nth_element(CuTest* tc);
+static bool keep_even(const void *pElem, void *arg);
+static int i32_vlt_wide(const void *a, const void *b);
+static uint64_t mod_ten_key(const void *pElem, void *arg);
+static uint32_t string_length_key(const void *pElem, void *arg);
 
 
 
@@ -105,6 +131,28 @@ CuSuite* testsuite_adt_ary(void)
    SUITE_ADD_TEST(suite, test_adt_ary_reverse_sort_array_with_seven_items);
    SUITE_ADD_TEST(suite, test_adt_ary_sort_strings_array_with_four_items);
    SUITE_ADD_TEST(suite, test_adt_ary_indexOf);
+   SUITE_ADD_TEST(suite, test_adt_ary_bsearch);
+   SUITE_ADD_TEST(suite, test_adt_ary_lower_and_upper_bound);
+   SUITE_ADD_TEST(suite, test_adt_ary_insert_sorted);
+   SUITE_ADD_TEST(suite, test_adt_ary_unique_sorted);
+   SUITE_ADD_TEST(suite, test_adt_ary_merge_sorted);
+   SUITE_ADD_TEST(suite, test_adt_ary_sort_is_stable);
+   SUITE_ADD_TEST(suite, test_adt_ary_sort_parallel);
+   SUITE_ADD_TEST(suite, test_adt_ary_unshift_many);
+   SUITE_ADD_TEST(suite, test_adt_ary_reserve_front);
+   SUITE_ADD_TEST(suite, test_adt_ary_push_growth);
+   SUITE_ADD_TEST(suite, test_adt_ary_insert_sorted_large);
+   SUITE_ADD_TEST(suite, test_adt_ary_insert_range);
+   SUITE_ADD_TEST(suite, test_adt_ary_push_many);
+   SUITE_ADD_TEST(suite, test_adt_ary_retain);
+   SUITE_ADD_TEST(suite, test_adt_ary_indexOf_long_arrays);
+   SUITE_ADD_TEST(suite, test_adt_ary_create_inline);
+   SUITE_ADD_TEST(suite, test_adt_ary_new_inline);
+   SUITE_ADD_TEST(suite, test_adt_ary_radix_sort);
+   SUITE_ADD_TEST(suite, test_adt_ary_sort_by_key);
+   SUITE_ADD_TEST(suite, test_adt_ary_sort_by_key_strings);
+   SUITE_ADD_TEST(suite, test_adt_ary_partial_sort);
+   SUITE_ADD_TEST(suite, test_adt_ary_nth_element);
 
    return suite;
 }
@@ -528,3 +576,784 @@ static void test_adt_ary_indexOf(CuTest* tc)
 
    adt_ary_delete(array);
 }
+
+static void test_adt_ary_bsearch(CuTest* tc)
+{
+   int32_t i;
+   int32_t key;
+   adt_ary_t *array = adt_ary_new(NULL);
+   CuAssertPtrNotNull(tc, array);
+   key = 3;
+   CuAssertIntEquals(tc, -1, adt_ary_bsearch(array, &key, adt_i32_vlt));
+   for (i = 0; i < 10; i++)
+   {
+      adt_ary_push(array, &m_numbers[i]);
+   }
+   for (i = 0; i < 10; i++)
+   {
+      key = i;
+      CuAssertIntEquals(tc, i, adt_ary_bsearch(array, &key, adt_i32_vlt));
+   }
+   key = -1;
+   CuAssertIntEquals(tc, -1, adt_ary_bsearch(array, &key, adt_i32_vlt));
+   key = 10;
+   CuAssertIntEquals(tc, -1, adt_ary_bsearch(array, &key, adt_i32_vlt));
+   adt_ary_delete(array);
+}
+
+static void test_adt_ary_lower_and_upper_bound(CuTest* tc)
+{
+   int32_t values[] = {1, 3, 3, 3, 5, 7};
+   int32_t i;
+   int32_t key;
+   adt_ary_t *array = adt_ary_new(NULL);
+   for (i = 0; i < 6; i++)
+   {
+      adt_ary_push(array, &values[i]);
+   }
+   key = 3;
+   CuAssertIntEquals(tc, 1, adt_ary_lower_bound(array, &key, adt_i32_vlt));
+   CuAssertIntEquals(tc, 4, adt_ary_upper_bound(array, &key, adt_i32_vlt));
+   CuAssertIntEquals(tc, 1, adt_ary_bsearch(array, &key, adt_i32_vlt));
+   key = 0;
+   CuAssertIntEquals(tc, 0, adt_ary_lower_bound(array, &key, adt_i32_vlt));
+   CuAssertIntEquals(tc, 0, adt_ary_upper_bound(array, &key, adt_i32_vlt));
+   key = 4;
+   CuAssertIntEquals(tc, 4, adt_ary_lower_bound(array, &key, adt_i32_vlt));
+   CuAssertIntEquals(tc, 4, adt_ary_upper_bound(array, &key, adt_i32_vlt));
+   key = 7;
+   CuAssertIntEquals(tc, 5, adt_ary_lower_bound(array, &key, adt_i32_vlt));
+   CuAssertIntEquals(tc, 6, adt_ary_upper_bound(array, &key, adt_i32_vlt));
+   key = 9;
+   CuAssertIntEquals(tc, 6, adt_ary_lower_bound(array, &key, adt_i32_vlt));
+   CuAssertIntEquals(tc, 6, adt_ary_upper_bound(array, &key, adt_i32_vlt));
+   adt_ary_delete(array);
+}
+
+static void test_adt_ary_insert_sorted(CuTest* tc)
+{
+   int32_t values[] = {5, 1, 9, 3, 3, 7, 0};
+   int32_t i;
+   adt_ary_t *array = adt_ary_new(NULL);
+   for (i = 0; i < 7; i++)
+   {
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_insert_sorted(array, &values[i], adt_i32_vlt));
+   }
+   CuAssertIntEquals(tc, 7, adt_ary_length(array));
+   CuAssertIntEquals(tc, 0, *((int32_t*) adt_ary_value(array, 0)));
+   CuAssertIntEquals(tc, 1, *((int32_t*) adt_ary_value(array, 1)));
+   CuAssertPtrEquals(tc, &values[3], adt_ary_value(array, 2)); //equal elements keep insertion order
+   CuAssertPtrEquals(tc, &values[4], adt_ary_value(array, 3));
+   CuAssertIntEquals(tc, 5, *((int32_t*) adt_ary_value(array, 4)));
+   CuAssertIntEquals(tc, 7, *((int32_t*) adt_ary_value(array, 5)));
+   CuAssertIntEquals(tc, 9, *((int32_t*) adt_ary_value(array, 6)));
+   adt_ary_delete(array);
+}
+
+static void test_adt_ary_unique_sorted(CuTest* tc)
+{
+   int32_t values[] = {1, 1, 2, 3, 3, 3, 4};
+   int32_t i;
+   int *pDuplicate;
+   adt_ary_t *array = adt_ary_new(vfree);
+   for (i = 0; i < 7; i++)
+   {
+      int *pValue = (int*) malloc(sizeof(int));
+      *pValue = values[i];
+      adt_ary_push(array, pValue);
+   }
+   pDuplicate = (int*) adt_ary_value(array, 1);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_unique_sorted(array, adt_i32_vlt));
+   CuAssertIntEquals(tc, 4, adt_ary_length(array));
+   CuAssertTrue(tc, pDuplicate != adt_ary_value(array, 1));
+   for (i = 0; i < 4; i++)
+   {
+      CuAssertIntEquals(tc, i + 1, *((int32_t*) adt_ary_value(array, i)));
+   }
+   adt_ary_delete(array); //removed duplicates are already freed, check with LEAK_CHECK
+}
+
+static void test_adt_ary_merge_sorted(CuTest* tc)
+{
+   int32_t left[] = {1, 4, 4, 8};
+   int32_t right[] = {0, 4, 9};
+   int32_t i;
+   adt_ary_t *array1 = adt_ary_new(NULL);
+   adt_ary_t *array2 = adt_ary_new(NULL);
+   for (i = 0; i < 4; i++)
+   {
+      adt_ary_push(array1, &left[i]);
+   }
+   for (i = 0; i < 3; i++)
+   {
+      adt_ary_push(array2, &right[i]);
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_merge_sorted(array1, array2, adt_i32_vlt));
+   CuAssertIntEquals(tc, 7, adt_ary_length(array1));
+   CuAssertIntEquals(tc, 0, adt_ary_length(array2));
+   CuAssertPtrEquals(tc, &right[0], adt_ary_value(array1, 0));
+   CuAssertPtrEquals(tc, &left[0], adt_ary_value(array1, 1));
+   CuAssertPtrEquals(tc, &left[1], adt_ary_value(array1, 2));
+   CuAssertPtrEquals(tc, &left[2], adt_ary_value(array1, 3));
+   CuAssertPtrEquals(tc, &right[1], adt_ary_value(array1, 4));
+   CuAssertPtrEquals(tc, &left[3], adt_ary_value(array1, 5));
+   CuAssertPtrEquals(tc, &right[2], adt_ary_value(array1, 6));
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_ary_merge_sorted(array1, array1, adt_i32_vlt));
+
+   //merge into empty array
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_merge_sorted(array2, array1, adt_i32_vlt));
+   CuAssertIntEquals(tc, 7, adt_ary_length(array2));
+   CuAssertIntEquals(tc, 0, adt_ary_length(array1));
+   CuAssertPtrEquals(tc, &right[2], adt_ary_value(array2, 6));
+   adt_ary_delete(array1);
+   adt_ary_delete(array2);
+}
+
+static void test_adt_ary_sort_is_stable(CuTest* tc)
+{
+   int32_t values[40];
+   int32_t i;
+   adt_ary_t *array = adt_ary_new(NULL);
+   for (i = 0; i < 40; i++)
+   {
+      values[i] = (i * 7) % 3;
+      adt_ary_push(array, &values[i]);
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_sort(array, adt_i32_vlt, false));
+   for (i = 1; i < 40; i++)
+   {
+      int32_t *pPrev = (int32_t*) adt_ary_value(array, i - 1);
+      int32_t *pCur = (int32_t*) adt_ary_value(array, i);
+      CuAssertTrue(tc, *pPrev <= *pCur);
+      if (*pPrev == *pCur)
+      {
+         CuAssertTrue(tc, pPrev < pCur); //equal elements keep their original order
+      }
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_sort(array, adt_i32_vlt, true));
+   for (i = 1; i < 40; i++)
+   {
+      int32_t *pPrev = (int32_t*) adt_ary_value(array, i - 1);
+      int32_t *pCur = (int32_t*) adt_ary_value(array, i);
+      CuAssertTrue(tc, *pPrev >= *pCur);
+      if (*pPrev == *pCur)
+      {
+         CuAssertTrue(tc, pPrev < pCur);
+      }
+   }
+   adt_ary_delete(array);
+}
+
+static void test_adt_ary_sort_parallel(CuTest* tc)
+{
+   const int32_t numValues = ADT_ARY_PARALLEL_SORT_MIN_LEN + 1000;
+   int32_t *pValues = (int32_t*) malloc(sizeof(int32_t) * numValues);
+   adt_ary_t *expected = adt_ary_new(NULL);
+   adt_ary_t *actual = adt_ary_new(NULL);
+   uint32_t seed = 12345u;
+   int32_t i;
+   int32_t numThreads;
+   CuAssertPtrNotNull(tc, pValues);
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_ary_sort_parallel(actual, adt_i32_vlt, false, 0));
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_ary_sort_parallel(actual, NULL, false, 2));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_sort_parallel(actual, adt_i32_vlt, false, 4)); //empty array
+   for (i = 0; i < numValues; i++)
+   {
+      seed = seed * 1103515245u + 12345u;
+      pValues[i] = (int32_t) ((seed >> 8) % 1000u);
+      adt_ary_push(expected, &pValues[i]);
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_sort(expected, adt_i32_vlt, false));
+   for (numThreads = 1; numThreads <= 5; numThreads++)
+   {
+      adt_ary_clear(actual);
+      for (i = 0; i < numValues; i++)
+      {
+         adt_ary_push(actual, &pValues[i]);
+      }
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_sort_parallel(actual, adt_i32_vlt, false, numThreads));
+      CuAssertIntEquals(tc, numValues, adt_ary_length(actual));
+      for (i = 0; i < numValues; i++)
+      {
+         //same pointer in every position means same order as the sequential (stable) sort
+         CuAssertPtrEquals(tc, adt_ary_value(expected, i), adt_ary_value(actual, i));
+      }
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_sort(expected, adt_i32_vlt, true));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_sort_parallel(actual, adt_i32_vlt, true, 3));
+   for (i = 0; i < numValues; i++)
+   {
+      CuAssertPtrEquals(tc, adt_ary_value(expected, i), adt_ary_value(actual, i));
+   }
+   adt_ary_delete(expected);
+   adt_ary_delete(actual);
+   free(pValues);
+}
+
+static void test_adt_ary_unshift_many(CuTest* tc)
+{
+   int32_t values[1000];
+   int32_t i;
+   int32_t numReallocs = 0;
+   void **ppAlloc;
+   adt_ary_t *array = adt_ary_new(NULL);
+   ppAlloc = array->ppAlloc;
+   //alternate unshift and push, array ends up as 998, 996, ..., 2, 0, 1, 3, ..., 997, 999
+   for (i = 0; i < 1000; i++)
+   {
+      values[i] = i;
+      if ( (i & 1) == 0)
+      {
+         CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_unshift(array, &values[i]));
+      }
+      else
+      {
+         CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_push(array, &values[i]));
+      }
+      if (array->ppAlloc != ppAlloc)
+      {
+         ppAlloc = array->ppAlloc;
+         numReallocs++;
+      }
+   }
+   CuAssertIntEquals(tc, 1000, adt_ary_length(array));
+   CuAssertTrue(tc, numReallocs < 20); //geometric growth
+   for (i = 0; i < 500; i++)
+   {
+      CuAssertIntEquals(tc, 998 - (2 * i), *((int32_t*) adt_ary_value(array, i)));
+      CuAssertIntEquals(tc, (2 * i) + 1, *((int32_t*) adt_ary_value(array, 500 + i)));
+   }
+   //shift/push keeps using the same allocation
+   for (i = 0; i < 1000; i++)
+   {
+      void *pElem = adt_ary_shift(array);
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_push(array, pElem));
+   }
+   CuAssertIntEquals(tc, 1000, adt_ary_length(array));
+   CuAssertIntEquals(tc, 998, *((int32_t*) adt_ary_value(array, 0)));
+   CuAssertIntEquals(tc, 999, *((int32_t*) adt_ary_value(array, -1)));
+   adt_ary_delete(array);
+}
+
+static void test_adt_ary_reserve_front(CuTest* tc)
+{
+   int32_t values[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+   int32_t i;
+   void **ppAlloc;
+   adt_ary_t *array = adt_ary_new(NULL);
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_ary_reserve_front(array, -1));
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_ary_reserve_front(NULL, 1));
+   for (i = 5; i < 8; i++)
+   {
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_push(array, &values[i]));
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_reserve_front(array, 5));
+   CuAssertTrue(tc, (array->pFirst - array->ppAlloc) >= 5);
+   ppAlloc = array->ppAlloc;
+   for (i = 4; i >= 0; i--)
+   {
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_unshift(array, &values[i]));
+   }
+   CuAssertPtrEquals(tc, ppAlloc, array->ppAlloc);
+   CuAssertIntEquals(tc, 8, adt_ary_length(array));
+   for (i = 0; i < 8; i++)
+   {
+      CuAssertPtrEquals(tc, &values[i], adt_ary_value(array, i));
+   }
+   adt_ary_delete(array);
+}
+
+/**
+ * Push must grow the allocation geometrically, also after unshift has used up all front headroom
+ */
+static void test_adt_ary_push_growth(CuTest* tc)
+{
+   int32_t value = 0;
+   int32_t i;
+   int32_t s32NumAllocs = 0;
+   int32_t s32AllocLen;
+   adt_ary_t *array = adt_ary_new(NULL);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_reserve_front(array, 16));
+   while (array->pFirst > array->ppAlloc)
+   {
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_unshift(array, &value));
+   }
+   s32AllocLen = array->s32AllocLen;
+   for (i = 0; i < 10000; i++)
+   {
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_push(array, &value));
+      if (array->s32AllocLen != s32AllocLen)
+      {
+         CuAssertTrue(tc, array->s32AllocLen >= (s32AllocLen + (s32AllocLen >> 1)));
+         s32AllocLen = array->s32AllocLen;
+         s32NumAllocs++;
+      }
+   }
+   CuAssertTrue(tc, s32NumAllocs < 30);
+   adt_ary_delete(array);
+   //plain push-only array
+   array = adt_ary_new(NULL);
+   s32AllocLen = 0;
+   s32NumAllocs = 0;
+   for (i = 0; i < 10000; i++)
+   {
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_push(array, &value));
+      if (array->s32AllocLen != s32AllocLen)
+      {
+         CuAssertTrue(tc, array->s32AllocLen >= (s32AllocLen + (s32AllocLen >> 1)));
+         s32AllocLen = array->s32AllocLen;
+         s32NumAllocs++;
+      }
+   }
+   CuAssertTrue(tc, s32NumAllocs < 30);
+   adt_ary_delete(array);
+}
+
+static void test_adt_ary_insert_sorted_large(CuTest* tc)
+{
+   const int32_t numValues = 20000; //larger than the 64KB block size used for moving data
+   int32_t *pValues = (int32_t*) malloc(sizeof(int32_t) * (numValues + 1));
+   int32_t i;
+   adt_ary_t *array = adt_ary_new(NULL);
+   CuAssertPtrNotNull(tc, pValues);
+   for (i = 0; i < numValues; i++)
+   {
+      pValues[i] = i + 1;
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_push(array, &pValues[i]));
+   }
+   pValues[numValues] = 0;
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_insert_sorted(array, &pValues[numValues], adt_i32_vlt));
+   CuAssertIntEquals(tc, numValues + 1, adt_ary_length(array));
+   for (i = 0; i <= numValues; i++)
+   {
+      CuAssertIntEquals(tc, i, *((int32_t*) adt_ary_value(array, i)));
+   }
+   adt_ary_delete(array);
+   free(pValues);
+}
+
+static void test_adt_ary_insert_range(CuTest* tc)
+{
+   int32_t values[7] = {0, 1, 2, 3, 4, 5, 6};
+   void *first[2] = {&values[0], &values[1]};
+   void *middle[3] = {&values[3], &values[4], &values[5]};
+   void *last[1] = {&values[6]};
+   int32_t i;
+   adt_ary_t *array = adt_ary_new(NULL);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_push(array, &values[2]));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_insert_range(array, 0, first, 2));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_insert_range(array, 3, last, 1));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_insert_range(array, 3, middle, 3));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_insert_range(array, 7, middle, 0));
+   CuAssertIntEquals(tc, 7, adt_ary_length(array));
+   for (i = 0; i < 7; i++)
+   {
+      CuAssertPtrEquals(tc, &values[i], adt_ary_value(array, i));
+   }
+   CuAssertIntEquals(tc, ADT_INDEX_OUT_OF_BOUNDS_ERROR, adt_ary_insert_range(array, 8, last, 1));
+   CuAssertIntEquals(tc, ADT_INDEX_OUT_OF_BOUNDS_ERROR, adt_ary_insert_range(array, -1, last, 1));
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_ary_insert_range(array, 0, NULL, 1));
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_ary_insert_range(array, 0, last, -1));
+   CuAssertIntEquals(tc, 7, adt_ary_length(array));
+   adt_ary_delete(array);
+}
+
+static void test_adt_ary_push_many(CuTest* tc)
+{
+   int32_t values[5] = {0, 1, 2, 3, 4};
+   void *elems[5] = {&values[0], &values[1], &values[2], &values[3], &values[4]};
+   int32_t i;
+   adt_ary_t *array = adt_ary_new(NULL);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_push_many(array, elems, 2));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_push_many(array, &elems[2], 3));
+   CuAssertIntEquals(tc, 5, adt_ary_length(array));
+   for (i = 0; i < 5; i++)
+   {
+      CuAssertPtrEquals(tc, &values[i], adt_ary_value(array, i));
+   }
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_ary_push_many(NULL, elems, 1));
+   adt_ary_delete(array);
+}
+
+static void test_adt_ary_retain(CuTest* tc)
+{
+   int32_t i;
+   int32_t count = 0;
+   adt_ary_t *array = adt_ary_new(vfree);
+   for (i = 0; i < 10; i++)
+   {
+      int32_t *pValue = (int32_t*) malloc(sizeof(int32_t));
+      *pValue = i;
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_push(array, pValue));
+   }
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_ary_retain(array, NULL, NULL));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_retain(array, keep_even, &count));
+   CuAssertIntEquals(tc, 10, count);
+   CuAssertIntEquals(tc, 5, adt_ary_length(array));
+   for (i = 0; i < 5; i++)
+   {
+      CuAssertIntEquals(tc, i * 2, *((int32_t*) adt_ary_value(array, i)));
+   }
+   adt_ary_delete(array); //removed elements are already freed, check with LEAK_CHECK
+}
+
+static void test_adt_ary_indexOf_long_arrays(CuTest* tc)
+{
+   char items[70];
+   int32_t len;
+   int32_t offset;
+   adt_ary_t *array = adt_ary_new(NULL);
+   //different offsets of pFirst exercise unaligned heads and tails of the SIMD search
+   for (offset = 0; offset < 4; offset++)
+   {
+      for (len = 0; len < 66; len++)
+      {
+         int32_t i;
+         adt_ary_clear(array);
+         for (i = 0; i < (len + offset); i++)
+         {
+            CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_push(array, &items[i]));
+         }
+         for (i = 0; i < offset; i++)
+         {
+            adt_ary_shift(array);
+         }
+         for (i = 0; i < len; i++)
+         {
+            CuAssertIntEquals(tc, i, adt_ary_indexOf(array, &items[i + offset]));
+         }
+         CuAssertIntEquals(tc, -1, adt_ary_indexOf(array, &items[69]));
+      }
+   }
+   //array now holds items[3]..items[67]
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_push(array, &items[13]));
+   CuAssertIntEquals(tc, 10, adt_ary_indexOf(array, &items[13])); //first occurrence
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_push_unique(array, &items[43]));
+   CuAssertIntEquals(tc, 66, adt_ary_length(array));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_remove(array, &items[43]));
+   CuAssertIntEquals(tc, 65, adt_ary_length(array));
+   CuAssertIntEquals(tc, -1, adt_ary_indexOf(array, &items[43]));
+#if (UINTPTR_MAX == UINT64_MAX)
+   {
+      //only the upper 32 bits differ
+      uintptr_t base = (uintptr_t) 0x100000001ull;
+      int32_t i;
+      adt_ary_clear(array);
+      for (i = 0; i < 32; i++)
+      {
+         adt_ary_push(array, (void*) (base + (((uintptr_t) i) << 32)));
+      }
+      CuAssertIntEquals(tc, 17, adt_ary_indexOf(array, (void*) (base + (((uintptr_t) 17) << 32))));
+      CuAssertIntEquals(tc, -1, adt_ary_indexOf(array, (void*) (base + (((uintptr_t) 40) << 32))));
+   }
+#endif
+   adt_ary_delete(array);
+}
+
+static void test_adt_ary_create_inline(CuTest* tc)
+{
+   void *buf[4];
+   int32_t values[6] = {0, 1, 2, 3, 4, 5};
+   int32_t i;
+   adt_ary_t array;
+   adt_ary_create_inline(&array, NULL, buf, 4);
+   CuAssertPtrEquals(tc, buf, array.ppAlloc);
+   CuAssertIntEquals(tc, 4, array.s32AllocLen);
+   CuAssertIntEquals(tc, 0, adt_ary_length(&array));
+   for (i = 0; i < 4; i++)
+   {
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_push(&array, &values[i]));
+   }
+   CuAssertPtrEquals(tc, buf, array.ppAlloc);
+   //spill to heap
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_push(&array, &values[4]));
+   CuAssertTrue(tc, array.ppAlloc != buf);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_unshift(&array, &values[5]));
+   CuAssertIntEquals(tc, 6, adt_ary_length(&array));
+   CuAssertPtrEquals(tc, &values[5], adt_ary_value(&array, 0));
+   for (i = 0; i < 5; i++)
+   {
+      CuAssertPtrEquals(tc, &values[i], adt_ary_value(&array, i + 1));
+   }
+   //clear returns to inline storage
+   adt_ary_clear(&array);
+   CuAssertPtrEquals(tc, buf, array.ppAlloc);
+   CuAssertPtrEquals(tc, buf, array.pFirst);
+   CuAssertIntEquals(tc, 4, array.s32AllocLen);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_unshift(&array, &values[1]));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_unshift(&array, &values[0]));
+   CuAssertPtrEquals(tc, buf, array.ppAlloc);
+   CuAssertPtrEquals(tc, &values[0], adt_ary_value(&array, 0));
+   CuAssertPtrEquals(tc, &values[1], adt_ary_value(&array, 1));
+   adt_ary_destroy(&array);
+}
+
+static void test_adt_ary_new_inline(CuTest* tc)
+{
+   int32_t i;
+   adt_ary_t *array = adt_ary_new_inline(vfree, 8);
+   CuAssertPtrNotNull(tc, array);
+   CuAssertPtrEquals(tc, array + 1, array->ppAlloc);
+   for (i = 0; i < 8; i++)
+   {
+      int32_t *pValue = (int32_t*) malloc(sizeof(int32_t));
+      *pValue = i;
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_push(array, pValue));
+   }
+   CuAssertPtrEquals(tc, array + 1, array->ppAlloc);
+   CuAssertIntEquals(tc, 7, *((int32_t*) adt_ary_value(array, -1)));
+   CuAssertPtrEquals(tc, NULL, adt_ary_new_inline(NULL, -1));
+   adt_ary_delete(array);
+}
+
+static void test_adt_ary_radix_sort(CuTest* tc)
+{
+   int32_t values[200];
+   uint64_t values64[3] = {0x100000000ull, 7u, UINT64_MAX};
+   const char *strings[4] = {"ccc", "a", "dddd", "bb"};
+   int32_t numCalls = 0;
+   int32_t i;
+   adt_ary_t *array = adt_ary_new(NULL);
+   for (i = 0; i < 200; i++)
+   {
+      values[i] = ((i * 37) % 101) - 50;
+      adt_ary_push(array, &values[i]);
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_sort_i32(array, false));
+   for (i = 1; i < 200; i++)
+   {
+      int32_t *pPrev = (int32_t*) adt_ary_value(array, i - 1);
+      int32_t *pCur = (int32_t*) adt_ary_value(array, i);
+      CuAssertTrue(tc, *pPrev <= *pCur);
+      if (*pPrev == *pCur)
+      {
+         CuAssertTrue(tc, pPrev < pCur); //stable
+      }
+   }
+   CuAssertIntEquals(tc, -50, *((int32_t*) adt_ary_value(array, 0)));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_sort_i32(array, true));
+   CuAssertIntEquals(tc, 50, *((int32_t*) adt_ary_value(array, 0)));
+   CuAssertIntEquals(tc, -50, *((int32_t*) adt_ary_value(array, -1)));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_sort_u32(array, false));
+   CuAssertIntEquals(tc, 0, *((int32_t*) adt_ary_value(array, 0))); //negative numbers are large when read as uint32_t
+   CuAssertIntEquals(tc, -1, *((int32_t*) adt_ary_value(array, -1)));
+   adt_ary_push(array, NULL);
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_ary_sort_u32(array, false));
+
+   adt_ary_clear(array);
+   for (i = 0; i < 3; i++)
+   {
+      adt_ary_push(array, &values64[i]);
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_sort_u64(array, true));
+   CuAssertPtrEquals(tc, &values64[2], adt_ary_value(array, 0));
+   CuAssertPtrEquals(tc, &values64[0], adt_ary_value(array, 1));
+   CuAssertPtrEquals(tc, &values64[1], adt_ary_value(array, 2));
+
+   adt_ary_clear(array);
+   for (i = 0; i < 4; i++)
+   {
+      adt_ary_push(array, (void*) strings[i]);
+   }
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_ary_sort_u32_key(array, NULL, NULL, false));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_sort_u32_key(array, string_length_key, &numCalls, false));
+   CuAssertIntEquals(tc, 4, numCalls);
+   CuAssertStrEquals(tc, "a", (const char*) adt_ary_value(array, 0));
+   CuAssertStrEquals(tc, "bb", (const char*) adt_ary_value(array, 1));
+   CuAssertStrEquals(tc, "ccc", (const char*) adt_ary_value(array, 2));
+   CuAssertStrEquals(tc, "dddd", (const char*) adt_ary_value(array, 3));
+   adt_ary_delete(array);
+}
+
+static void test_adt_ary_sort_by_key(CuTest* tc)
+{
+   int32_t values[100];
+   int32_t i;
+   int32_t numCalls = 0;
+   adt_ary_t *array = adt_ary_new(NULL);
+   for (i = 0; i < 100; i++)
+   {
+      values[i] = (i * 37) % 100;
+      adt_ary_push(array, &values[i]);
+   }
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_ary_sort_by_key(array, NULL, NULL, adt_i32_vlt, false));
+   //key is value/10, ties are resolved by full value
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_sort_by_key(array, mod_ten_key, &numCalls, adt_i32_vlt, false));
+   CuAssertIntEquals(tc, 100, numCalls); //key is extracted once per element
+   for (i = 0; i < 100; i++)
+   {
+      CuAssertIntEquals(tc, i, *((int32_t*) adt_ary_value(array, i)));
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_sort_by_key(array, mod_ten_key, &numCalls, adt_i32_vlt, true));
+   for (i = 0; i < 100; i++)
+   {
+      CuAssertIntEquals(tc, 99 - i, *((int32_t*) adt_ary_value(array, i)));
+   }
+   //without vlt, elements with equal keys keep their order
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_sort_by_key(array, mod_ten_key, &numCalls, NULL, false));
+   CuAssertIntEquals(tc, 9, *((int32_t*) adt_ary_value(array, 0)));
+   CuAssertIntEquals(tc, 0, *((int32_t*) adt_ary_value(array, 9)));
+   CuAssertIntEquals(tc, 99, *((int32_t*) adt_ary_value(array, 90)));
+   adt_ary_delete(array);
+}
+
+static void test_adt_ary_sort_by_key_strings(CuTest* tc)
+{
+   const char *words[] = {"purple", "green", "blue", "black", "", "interoperability", "interoperable", "interop",
+         "international", "\xc3\xa5ngstr\xc3\xb6m", "zebra", "blue", "b", "ab", "abcdefghij", "abcdefgh", "abcdefghi"};
+   const int32_t numWords = (int32_t) (sizeof(words) / sizeof(words[0]));
+   int32_t round;
+   int32_t i;
+   adt_ary_t *expected = adt_ary_new(NULL);
+   adt_ary_t *actual = adt_ary_new(NULL);
+   adt_ary_t *strings = adt_ary_new(adt_str_vdelete);
+   for (round = 0; round < 5; round++)
+   {
+      for (i = 0; i < numWords; i++)
+      {
+         adt_str_t *str = adt_str_new_cstr(words[(i * 7 + round) % numWords]);
+         if (round == 4)
+         {
+            adt_str_setEncoding(str, ADT_STR_ENCODING_UTF8);
+         }
+         adt_ary_push(strings, str);
+      }
+   }
+   for (i = 0; i < adt_ary_length(strings); i++)
+   {
+      adt_ary_push(expected, adt_ary_value(strings, i));
+      adt_ary_push(actual, adt_ary_value(strings, i));
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_sort(expected, adt_str_vlt, false));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_sort_by_key(actual, adt_str_prefix_key, NULL, adt_str_vlt, false));
+   for (i = 0; i < adt_ary_length(strings); i++)
+   {
+      CuAssertPtrEquals(tc, adt_ary_value(expected, i), adt_ary_value(actual, i));
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_sort(expected, adt_str_vlt, true));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_sort_by_key(actual, adt_str_prefix_key, NULL, adt_str_vlt, true));
+   for (i = 0; i < adt_ary_length(strings); i++)
+   {
+      CuAssertPtrEquals(tc, adt_ary_value(expected, i), adt_ary_value(actual, i));
+   }
+   adt_ary_delete(expected);
+   adt_ary_delete(actual);
+   adt_ary_delete(strings);
+}
+
+static void test_adt_ary_partial_sort(CuTest* tc)
+{
+   int32_t values[1000];
+   int32_t i;
+   adt_ary_t *array = adt_ary_new(NULL);
+   adt_ary_resize(array, 1000);
+   for (i = 0; i < 1000; i++)
+   {
+      values[i] = (i * 7919) % 500; //each value occurs twice
+      adt_ary_set(array, i, &values[i]);
+   }
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_ary_partial_sort(array, -1, adt_i32_vlt, false));
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_ary_partial_sort(array, 10, NULL, false));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_partial_sort(array, 10, adt_i32_vlt, false));
+   for (i = 0; i < 10; i++)
+   {
+      CuAssertIntEquals(tc, i / 2, *((int32_t*) adt_ary_value(array, i)));
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_partial_sort(array, 100, adt_i32_vlt, true));
+   for (i = 0; i < 100; i++)
+   {
+      CuAssertIntEquals(tc, 499 - (i / 2), *((int32_t*) adt_ary_value(array, i)));
+   }
+   //all elements are still in the array
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_partial_sort(array, 2000, adt_i32_vlt, false));
+   CuAssertIntEquals(tc, 1000, adt_ary_length(array));
+   for (i = 0; i < 1000; i++)
+   {
+      CuAssertIntEquals(tc, i / 2, *((int32_t*) adt_ary_value(array, i)));
+   }
+   //any non-zero return value from the compare function means less-than
+   for (i = 0; i < 1000; i++)
+   {
+      adt_ary_set(array, i, &values[i]);
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_partial_sort(array, 10, i32_vlt_wide, false));
+   for (i = 0; i < 10; i++)
+   {
+      CuAssertIntEquals(tc, i / 2, *((int32_t*) adt_ary_value(array, i)));
+   }
+   adt_ary_delete(array);
+}
+
+static void test_adt_ary_nth_element(CuTest* tc)
+{
+   int32_t values[1001];
+   int32_t pattern;
+   adt_ary_t *array = adt_ary_new(NULL);
+   CuAssertIntEquals(tc, ADT_INDEX_OUT_OF_BOUNDS_ERROR, adt_ary_nth_element(array, 0, adt_i32_vlt, false));
+   adt_ary_resize(array, 1001);
+   for (pattern = 0; pattern < 4; pattern++)
+   {
+      int32_t s32Index;
+      for (s32Index = 0; s32Index < 1001; s32Index += 100)
+      {
+         int32_t i;
+         int32_t expected;
+         for (i = 0; i < 1001; i++)
+         {
+            switch (pattern)
+            {
+            case 0: values[i] = (i * 7919) % 1001; break; //shuffled
+            case 1: values[i] = i; break;                 //sorted
+            case 2: values[i] = 1000 - i; break;          //reverse sorted
+            default: values[i] = i % 3; break;            //many duplicates
+            }
+            adt_ary_set(array, i, &values[i]);
+         }
+         expected = (pattern == 3)? ( (s32Index < 334)? 0 : (s32Index < 668)? 1 : 2 ) : s32Index;
+         CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_nth_element(array, s32Index, adt_i32_vlt, false));
+         CuAssertIntEquals(tc, expected, *((int32_t*) adt_ary_value(array, s32Index)));
+         for (i = 0; i < 1001; i++)
+         {
+            int32_t value = *((int32_t*) adt_ary_value(array, i));
+            if (i < s32Index)
+            {
+               CuAssertTrue(tc, value <= expected);
+            }
+            else
+            {
+               CuAssertTrue(tc, value >= expected);
+            }
+         }
+      }
+   }
+   CuAssertIntEquals(tc, ADT_INDEX_OUT_OF_BOUNDS_ERROR, adt_ary_nth_element(array, 1001, adt_i32_vlt, false));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ary_nth_element(array, 0, adt_i32_vlt, true));
+   CuAssertIntEquals(tc, 2, *((int32_t*) adt_ary_value(array, 0)));
+   adt_ary_delete(array);
+}
+
+/**
+ * Same as adt_i32_vlt but returns 2 instead of 1
+ */
+static int i32_vlt_wide(const void *a, const void *b)
+{
+   return (*((const int32_t*) a) < *((const int32_t*) b))? 2 : 0;
+}
+
+static bool keep_even(const void *pElem, void *arg)
+{
+   (*((int32_t*) arg))++;
+   return ( (*((const int32_t*) pElem)) % 2 ) == 0;
+}
+
+static uint32_t string_length_key(const void *pElem, void *arg)
+{
+   (*((int32_t*) arg))++;
+   return (uint32_t) strlen((const char*) pElem);
+}
+
+static uint64_t mod_ten_key(const void *pElem, void *arg)
+{
+   (*((int32_t*) arg))++;
+   return (uint64_t) (*((const int32_t*) pElem) / 10);
+}
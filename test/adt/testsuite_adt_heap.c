@@ -19,6 +19,20 @@
 static void test_heap_elem(CuTest* tc);
 static void test_min_heap_sortUp(CuTest* tc);
 static void test_min_heap_sortDown(CuTest* tc);
+static void test_heap_topk(CuTest* tc);
+static void test_pq_min_heap(CuTest* tc);
+static void test_pq_max_heap_replace_top(CuTest* tc);
+static void test_pq_arity(CuTest* tc);
+static void test_iheap_handles(CuTest* tc);
+static void test_iheap_random(CuTest* tc);
+static void test_heap_elem_u64(CuTest* tc);
+static void test_heap_build_merge(CuTest* tc);
+static void test_heap_sort(CuTest* tc);
+static void test_mmheap_push_pop(CuTest* tc);
+static void test_mmheap_random(CuTest* tc);
+static bool is_heap(const adt_ary_t *heap, adt_heap_family family);
+static bool is_mmheap(const adt_mmheap_t *heap);
+static int i32_vlt_wide(const void *a, const void *b);
 
 
 //////////////////////////////////////////////////////////////////////////////
@@ -35,6 +49,17 @@ CuSuite* testsuite_adt_priorityHeap(void){
    SUITE_ADD_TEST(suite, test_heap_elem);
    SUITE_ADD_TEST(suite, test_min_heap_sortUp);
    SUITE_ADD_TEST(suite, test_min_heap_sortDown);
+   SUITE_ADD_TEST(suite, test_heap_topk);
+   SUITE_ADD_TEST(suite, test_pq_min_heap);
+   SUITE_ADD_TEST(suite, test_pq_max_heap_replace_top);
+   SUITE_ADD_TEST(suite, test_pq_arity);
+   SUITE_ADD_TEST(suite, test_iheap_handles);
+   SUITE_ADD_TEST(suite, test_iheap_random);
+   SUITE_ADD_TEST(suite, test_heap_elem_u64);
+   SUITE_ADD_TEST(suite, test_heap_build_merge);
+   SUITE_ADD_TEST(suite, test_heap_sort);
+   SUITE_ADD_TEST(suite, test_mmheap_push_pop);
+   SUITE_ADD_TEST(suite, test_mmheap_random);
 
    return suite;
 
@@ -201,3 +226,499 @@ static void test_min_heap_sortDown(CuTest* tc){
 
    adt_ary_destroy(&heap);
 }
+
+static void test_heap_topk(CuTest* tc){
+   int32_t values[1000];
+   int32_t i;
+   void *pRejected;
+   adt_ary_t result;
+   adt_heap_topk_t *topk = adt_heap_topk_new(10, adt_i32_vlt, true);
+   CuAssertPtrNotNull(tc, topk);
+   CuAssertPtrEquals(tc, NULL, adt_heap_topk_new(0, adt_i32_vlt, true));
+   CuAssertPtrEquals(tc, NULL, adt_heap_topk_peek(topk));
+   for (i = 0; i < 1000; i++){
+      values[i] = (i * 7919) % 1000;
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_heap_topk_push(topk, &values[i], &pRejected));
+      if (i < 10){
+         CuAssertPtrEquals(tc, NULL, pRejected);
+      }
+      else{
+         CuAssertPtrNotNull(tc, pRejected);
+      }
+   }
+   CuAssertIntEquals(tc, 10, adt_heap_topk_length(topk));
+   CuAssertIntEquals(tc, 990, *((int32_t*) adt_heap_topk_peek(topk)));
+
+   //pushing a smaller element returns it immediately
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_heap_topk_push(topk, &values[0], &pRejected));
+   CuAssertPtrEquals(tc, &values[0], pRejected);
+
+   adt_ary_create(&result, NULL);
+   adt_ary_push(&result, &values[0]);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_heap_topk_drain(topk, &result));
+   CuAssertIntEquals(tc, 0, adt_heap_topk_length(topk));
+   CuAssertIntEquals(tc, 11, adt_ary_length(&result));
+   CuAssertPtrEquals(tc, &values[0], adt_ary_value(&result, 0)); //drain appends
+   for (i = 1; i < 11; i++){
+      CuAssertIntEquals(tc, 1000 - i, *((int32_t*) adt_ary_value(&result, i)));
+   }
+   adt_ary_destroy(&result);
+   adt_heap_topk_delete(topk);
+
+   //any non-zero return value from the compare function means less-than
+   topk = adt_heap_topk_new(10, i32_vlt_wide, true);
+   CuAssertPtrNotNull(tc, topk);
+   for (i = 0; i < 1000; i++){
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_heap_topk_push(topk, &values[i], &pRejected));
+   }
+   adt_ary_create(&result, NULL);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_heap_topk_drain(topk, &result));
+   CuAssertIntEquals(tc, 10, adt_ary_length(&result));
+   for (i = 0; i < 10; i++){
+      CuAssertIntEquals(tc, 999 - i, *((int32_t*) adt_ary_value(&result, i)));
+   }
+   adt_ary_destroy(&result);
+   adt_heap_topk_delete(topk);
+}
+
+static void test_pq_min_heap(CuTest* tc){
+   adt_pq_t pq;
+   adt_pq_elem_t elem;
+   int32_t items[100];
+   int32_t i;
+   adt_pq_create(&pq, ADT_MIN_HEAP);
+   CuAssertTrue(tc, adt_pq_is_empty(&pq));
+   CuAssertPtrEquals(tc, NULL, (void*) adt_pq_peek(&pq));
+   CuAssertIntEquals(tc, ADT_LENGTH_ERROR, adt_pq_pop(&pq, &elem));
+   for (i = 0; i < 100; i++){
+      items[i] = (i * 37) % 100;
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pq_push(&pq, &items[i], (uint64_t) items[i] + 0x100000000ull));
+   }
+   CuAssertIntEquals(tc, 100, adt_pq_length(&pq));
+   CuAssertTrue(tc, adt_pq_peek(&pq)->u64Priority == 0x100000000ull);
+   for (i = 0; i < 100; i++){
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pq_pop(&pq, &elem));
+      CuAssertIntEquals(tc, i, *((int32_t*) elem.pItem));
+      CuAssertTrue(tc, elem.u64Priority == ((uint64_t) i + 0x100000000ull));
+   }
+   CuAssertTrue(tc, adt_pq_is_empty(&pq));
+   adt_pq_destroy(&pq);
+}
+
+static void test_pq_max_heap_replace_top(CuTest* tc){
+   adt_pq_elem_t elem;
+   int32_t items[10] = {5, 3, 8, 1, 9, 2, 7, 4, 6, 0};
+   int32_t newItem = 100;
+   int32_t i;
+   adt_pq_t *pq = adt_pq_new(ADT_MAX_HEAP);
+   CuAssertPtrNotNull(tc, pq);
+   CuAssertIntEquals(tc, ADT_LENGTH_ERROR, adt_pq_replace_top(pq, &newItem, 0, NULL));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pq_reserve(pq, 10));
+   for (i = 0; i < 10; i++){
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pq_push(pq, &items[i], (uint64_t) items[i]));
+   }
+   CuAssertPtrEquals(tc, &items[4], adt_pq_peek(pq)->pItem);
+   //replace 9 with 4 (goes below several elements)
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pq_replace_top(pq, &newItem, 4, &elem));
+   CuAssertPtrEquals(tc, &items[4], elem.pItem);
+   CuAssertIntEquals(tc, 10, adt_pq_length(pq));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pq_pop(pq, &elem));
+   CuAssertTrue(tc, elem.u64Priority == 8u);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pq_pop(pq, &elem));
+   CuAssertTrue(tc, elem.u64Priority == 7u);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pq_pop(pq, &elem));
+   CuAssertTrue(tc, elem.u64Priority == 6u);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pq_pop(pq, &elem));
+   CuAssertTrue(tc, elem.u64Priority == 5u);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pq_pop(pq, &elem));
+   CuAssertTrue(tc, elem.u64Priority == 4u);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pq_pop(pq, NULL));
+   CuAssertIntEquals(tc, 4, adt_pq_length(pq));
+   adt_pq_clear(pq);
+   CuAssertTrue(tc, adt_pq_is_empty(pq));
+   adt_pq_delete(pq);
+}
+
+static void test_pq_arity(CuTest* tc){
+   int32_t arity;
+   adt_pq_t pq;
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_pq_create_arity(&pq, ADT_MIN_HEAP, 3));
+   CuAssertPtrEquals(tc, NULL, adt_pq_new_arity(ADT_MIN_HEAP, 16));
+   for (arity = 2; arity <= 8; arity *= 2){
+      int32_t i;
+      uint64_t u64Prev = 0u;
+      uint64_t u64Sum = 0u;
+      adt_pq_elem_t elem;
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pq_create_arity(&pq, ADT_MIN_HEAP, arity));
+      for (i = 0; i < 1000; i++){
+         uint64_t u64Priority = (uint64_t) ((i * 7919) % 1000);
+         CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pq_push(&pq, NULL, u64Priority));
+         u64Sum += u64Priority;
+      }
+      //children of the root start at a cache line boundary when a sibling group fills at least one cache line
+      if ( ((size_t) arity * sizeof(adt_pq_elem_t)) >= ADT_PQ_CACHE_LINE_SIZE ){
+         CuAssertTrue(tc, (((uintptr_t) &pq.pElems[1]) % ADT_PQ_CACHE_LINE_SIZE) == 0u);
+      }
+      //pop half, then push them back with replace_top
+      for (i = 0; i < 500; i++){
+         CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pq_pop(&pq, &elem));
+         CuAssertTrue(tc, elem.u64Priority == (uint64_t) i);
+      }
+      for (i = 0; i < 500; i++){
+         uint64_t u64Top = adt_pq_peek(&pq)->u64Priority;
+         CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pq_replace_top(&pq, NULL, u64Top + 1000u, &elem));
+         u64Sum += 1000u;
+      }
+      CuAssertIntEquals(tc, 500, adt_pq_length(&pq));
+      while (adt_pq_pop(&pq, &elem) == ADT_NO_ERROR){
+         CuAssertTrue(tc, elem.u64Priority >= u64Prev);
+         u64Prev = elem.u64Priority;
+         u64Sum -= elem.u64Priority;
+      }
+      //sum of remaining priorities equals the sum of the popped first half
+      CuAssertTrue(tc, u64Sum == (499u * 500u) / 2u);
+      adt_pq_destroy(&pq);
+   }
+}
+
+static void test_iheap_handles(CuTest* tc){
+   adt_iheap_t heap;
+   adt_heap_handle_t handles[5];
+   adt_pq_elem_t elem;
+   int32_t items[5] = {0, 1, 2, 3, 4};
+   int32_t i;
+   adt_iheap_create(&heap, ADT_MIN_HEAP);
+   CuAssertIntEquals(tc, ADT_HEAP_INVALID_HANDLE, adt_iheap_top(&heap));
+   CuAssertIntEquals(tc, ADT_LENGTH_ERROR, adt_iheap_pop(&heap, &elem));
+   for (i = 0; i < 5; i++){
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_iheap_push(&heap, &items[i], (uint64_t) (10 * (i + 1)), &handles[i]));
+   }
+   CuAssertIntEquals(tc, handles[0], adt_iheap_top(&heap));
+   //decrease_key moves element to the top
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_iheap_decrease_key(&heap, handles[4], 60));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_iheap_decrease_key(&heap, handles[4], 5));
+   CuAssertIntEquals(tc, handles[4], adt_iheap_top(&heap));
+   //increase_key moves element away from the top
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_iheap_increase_key(&heap, handles[4], 4));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_iheap_increase_key(&heap, handles[4], 100));
+   CuAssertIntEquals(tc, handles[0], adt_iheap_top(&heap));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_iheap_get(&heap, handles[4], &elem));
+   CuAssertPtrEquals(tc, &items[4], elem.pItem);
+   CuAssertTrue(tc, elem.u64Priority == 100u);
+   //remove from the middle
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_iheap_remove(&heap, handles[1], &elem));
+   CuAssertPtrEquals(tc, &items[1], elem.pItem);
+   CuAssertTrue(tc, !adt_iheap_contains(&heap, handles[1]));
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_iheap_remove(&heap, handles[1], NULL));
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_iheap_update(&heap, 99, 1));
+   CuAssertIntEquals(tc, 4, adt_iheap_length(&heap));
+   //removed handle is reused
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_iheap_push(&heap, &items[1], 15, &handles[1]));
+   CuAssertTrue(tc, adt_iheap_contains(&heap, handles[1]));
+   CuAssertIntEquals(tc, 5, heap.s32SlotLen);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_iheap_pop(&heap, &elem));
+   CuAssertPtrEquals(tc, &items[0], elem.pItem);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_iheap_pop(&heap, &elem));
+   CuAssertPtrEquals(tc, &items[1], elem.pItem);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_iheap_pop(&heap, &elem));
+   CuAssertPtrEquals(tc, &items[2], elem.pItem);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_iheap_pop(&heap, &elem));
+   CuAssertPtrEquals(tc, &items[3], elem.pItem);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_iheap_pop(&heap, &elem));
+   CuAssertPtrEquals(tc, &items[4], elem.pItem);
+   CuAssertTrue(tc, adt_iheap_is_empty(&heap));
+   adt_iheap_destroy(&heap);
+}
+
+/**
+ * Random mix of push, update, remove and pop checked against a plain array of priorities
+ */
+static void test_iheap_random(CuTest* tc){
+   enum {NUM_HANDLES = 200};
+   uint64_t expected[NUM_HANDLES];
+   bool inHeap[NUM_HANDLES];
+   uint32_t state = 1u;
+   int32_t i;
+   adt_iheap_t *heap = adt_iheap_new(ADT_MAX_HEAP);
+   for (i = 0; i < NUM_HANDLES; i++){
+      inHeap[i] = false;
+   }
+   for (i = 0; i < 5000; i++){
+      adt_heap_handle_t handle;
+      uint64_t u64Priority;
+      state = (state * 1103515245u) + 12345u;
+      u64Priority = (state >> 8) % 1000u;
+      handle = (adt_heap_handle_t) ((state >> 20) % NUM_HANDLES);
+      switch ((state >> 16) % 4u){
+      case 0:
+         if (adt_iheap_length(heap) < NUM_HANDLES){
+            CuAssertIntEquals(tc, ADT_NO_ERROR, adt_iheap_push(heap, NULL, u64Priority, &handle));
+            CuAssertTrue(tc, (handle >= 0) && (handle < NUM_HANDLES) && !inHeap[handle]);
+            inHeap[handle] = true;
+            expected[handle] = u64Priority;
+         }
+         break;
+      case 1:
+         CuAssertIntEquals(tc, inHeap[handle]? ADT_NO_ERROR : ADT_INVALID_ARGUMENT_ERROR, adt_iheap_update(heap, handle, u64Priority));
+         expected[handle] = u64Priority;
+         break;
+      case 2:
+         CuAssertIntEquals(tc, inHeap[handle]? ADT_NO_ERROR : ADT_INVALID_ARGUMENT_ERROR, adt_iheap_remove(heap, handle, NULL));
+         inHeap[handle] = false;
+         break;
+      default:
+         handle = adt_iheap_top(heap);
+         if (handle != ADT_HEAP_INVALID_HANDLE){
+            adt_heap_handle_t j;
+            adt_pq_elem_t elem;
+            for (j = 0; j < NUM_HANDLES; j++){
+               CuAssertTrue(tc, !inHeap[j] || (expected[j] <= expected[handle]));
+            }
+            CuAssertIntEquals(tc, ADT_NO_ERROR, adt_iheap_pop(heap, &elem));
+            CuAssertTrue(tc, elem.u64Priority == expected[handle]);
+            inHeap[handle] = false;
+         }
+         break;
+      }
+   }
+   adt_iheap_delete(heap);
+}
+
+static void test_heap_elem_u64(CuTest* tc){
+   adt_ary_t heap;
+   adt_heap_elem_t elem;
+   adt_heap_elem_t *pElem;
+
+   adt_heap_elem_create(&elem, NULL, 7);
+   CuAssertTrue(tc, adt_heap_elem_value(&elem) == 7u);
+   adt_heap_elem_create_u64(&elem, NULL, 0x100000003ull);
+   CuAssertUIntEquals(tc, 3, elem.u32Value);
+   CuAssertTrue(tc, adt_heap_elem_value(&elem) == 0x100000003ull);
+
+   //the upper 32 bits take part in the comparison
+   adt_ary_create(&heap, adt_heap_elem_vdelete);
+   adt_ary_push(&heap, adt_heap_elem_new_u64(NULL, 0x200000000ull));
+   adt_ary_push(&heap, adt_heap_elem_new(NULL, 0xFFFFFFFFu));
+   adt_ary_push(&heap, adt_heap_elem_new_u64(NULL, 0x100000000ull));
+   adt_heap_build(&heap, ADT_MIN_HEAP);
+   pElem = (adt_heap_elem_t*) adt_ary_value(&heap, 0);
+   CuAssertUIntEquals(tc, 0xFFFFFFFFu, pElem->u32Value);
+   adt_heap_build(&heap, ADT_MAX_HEAP);
+   pElem = (adt_heap_elem_t*) adt_ary_value(&heap, 0);
+   CuAssertTrue(tc, adt_heap_elem_value(pElem) == 0x200000000ull);
+   adt_ary_destroy(&heap);
+}
+
+static void test_heap_build_merge(CuTest* tc){
+   adt_ary_t heap1;
+   adt_ary_t heap2;
+   uint32_t state = 1u;
+   int32_t i;
+
+   adt_ary_create(&heap1, adt_heap_elem_vdelete);
+   adt_ary_create(&heap2, adt_heap_elem_vdelete);
+   adt_heap_build(&heap1, ADT_MIN_HEAP); //this shall have no effect
+   CuAssertIntEquals(tc, 0, adt_ary_length(&heap1));
+   adt_ary_resize(&heap1, 1000);
+   for (i = 0; i < 1000; i++){
+      state = (state * 1103515245u) + 12345u;
+      adt_ary_set(&heap1, i, adt_heap_elem_new(NULL, (state >> 8) % 500u));
+   }
+   adt_heap_build(&heap1, ADT_MIN_HEAP);
+   CuAssertTrue(tc, is_heap(&heap1, ADT_MIN_HEAP));
+
+   //small merge, elements are inserted one by one
+   for (i = 0; i < 10; i++){
+      adt_ary_push(&heap2, adt_heap_elem_new(NULL, (uint32_t) (i * 97)));
+      adt_heap_sortUp(&heap2, i, ADT_MIN_HEAP);
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_heap_merge(&heap1, &heap2, ADT_MIN_HEAP));
+   CuAssertIntEquals(tc, 1010, adt_ary_length(&heap1));
+   CuAssertIntEquals(tc, 0, adt_ary_length(&heap2));
+   CuAssertTrue(tc, is_heap(&heap1, ADT_MIN_HEAP));
+
+   //large merge, destination is rebuilt
+   adt_ary_resize(&heap2, 2000);
+   for (i = 0; i < 2000; i++){
+      state = (state * 1103515245u) + 12345u;
+      adt_ary_set(&heap2, i, adt_heap_elem_new(NULL, (state >> 8) % 500u));
+   }
+   adt_heap_build(&heap2, ADT_MIN_HEAP);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_heap_merge(&heap1, &heap2, ADT_MIN_HEAP));
+   CuAssertIntEquals(tc, 3010, adt_ary_length(&heap1));
+   CuAssertIntEquals(tc, 0, adt_ary_length(&heap2));
+   CuAssertTrue(tc, is_heap(&heap1, ADT_MIN_HEAP));
+
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_heap_merge(&heap1, &heap2, ADT_MIN_HEAP));
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_heap_merge(&heap1, &heap1, ADT_MIN_HEAP));
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_heap_merge(&heap1, NULL, ADT_MIN_HEAP));
+   adt_ary_destroy(&heap1);
+   adt_ary_destroy(&heap2);
+}
+
+static void test_heap_sort(CuTest* tc){
+   adt_ary_t heap;
+   uint32_t state = 7u;
+   int32_t i;
+
+   adt_ary_create(&heap, adt_heap_elem_vdelete);
+   adt_heap_sort(&heap, ADT_MIN_HEAP); //this shall have no effect
+   adt_ary_resize(&heap, 777);
+   for (i = 0; i < 777; i++){
+      state = (state * 1103515245u) + 12345u;
+      adt_ary_set(&heap, i, adt_heap_elem_new_u64(NULL, ((uint64_t) ((state >> 8) % 100u)) << 31));
+   }
+   adt_heap_sort(&heap, ADT_MIN_HEAP);
+   for (i = 1; i < 777; i++){
+      CuAssertTrue(tc, adt_heap_elem_value((adt_heap_elem_t*) adt_ary_value(&heap, i - 1)) <=
+                       adt_heap_elem_value((adt_heap_elem_t*) adt_ary_value(&heap, i)));
+   }
+   CuAssertTrue(tc, is_heap(&heap, ADT_MIN_HEAP));
+   adt_heap_sort(&heap, ADT_MAX_HEAP);
+   for (i = 1; i < 777; i++){
+      CuAssertTrue(tc, adt_heap_elem_value((adt_heap_elem_t*) adt_ary_value(&heap, i - 1)) >=
+                       adt_heap_elem_value((adt_heap_elem_t*) adt_ary_value(&heap, i)));
+   }
+   adt_ary_destroy(&heap);
+}
+
+static void test_mmheap_push_pop(CuTest* tc){
+   adt_pq_elem_t elem;
+   int32_t items[10] = {5, 3, 8, 1, 9, 2, 7, 4, 6, 0};
+   int32_t newItem = 100;
+   int32_t i;
+   adt_mmheap_t *heap = adt_mmheap_new();
+   CuAssertPtrNotNull(tc, heap);
+   CuAssertPtrEquals(tc, NULL, (void*) adt_mmheap_peek_min(heap));
+   CuAssertPtrEquals(tc, NULL, (void*) adt_mmheap_peek_max(heap));
+   CuAssertIntEquals(tc, ADT_LENGTH_ERROR, adt_mmheap_pop_min(heap, NULL));
+   CuAssertIntEquals(tc, ADT_LENGTH_ERROR, adt_mmheap_pop_max(heap, NULL));
+   CuAssertIntEquals(tc, ADT_LENGTH_ERROR, adt_mmheap_replace_max(heap, &newItem, 0, NULL));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mmheap_push(heap, &items[0], 5));
+   CuAssertPtrEquals(tc, &items[0], adt_mmheap_peek_min(heap)->pItem);
+   CuAssertPtrEquals(tc, &items[0], adt_mmheap_peek_max(heap)->pItem);
+   for (i = 1; i < 10; i++){
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mmheap_push(heap, &items[i], (uint64_t) items[i]));
+      CuAssertTrue(tc, is_mmheap(heap));
+   }
+   CuAssertIntEquals(tc, 10, adt_mmheap_length(heap));
+   CuAssertPtrEquals(tc, &items[9], adt_mmheap_peek_min(heap)->pItem);
+   CuAssertPtrEquals(tc, &items[4], adt_mmheap_peek_max(heap)->pItem);
+   //replace 9 with 100 and 0 with 4
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mmheap_replace_max(heap, &newItem, 100, &elem));
+   CuAssertPtrEquals(tc, &items[4], elem.pItem);
+   CuAssertPtrEquals(tc, &newItem, adt_mmheap_peek_max(heap)->pItem);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mmheap_replace_min(heap, &items[7], 4, &elem));
+   CuAssertPtrEquals(tc, &items[9], elem.pItem);
+   CuAssertTrue(tc, is_mmheap(heap));
+   //replace 100 with 0, which becomes the new lowest element
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mmheap_replace_max(heap, &items[9], 0, &elem));
+   CuAssertPtrEquals(tc, &newItem, elem.pItem);
+   CuAssertTrue(tc, is_mmheap(heap));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mmheap_pop_min(heap, &elem));
+   CuAssertTrue(tc, elem.u64Priority == 0u);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mmheap_pop_max(heap, &elem));
+   CuAssertTrue(tc, elem.u64Priority == 8u);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mmheap_pop_min(heap, &elem));
+   CuAssertTrue(tc, elem.u64Priority == 1u);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mmheap_pop_max(heap, &elem));
+   CuAssertTrue(tc, elem.u64Priority == 7u);
+   CuAssertIntEquals(tc, 6, adt_mmheap_length(heap));
+   adt_mmheap_clear(heap);
+   CuAssertTrue(tc, adt_mmheap_is_empty(heap));
+   adt_mmheap_delete(heap);
+}
+
+static void test_mmheap_random(CuTest* tc){
+   enum {MAX_LEN = 300};
+   uint64_t expected[MAX_LEN];
+   int32_t s32Len = 0;
+   uint32_t state = 3u;
+   adt_mmheap_t heap;
+   int32_t i;
+   adt_mmheap_create(&heap);
+   for (i = 0; i < 20000; i++){
+      adt_pq_elem_t elem;
+      uint64_t u64Priority;
+      uint32_t u32Op;
+      int32_t j;
+      int32_t s32Min = 0;
+      int32_t s32Max = 0;
+      state = (state * 1103515245u) + 12345u;
+      u64Priority = (state >> 8) % 500u;
+      u32Op = (state >> 20) % 5u;
+      for (j = 1; j < s32Len; j++){
+         s32Min = (expected[j] < expected[s32Min])? j : s32Min;
+         s32Max = (expected[j] > expected[s32Max])? j : s32Max;
+      }
+      if ( (s32Len < MAX_LEN) && ((u32Op <= 1u) || (s32Len == 0)) ){
+         CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mmheap_push(&heap, NULL, u64Priority));
+         expected[s32Len++] = u64Priority;
+      }
+      else if (u32Op == 2u){
+         CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mmheap_pop_min(&heap, &elem));
+         CuAssertTrue(tc, elem.u64Priority == expected[s32Min]);
+         expected[s32Min] = expected[--s32Len];
+      }
+      else if (u32Op == 3u){
+         CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mmheap_pop_max(&heap, &elem));
+         CuAssertTrue(tc, elem.u64Priority == expected[s32Max]);
+         expected[s32Max] = expected[--s32Len];
+      }
+      else if ((state & 0x100u) != 0u){
+         CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mmheap_replace_min(&heap, NULL, u64Priority, &elem));
+         CuAssertTrue(tc, elem.u64Priority == expected[s32Min]);
+         expected[s32Min] = u64Priority;
+      }
+      else{
+         CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mmheap_replace_max(&heap, NULL, u64Priority, &elem));
+         CuAssertTrue(tc, elem.u64Priority == expected[s32Max]);
+         expected[s32Max] = u64Priority;
+      }
+      CuAssertIntEquals(tc, s32Len, adt_mmheap_length(&heap));
+      CuAssertTrue(tc, is_mmheap(&heap));
+   }
+   adt_mmheap_destroy(&heap);
+}
+
+/**
+ * Same as adt_i32_vlt but returns 2 instead of 1
+ */
+static int i32_vlt_wide(const void *a, const void *b){
+   return (*((const int32_t*) a) < *((const int32_t*) b))? 2 : 0;
+}
+
+static bool is_heap(const adt_ary_t *heap, adt_heap_family family){
+   int32_t i;
+   for (i = 1; i < adt_ary_length(heap); i++){
+      uint64_t parentValue = adt_heap_elem_value((const adt_heap_elem_t*) adt_ary_value(heap, (i - 1) >> 1));
+      uint64_t childValue = adt_heap_elem_value((const adt_heap_elem_t*) adt_ary_value(heap, i));
+      if ( (family == ADT_MIN_HEAP)? (childValue < parentValue) : (childValue > parentValue) ){
+         return false;
+      }
+   }
+   return true;
+}
+
+static bool is_mmheap(const adt_mmheap_t *heap){
+   int32_t i;
+   for (i = 1; i < adt_mmheap_length(heap); i++){
+      //compare against all ancestors, which alternate between max and min levels going up
+      uint64_t value = heap->pElems[i].u64Priority;
+      int32_t s32Level = 0;
+      int32_t j;
+      for (j = i + 1; j > 1; j >>= 1){
+         s32Level++;
+      }
+      for (j = (i - 1) >> 1; s32Level > 0; j = (j - 1) >> 1){
+         s32Level--;
+         if ( ((s32Level & 1) == 0)? (heap->pElems[j].u64Priority > value) : (heap->pElems[j].u64Priority < value) ){
+            return false;
+         }
+         if (j == 0){
+            break;
+         }
+      }
+   }
+   return true;
+}
@@ -0,0 +1,242 @@
+/*****************************************************************************
+* \file      testsuite_adt_ilist.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for adt_ilist
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <assert.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CuTest.h"
+#include "adt_ilist.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define NUM_CONNS 10
+
+typedef struct conn_tag
+{
+   adt_ilist_node_t activeNode;
+   int32_t s32Id;
+   adt_ilist_node_t timeoutNode;
+} conn_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_adt_ilist_insert_remove(CuTest* tc);
+static void test_adt_ilist_multiple_lists(CuTest* tc);
+static void test_adt_ilist_remove_while_iterating(CuTest* tc);
+static void test_adt_ilist_move_concat(CuTest* tc);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+CuSuite* testsuite_adt_ilist(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_adt_ilist_insert_remove);
+   SUITE_ADD_TEST(suite, test_adt_ilist_multiple_lists);
+   SUITE_ADD_TEST(suite, test_adt_ilist_remove_while_iterating);
+   SUITE_ADD_TEST(suite, test_adt_ilist_move_concat);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void test_adt_ilist_insert_remove(CuTest* tc)
+{
+   adt_ilist_t list = ADT_ILIST_INIT(list);
+   conn_t conns[4];
+   adt_ilist_node_t *pNode;
+   int32_t i;
+   for (i = 0; i < 4; i++)
+   {
+      conns[i].s32Id = i;
+      adt_ilist_node_create(&conns[i].activeNode);
+      CuAssertTrue(tc, !adt_ilist_node_is_linked(&conns[i].activeNode));
+   }
+   CuAssertTrue(tc, adt_ilist_is_empty(&list));
+   CuAssertPtrEquals(tc, NULL, adt_ilist_first(&list));
+   CuAssertPtrEquals(tc, NULL, adt_ilist_last(&list));
+   adt_ilist_push_back(&list, &conns[1].activeNode);
+   adt_ilist_push_front(&list, &conns[0].activeNode);
+   adt_ilist_push_back(&list, &conns[3].activeNode);
+   adt_ilist_insert_after(&conns[1].activeNode, &conns[2].activeNode);
+   CuAssertIntEquals(tc, 4, adt_ilist_length(&list));
+   CuAssertTrue(tc, adt_ilist_node_is_linked(&conns[2].activeNode));
+   i = 0;
+   for (pNode = adt_ilist_first(&list); pNode != 0; pNode = adt_ilist_next(&list, pNode))
+   {
+      CuAssertIntEquals(tc, i++, ADT_ILIST_ENTRY(pNode, conn_t, activeNode)->s32Id);
+   }
+   CuAssertIntEquals(tc, 4, i);
+   for (pNode = adt_ilist_last(&list); pNode != 0; pNode = adt_ilist_prev(&list, pNode))
+   {
+      CuAssertIntEquals(tc, --i, ADT_ILIST_ENTRY(pNode, conn_t, activeNode)->s32Id);
+   }
+   adt_ilist_remove(&conns[0].activeNode);
+   adt_ilist_remove(&conns[0].activeNode); //no effect when not linked
+   adt_ilist_remove(&conns[3].activeNode);
+   CuAssertIntEquals(tc, 2, adt_ilist_length(&list));
+   CuAssertPtrEquals(tc, &conns[1].activeNode, adt_ilist_first(&list));
+   CuAssertPtrEquals(tc, &conns[2].activeNode, adt_ilist_last(&list));
+   adt_ilist_insert_before(&conns[1].activeNode, &conns[3].activeNode);
+   CuAssertPtrEquals(tc, &conns[3].activeNode, adt_ilist_pop_front(&list));
+   CuAssertPtrEquals(tc, &conns[1].activeNode, adt_ilist_pop_front(&list));
+   CuAssertPtrEquals(tc, &conns[2].activeNode, adt_ilist_pop_front(&list));
+   CuAssertPtrEquals(tc, NULL, adt_ilist_pop_front(&list));
+   CuAssertTrue(tc, adt_ilist_is_empty(&list));
+}
+
+static void test_adt_ilist_multiple_lists(CuTest* tc)
+{
+   adt_ilist_t activeList;
+   adt_ilist_t timeoutList;
+   conn_t conns[NUM_CONNS];
+   conn_t *pConn;
+   int32_t s32Sum = 0;
+   int32_t i;
+   adt_ilist_create(&activeList);
+   adt_ilist_create(&timeoutList);
+   for (i = 0; i < NUM_CONNS; i++)
+   {
+      conns[i].s32Id = i;
+      adt_ilist_push_back(&activeList, &conns[i].activeNode);
+      if ((i & 1) == 0)
+      {
+         adt_ilist_push_front(&timeoutList, &conns[i].timeoutNode);
+      }
+   }
+   CuAssertIntEquals(tc, NUM_CONNS, adt_ilist_length(&activeList));
+   CuAssertIntEquals(tc, NUM_CONNS / 2, adt_ilist_length(&timeoutList));
+   i = NUM_CONNS - 2;
+   ADT_ILIST_FOR_EACH_ENTRY(pConn, &timeoutList, conn_t, timeoutNode)
+   {
+      CuAssertIntEquals(tc, i, pConn->s32Id);
+      i -= 2;
+   }
+   ADT_ILIST_FOR_EACH_ENTRY(pConn, &activeList, conn_t, activeNode)
+   {
+      s32Sum += pConn->s32Id;
+   }
+   CuAssertIntEquals(tc, (NUM_CONNS * (NUM_CONNS - 1)) / 2, s32Sum);
+}
+
+static void test_adt_ilist_remove_while_iterating(CuTest* tc)
+{
+   adt_ilist_t list;
+   adt_ilist_t removed;
+   conn_t conns[NUM_CONNS];
+   conn_t *pConn;
+   conn_t *pTmp;
+   adt_ilist_node_t *pNode;
+   adt_ilist_node_t *pNext;
+   int32_t i;
+   adt_ilist_create(&list);
+   adt_ilist_create(&removed);
+   for (i = 0; i < NUM_CONNS; i++)
+   {
+      conns[i].s32Id = i;
+      adt_ilist_push_back(&list, &conns[i].activeNode);
+   }
+   //move odd entries to another list
+   ADT_ILIST_FOR_EACH_ENTRY_SAFE(pConn, pTmp, &list, conn_t, activeNode)
+   {
+      if ((pConn->s32Id & 1) != 0)
+      {
+         adt_ilist_move_back(&removed, &pConn->activeNode);
+      }
+   }
+   CuAssertIntEquals(tc, NUM_CONNS / 2, adt_ilist_length(&list));
+   CuAssertIntEquals(tc, NUM_CONNS / 2, adt_ilist_length(&removed));
+   i = 1;
+   ADT_ILIST_FOR_EACH(pNode, &removed)
+   {
+      CuAssertIntEquals(tc, i, ADT_ILIST_ENTRY(pNode, conn_t, activeNode)->s32Id);
+      i += 2;
+   }
+   //remove everything backwards
+   i = NUM_CONNS - 2;
+   ADT_ILIST_FOR_EACH_REVERSE_SAFE(pNode, pNext, &list)
+   {
+      CuAssertIntEquals(tc, i, ADT_ILIST_ENTRY(pNode, conn_t, activeNode)->s32Id);
+      adt_ilist_remove(pNode);
+      i -= 2;
+   }
+   CuAssertTrue(tc, adt_ilist_is_empty(&list));
+   ADT_ILIST_FOR_EACH_SAFE(pNode, pNext, &removed)
+   {
+      adt_ilist_remove(pNode);
+   }
+   CuAssertTrue(tc, adt_ilist_is_empty(&removed));
+   CuAssertTrue(tc, !adt_ilist_node_is_linked(&conns[1].activeNode));
+}
+
+static void test_adt_ilist_move_concat(CuTest* tc)
+{
+   adt_ilist_t list1;
+   adt_ilist_t list2;
+   conn_t conns[NUM_CONNS];
+   conn_t *pConn;
+   int32_t i;
+   adt_ilist_create(&list1);
+   adt_ilist_create(&list2);
+   adt_ilist_concat(&list1, &list2);
+   CuAssertTrue(tc, adt_ilist_is_empty(&list1));
+   for (i = 0; i < NUM_CONNS; i++)
+   {
+      conns[i].s32Id = i;
+      adt_ilist_push_back((i < 4)? &list1 : &list2, &conns[i].activeNode);
+   }
+   //LRU style: move to front
+   adt_ilist_move_front(&list1, &conns[3].activeNode);
+   CuAssertPtrEquals(tc, &conns[3].activeNode, adt_ilist_first(&list1));
+   adt_ilist_move_back(&list1, &conns[3].activeNode);
+   CuAssertPtrEquals(tc, &conns[3].activeNode, adt_ilist_last(&list1));
+   adt_ilist_concat(&list1, &list2);
+   CuAssertTrue(tc, adt_ilist_is_empty(&list2));
+   CuAssertIntEquals(tc, NUM_CONNS, adt_ilist_length(&list1));
+   i = 0;
+   ADT_ILIST_FOR_EACH_ENTRY(pConn, &list1, conn_t, activeNode)
+   {
+      CuAssertIntEquals(tc, i++, pConn->s32Id);
+   }
+   CuAssertPtrEquals(tc, &list1.head, conns[NUM_CONNS - 1].activeNode.pNext);
+   CuAssertPtrEquals(tc, &list1.head, conns[0].activeNode.pPrev);
+}
@@ -20,7 +20,17 @@ static void test_adt_list_insert_remove(CuTest* tc);
 static void test_adt_list_insert_unique(CuTest* tc);
 static void test_adt_list_insert_erase(CuTest* tc);
 static void test_adt_list_clear(CuTest* tc);
+static void test_adt_list_pooled(CuTest* tc);
+static void test_adt_list_splice(CuTest* tc);
+static void test_adt_list_sort(CuTest* tc);
+static void test_adt_list_index(CuTest* tc);
+static void test_adt_list_index_splice(CuTest* tc);
+static void test_adt_list_index_splice_duplicates(CuTest* tc);
+static void test_adt_list_index_duplicates(CuTest* tc);
 static void vfree(void *arg);
+static bool list_is_valid(const adt_list_t *list);
+static adt_list_elem_t *list_at(const adt_list_t *list, int32_t s32Index);
+static int key_vlt(const void *a, const void *b);
 
 /**************** Private Variable Declarations *******************/
 
@@ -35,6 +45,13 @@ CuSuite* testsuite_adt_list(void)
    SUITE_ADD_TEST(suite, test_adt_list_insert_unique);
    SUITE_ADD_TEST(suite, test_adt_list_insert_erase);
    SUITE_ADD_TEST(suite, test_adt_list_clear);
+   SUITE_ADD_TEST(suite, test_adt_list_pooled);
+   SUITE_ADD_TEST(suite, test_adt_list_splice);
+   SUITE_ADD_TEST(suite, test_adt_list_sort);
+   SUITE_ADD_TEST(suite, test_adt_list_index);
+   SUITE_ADD_TEST(suite, test_adt_list_index_splice);
+   SUITE_ADD_TEST(suite, test_adt_list_index_splice_duplicates);
+   SUITE_ADD_TEST(suite, test_adt_list_index_duplicates);
 
 
 
@@ -133,7 +150,399 @@ static void test_adt_list_clear(CuTest* tc)
    adt_list_delete(list);
 }
 
+static void test_adt_list_pooled(CuTest* tc)
+{
+   adt_list_t list1;
+   adt_list_t list2;
+   adt_pool_t pool;
+   adt_list_elem_t *iter;
+   char *hello=STRDUP("hello");
+   char *world=STRDUP("world");
+   int32_t items[3] = {0, 1, 2};
+   int32_t i;
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_create_pooled(&list1, vfree, 0));
+   adt_list_insert(&list1, world);
+   iter = adt_list_iter_first(&list1);
+   adt_list_insert_before(&list1, iter, hello);
+   CuAssertIntEquals(tc, 2, adt_list_length(&list1));
+   CuAssertIntEquals(tc, 2, adt_pool_num_used(list1.pPool));
+   CuAssertPtrEquals(tc, hello, adt_list_first(&list1));
+   CuAssertPtrEquals(tc, world, adt_list_last(&list1));
+   adt_list_destructor_enable(&list1, false);
+   adt_list_erase(&list1, iter);
+   CuAssertIntEquals(tc, 1, adt_pool_num_used(list1.pPool));
+   adt_list_destructor_enable(&list1, true);
+   adt_list_clear(&list1);
+   CuAssertPtrNotNull(tc, list1.pPool);
+   CuAssertIntEquals(tc, 0, adt_pool_num_used(list1.pPool));
+   adt_list_insert(&list1, world);
+   adt_list_destroy(&list1);
+
+   //two lists sharing one pool
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pool_create(&pool, 8, 0));
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_list_create_shared(&list1, NULL, &pool));
+   adt_pool_destroy(&pool);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pool_create(&pool, (uint32_t) sizeof(adt_list_elem_t), 8));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_create_shared(&list1, NULL, &pool));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_create_shared(&list2, NULL, &pool));
+   for (i = 0; i < 3; i++)
+   {
+      adt_list_insert(&list1, &items[i]);
+      adt_list_insert(&list2, &items[2 - i]);
+   }
+   CuAssertIntEquals(tc, 6, adt_pool_num_used(&pool));
+   CuAssertTrue(tc, adt_list_remove(&list1, &items[1]));
+   CuAssertIntEquals(tc, 5, adt_pool_num_used(&pool));
+   CuAssertPtrEquals(tc, &items[0], adt_list_first(&list1));
+   CuAssertPtrEquals(tc, &items[2], adt_list_last(&list1));
+   CuAssertPtrEquals(tc, &items[2], adt_list_first(&list2));
+   CuAssertPtrEquals(tc, &items[0], adt_list_last(&list2));
+   adt_list_destroy(&list1);
+   CuAssertIntEquals(tc, 3, adt_pool_num_used(&pool));
+   adt_list_destroy(&list2);
+   CuAssertIntEquals(tc, 0, adt_pool_num_used(&pool));
+   adt_pool_destroy(&pool);
+}
+
+static void test_adt_list_splice(CuTest* tc)
+{
+   adt_list_t list1;
+   adt_list_t list2;
+   adt_list_t list3;
+   int32_t items[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+   int32_t i;
+   adt_list_create(&list1, NULL);
+   adt_list_create(&list2, NULL);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_create_pooled(&list3, NULL, 0));
+   for (i = 0; i < 5; i++)
+   {
+      adt_list_insert(&list1, &items[i]);
+      adt_list_insert(&list2, &items[i + 5]);
+   }
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_list_concat(&list1, &list3)); //different allocators
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_list_concat(&list1, &list1));
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_list_splice(&list1, NULL, &list2, list_at(&list2, 0), NULL));
+   //move 6, 7 before 1 -> list1: 0 6 7 1 2 3 4, list2: 5 8 9
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_splice(&list1, list_at(&list1, 1), &list2, list_at(&list2, 1), list_at(&list2, 2)));
+   CuAssertIntEquals(tc, 7, adt_list_length(&list1));
+   CuAssertIntEquals(tc, 3, adt_list_length(&list2));
+   CuAssertTrue(tc, list_is_valid(&list1));
+   CuAssertTrue(tc, list_is_valid(&list2));
+   CuAssertPtrEquals(tc, &items[6], list_at(&list1, 1)->pItem);
+   CuAssertPtrEquals(tc, &items[7], list_at(&list1, 2)->pItem);
+   CuAssertPtrEquals(tc, &items[1], list_at(&list1, 3)->pItem);
+   //move 5 (first of list2) to the front of list1
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_splice(&list1, list_at(&list1, 0), &list2, list_at(&list2, 0), list_at(&list2, 0)));
+   CuAssertPtrEquals(tc, &items[5], adt_list_first(&list1));
+   CuAssertPtrEquals(tc, &items[8], adt_list_first(&list2));
+   //within the same list: move 5 0 6 to the end -> 7 1 2 3 4 5 0 6
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_list_splice(&list1, list_at(&list1, 1), &list1, list_at(&list1, 0), list_at(&list1, 2)));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_splice(&list1, NULL, &list1, list_at(&list1, 0), list_at(&list1, 2)));
+   CuAssertIntEquals(tc, 8, adt_list_length(&list1));
+   CuAssertTrue(tc, list_is_valid(&list1));
+   CuAssertPtrEquals(tc, &items[7], adt_list_first(&list1));
+   CuAssertPtrEquals(tc, &items[1], list_at(&list1, 1)->pItem);
+   CuAssertPtrEquals(tc, &items[0], list_at(&list1, 6)->pItem);
+   CuAssertPtrEquals(tc, &items[6], adt_list_last(&list1));
+   //concat
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_concat(&list1, &list2));
+   CuAssertIntEquals(tc, 10, adt_list_length(&list1));
+   CuAssertIntEquals(tc, 0, adt_list_length(&list2));
+   CuAssertTrue(tc, adt_list_is_empty(&list2));
+   CuAssertTrue(tc, list_is_valid(&list1));
+   CuAssertPtrEquals(tc, &items[9], adt_list_last(&list1));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_concat(&list2, &list1));
+   CuAssertIntEquals(tc, 10, adt_list_length(&list2));
+   CuAssertTrue(tc, list_is_valid(&list1));
+   CuAssertTrue(tc, list_is_valid(&list2));
+   adt_list_destroy(&list1);
+   adt_list_destroy(&list2);
+   adt_list_destroy(&list3);
+}
+
+static void test_adt_list_sort(CuTest* tc)
+{
+   adt_list_t list;
+   adt_list_elem_t *iter;
+   uint32_t items[1000];
+   uint32_t state = 5u;
+   int32_t i;
+   adt_list_create(&list, NULL);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_sort(&list, key_vlt, false));
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_list_sort(&list, NULL, false));
+   for (i = 0; i < 1000; i++)
+   {
+      //upper bits is the sort key, lower 16 bits keep the original order to check stability
+      state = (state * 1103515245u) + 12345u;
+      items[i] = (((state >> 16) % 50u) << 16) | (uint32_t) i;
+      adt_list_insert(&list, &items[i]);
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_sort(&list, key_vlt, false));
+   CuAssertIntEquals(tc, 1000, adt_list_length(&list));
+   CuAssertTrue(tc, list_is_valid(&list));
+   for (iter = list.pFirst; iter->pNext != 0; iter = iter->pNext)
+   {
+      CuAssertTrue(tc, *(uint32_t*) iter->pItem < *(uint32_t*) iter->pNext->pItem);
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_sort(&list, key_vlt, true));
+   CuAssertTrue(tc, list_is_valid(&list));
+   for (iter = list.pFirst; iter->pNext != 0; iter = iter->pNext)
+   {
+      uint32_t a = *(uint32_t*) iter->pItem;
+      uint32_t b = *(uint32_t*) iter->pNext->pItem;
+      CuAssertTrue(tc, ((a >> 16) > (b >> 16)) || (((a >> 16) == (b >> 16)) && (a < b)));
+   }
+   adt_list_destroy(&list);
+}
+
+static void test_adt_list_index(CuTest* tc)
+{
+   adt_list_t list;
+   adt_list_elem_t *iter;
+   int32_t items[100];
+   int32_t i;
+   adt_list_create(&list, NULL);
+   for (i = 0; i < 100; i++)
+   {
+      items[i] = i;
+   }
+   for (i = 0; i < 50; i++)
+   {
+      adt_list_insert(&list, &items[i]);
+   }
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_list_index_enable(NULL, true));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_index_enable(&list, true));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_index_enable(&list, true)); //already enabled
+   for (i = 50; i < 100; i++)
+   {
+      if (i & 1)
+      {
+         adt_list_insert_before(&list, list.pFirst, &items[i]);
+      }
+      else
+      {
+         adt_list_insert_after(&list, list.pFirst, &items[i]);
+      }
+   }
+   CuAssertIntEquals(tc, 100, adt_list_length(&list));
+   for (i = 0; i < 100; i++)
+   {
+      iter = adt_list_find(&list, &items[i]);
+      CuAssertPtrNotNull(tc, iter);
+      CuAssertPtrEquals(tc, &items[i], iter->pItem);
+   }
+   CuAssertPtrEquals(tc, NULL, adt_list_find(&list, &i));
+   adt_list_insert_unique(&list, &items[10]);
+   CuAssertIntEquals(tc, 100, adt_list_length(&list));
+   //remove every third item
+   for (i = 0; i < 100; i += 3)
+   {
+      CuAssertTrue(tc, adt_list_remove(&list, &items[i]));
+      CuAssertTrue(tc, !adt_list_remove(&list, &items[i]));
+   }
+   CuAssertIntEquals(tc, 66, adt_list_length(&list));
+   CuAssertTrue(tc, list_is_valid(&list));
+   for (i = 0; i < 100; i++)
+   {
+      CuAssertTrue(tc, (adt_list_find(&list, &items[i]) == 0) == ((i % 3) == 0));
+   }
+   adt_list_insert_unique(&list, &items[0]);
+   CuAssertPtrEquals(tc, &items[0], adt_list_last(&list));
+   //duplicates, the index keeps track of all elements holding the same item
+   adt_list_insert(&list, &items[1]);
+   adt_list_insert(&list, &items[1]);
+   CuAssertIntEquals(tc, 69, adt_list_length(&list));
+   CuAssertTrue(tc, adt_list_remove(&list, &items[1]));
+   CuAssertTrue(tc, adt_list_remove(&list, &items[1]));
+   CuAssertTrue(tc, adt_list_remove(&list, &items[1]));
+   CuAssertTrue(tc, !adt_list_remove(&list, &items[1]));
+   CuAssertIntEquals(tc, 66, adt_list_length(&list));
+   //sort relinks nodes without affecting the index
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_sort(&list, adt_i32_vlt, false));
+   CuAssertPtrEquals(tc, &items[2], adt_list_find(&list, &items[2])->pItem);
+   adt_list_erase(&list, adt_list_find(&list, &items[2]));
+   CuAssertPtrEquals(tc, NULL, adt_list_find(&list, &items[2]));
+   adt_list_clear(&list);
+   CuAssertPtrEquals(tc, NULL, adt_list_find(&list, &items[4]));
+   adt_list_insert_unique(&list, &items[4]);
+   adt_list_insert_unique(&list, &items[4]);
+   CuAssertIntEquals(tc, 1, adt_list_length(&list));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_index_enable(&list, false));
+   CuAssertPtrEquals(tc, NULL, list.pIndex);
+   CuAssertPtrEquals(tc, &items[4], adt_list_find(&list, &items[4])->pItem);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_index_enable(&list, true));
+   adt_list_destroy(&list);
+}
+
+static void test_adt_list_index_splice(CuTest* tc)
+{
+   adt_list_t list1;
+   adt_list_t list2;
+   int32_t items[10];
+   int32_t i;
+   adt_list_create(&list1, NULL);
+   adt_list_create(&list2, NULL);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_index_enable(&list1, true));
+   for (i = 0; i < 5; i++)
+   {
+      adt_list_insert(&list1, &items[i]);
+      adt_list_insert(&list2, &items[i + 5]);
+   }
+   adt_list_insert(&list1, &items[1]); //list1: 0 1 2 3 4 1
+   //move 1 2 from list1 (indexed) to list2 -> list1: 0 3 4 1, list2: 5 6 7 8 9 1 2
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_splice(&list2, NULL, &list1, list_at(&list1, 1), list_at(&list1, 2)));
+   CuAssertTrue(tc, list_is_valid(&list1));
+   CuAssertTrue(tc, list_is_valid(&list2));
+   CuAssertPtrEquals(tc, NULL, adt_list_find(&list1, &items[2]));
+   CuAssertPtrEquals(tc, list_at(&list1, 3), adt_list_find(&list1, &items[1]));
+   //move 8 9 from list2 to list1 (indexed)
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_splice(&list1, list1.pFirst, &list2, list_at(&list2, 3), list_at(&list2, 4)));
+   CuAssertPtrEquals(tc, list_at(&list1, 0), adt_list_find(&list1, &items[8]));
+   CuAssertPtrEquals(tc, list_at(&list1, 1), adt_list_find(&list1, &items[9]));
+   CuAssertIntEquals(tc, 6, adt_list_length(&list1));
+   //both lists indexed, move everything
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_index_enable(&list2, true));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_concat(&list2, &list1));
+   CuAssertTrue(tc, adt_list_is_empty(&list1));
+   CuAssertPtrEquals(tc, NULL, adt_list_find(&list1, &items[0]));
+   CuAssertIntEquals(tc, 11, adt_list_length(&list2));
+   for (i = 0; i < 10; i++)
+   {
+      CuAssertPtrEquals(tc, &items[i], adt_list_find(&list2, &items[i])->pItem);
+   }
+   CuAssertTrue(tc, adt_list_remove(&list2, &items[1]));
+   CuAssertTrue(tc, adt_list_remove(&list2, &items[1]));
+   CuAssertTrue(tc, !adt_list_remove(&list2, &items[1]));
+   CuAssertTrue(tc, list_is_valid(&list2));
+   adt_list_destroy(&list1);
+   adt_list_destroy(&list2);
+}
+
+static void test_adt_list_index_splice_duplicates(CuTest* tc)
+{
+   adt_list_t list1;
+   adt_list_t list2;
+   int32_t items[2];
+   adt_list_create(&list1, NULL);
+   adt_list_create(&list2, NULL);
+   adt_list_insert(&list1, &items[0]);
+   adt_list_insert(&list1, &items[0]);
+   adt_list_insert(&list1, &items[1]);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_index_enable(&list1, true));
+   //the moved range holds every copy of items[0] -> list1: 1, list2: 0 0
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_splice(&list2, NULL, &list1, list1.pFirst, list1.pFirst->pNext));
+   CuAssertTrue(tc, list_is_valid(&list1));
+   CuAssertTrue(tc, list_is_valid(&list2));
+   CuAssertPtrEquals(tc, NULL, adt_list_find(&list1, &items[0]));
+   CuAssertPtrEquals(tc, list1.pFirst, adt_list_find(&list1, &items[1]));
+   CuAssertTrue(tc, !adt_list_remove(&list1, &items[0]));
+   //the moved range holds the indexed copy of items[0] but not the last one -> list1: 1 0, list2: 0
+   adt_list_insert(&list1, &items[0]);
+   adt_list_insert(&list1, &items[0]);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_splice(&list2, NULL, &list1, list_at(&list1, 1), list_at(&list1, 1)));
+   CuAssertIntEquals(tc, 2, adt_list_length(&list1));
+   CuAssertIntEquals(tc, 3, adt_list_length(&list2));
+   CuAssertPtrEquals(tc, list1.pLast, adt_list_find(&list1, &items[0]));
+   CuAssertTrue(tc, adt_list_remove(&list1, &items[0]));
+   CuAssertTrue(tc, !adt_list_remove(&list1, &items[0]));
+   CuAssertTrue(tc, adt_list_remove(&list1, &items[1]));
+   CuAssertTrue(tc, adt_list_is_empty(&list1));
+   CuAssertTrue(tc, list_is_valid(&list1));
+   adt_list_destroy(&list1);
+   adt_list_destroy(&list2);
+}
+
+static void test_adt_list_index_duplicates(CuTest* tc)
+{
+   adt_list_t list;
+   adt_list_elem_t *pElems[5];
+   int32_t items[2];
+   int32_t i;
+   adt_list_create(&list, NULL);
+   adt_list_insert(&list, &items[0]);
+   adt_list_insert(&list, &items[1]);
+   adt_list_insert(&list, &items[0]);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_list_index_enable(&list, true));
+   //elements already in the list are indexed in list order
+   CuAssertPtrEquals(tc, list.pLast, adt_list_find(&list, &items[0]));
+   adt_list_clear(&list);
+   //list: 0 1 0 1 0 1 0 1 0 1, find returns the element added last
+   for (i = 0; i < 5; i++)
+   {
+      adt_list_insert(&list, &items[0]);
+      pElems[i] = list.pLast;
+      adt_list_insert(&list, &items[1]);
+      CuAssertPtrEquals(tc, pElems[i], adt_list_find(&list, &items[0]));
+   }
+   adt_list_insert_before(&list, list.pFirst, &items[0]);
+   CuAssertPtrEquals(tc, list.pFirst, adt_list_find(&list, &items[0]));
+   adt_list_erase(&list, list.pFirst);
+   CuAssertPtrEquals(tc, pElems[4], adt_list_find(&list, &items[0]));
+   //erase from the middle of the chain of elements holding items[0]
+   adt_list_erase(&list, pElems[2]);
+   adt_list_erase(&list, pElems[0]);
+   CuAssertPtrEquals(tc, pElems[4], adt_list_find(&list, &items[0]));
+   CuAssertTrue(tc, adt_list_remove(&list, &items[0]));
+   CuAssertPtrEquals(tc, pElems[3], adt_list_find(&list, &items[0]));
+   CuAssertTrue(tc, adt_list_remove(&list, &items[0]));
+   CuAssertPtrEquals(tc, pElems[1], adt_list_find(&list, &items[0]));
+   CuAssertTrue(tc, adt_list_remove(&list, &items[0]));
+   CuAssertTrue(tc, !adt_list_remove(&list, &items[0]));
+   CuAssertIntEquals(tc, 5, adt_list_length(&list));
+   for (i = 0; i < 5; i++)
+   {
+      CuAssertTrue(tc, adt_list_remove(&list, &items[1]));
+   }
+   CuAssertTrue(tc, adt_list_is_empty(&list));
+   CuAssertTrue(tc, list_is_valid(&list));
+   //an item can be added again after all of its elements are gone
+   adt_list_insert(&list, &items[0]);
+   adt_list_insert(&list, &items[0]);
+   CuAssertPtrEquals(tc, list.pLast, adt_list_find(&list, &items[0]));
+   adt_list_erase(&list, list.pLast);
+   CuAssertPtrEquals(tc, list.pFirst, adt_list_find(&list, &items[0]));
+   adt_list_destroy(&list);
+}
+
 static void vfree(void *arg)
 {
    free(arg);
 }
+
+/**
+ * Checks forward and backward links against pFirst, pLast and the cached length
+ */
+static bool list_is_valid(const adt_list_t *list)
+{
+   adt_list_elem_t *iter;
+   adt_list_elem_t *pPrev = 0;
+   int32_t s32Len = 0;
+   for (iter = list->pFirst; iter != 0; iter = iter->pNext)
+   {
+      if (iter->pPrev != pPrev)
+      {
+         return false;
+      }
+      pPrev = iter;
+      s32Len++;
+   }
+   return (pPrev == list->pLast) && (s32Len == adt_list_length(list));
+}
+
+static adt_list_elem_t *list_at(const adt_list_t *list, int32_t s32Index)
+{
+   adt_list_elem_t *iter = list->pFirst;
+   while ( (iter != 0) && (s32Index-- > 0) )
+   {
+      iter = iter->pNext;
+   }
+   return iter;
+}
+
+/**
+ * Compares the upper 16 bits only
+ */
+static int key_vlt(const void *a, const void *b)
+{
+   return ((*(const uint32_t*) a) >> 16) < ((*(const uint32_t*) b) >> 16);
+}
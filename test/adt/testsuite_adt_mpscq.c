@@ -0,0 +1,327 @@
+/*****************************************************************************
+* \file      testsuite_adt_mpscq.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for adt_mpscq
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <assert.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CuTest.h"
+#include "adt_mpscq.h"
+#if (ADT_THREADS_ENABLE) && (ADT_ATOMICS_ENABLE)
+#include <pthread.h>
+#endif
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define NUM_ELEMENTS 100
+#define NUM_THREADS 4
+#define NUM_THREAD_OPERATIONS 20000
+
+typedef struct msg_tag
+{
+   int32_t s32Producer;
+   int32_t s32Seq;
+   adt_mpscq_node_t node;
+} msg_t;
+
+#if (ADT_THREADS_ENABLE) && (ADT_ATOMICS_ENABLE)
+typedef struct thread_arg_tag
+{
+   adt_mpscq_t *queue;
+   msg_t *pMsgs;
+} thread_arg_t;
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_adt_mpscq_push_pop(CuTest* tc);
+static void test_adt_mpscq_pop_all(CuTest* tc);
+#if (ADT_THREADS_ENABLE) && (ADT_ATOMICS_ENABLE)
+static void test_adt_mpscq_threads(CuTest* tc);
+static void test_adt_mpscq_pop_all_threads(CuTest* tc);
+static void* thread_main(void *arg);
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+CuSuite* testsuite_adt_mpscq(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_adt_mpscq_push_pop);
+   SUITE_ADD_TEST(suite, test_adt_mpscq_pop_all);
+#if (ADT_THREADS_ENABLE) && (ADT_ATOMICS_ENABLE)
+   SUITE_ADD_TEST(suite, test_adt_mpscq_threads);
+   SUITE_ADD_TEST(suite, test_adt_mpscq_pop_all_threads);
+#endif
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+static void test_adt_mpscq_push_pop(CuTest* tc)
+{
+   adt_mpscq_t *queue;
+   msg_t msgs[NUM_ELEMENTS];
+   adt_mpscq_node_t *pNode;
+   int32_t i;
+
+   queue = adt_mpscq_new();
+   CuAssertPtrNotNull(tc, queue);
+   CuAssertTrue(tc, adt_mpscq_is_empty(queue));
+   CuAssertPtrEquals(tc, NULL, adt_mpscq_pop(queue));
+   //one element at a time, the stub is pushed back behind it every time
+   for (i = 0; i < 3; i++)
+   {
+      msgs[i].s32Seq = i;
+      adt_mpscq_push(queue, &msgs[i].node);
+      CuAssertTrue(tc, !adt_mpscq_is_empty(queue));
+      pNode = adt_mpscq_pop(queue);
+      CuAssertPtrEquals(tc, &msgs[i], ADT_MPSCQ_ENTRY(pNode, msg_t, node));
+      CuAssertTrue(tc, adt_mpscq_is_empty(queue));
+      CuAssertPtrEquals(tc, NULL, adt_mpscq_pop(queue));
+   }
+   //FIFO order, interleaving pushes and pops
+   for (i = 0; i < NUM_ELEMENTS; i++)
+   {
+      msgs[i].s32Seq = i;
+      adt_mpscq_push(queue, &msgs[i].node);
+   }
+   for (i = 0; i < NUM_ELEMENTS / 2; i++)
+   {
+      pNode = adt_mpscq_pop(queue);
+      CuAssertPtrNotNull(tc, pNode);
+      CuAssertIntEquals(tc, i, ADT_MPSCQ_ENTRY(pNode, msg_t, node)->s32Seq);
+      adt_mpscq_push(queue, pNode); //a popped node can be pushed again
+   }
+   for (i = 0; i < NUM_ELEMENTS; i++)
+   {
+      pNode = adt_mpscq_pop(queue);
+      CuAssertPtrNotNull(tc, pNode);
+      CuAssertIntEquals(tc, (i + (NUM_ELEMENTS / 2)) % NUM_ELEMENTS, ADT_MPSCQ_ENTRY(pNode, msg_t, node)->s32Seq);
+   }
+   CuAssertPtrEquals(tc, NULL, adt_mpscq_pop(queue));
+   CuAssertTrue(tc, adt_mpscq_is_empty(queue));
+   adt_mpscq_push(NULL, &msgs[0].node);
+   CuAssertPtrEquals(tc, NULL, adt_mpscq_pop(NULL));
+   adt_mpscq_delete(queue);
+}
+
+static void test_adt_mpscq_pop_all(CuTest* tc)
+{
+   adt_mpscq_t queue;
+   msg_t msgs[NUM_ELEMENTS];
+   adt_mpscq_node_t *pNode;
+   int32_t i;
+
+   adt_mpscq_create(&queue);
+   CuAssertPtrEquals(tc, NULL, adt_mpscq_pop_all(&queue));
+   for (i = 0; i < NUM_ELEMENTS; i++)
+   {
+      msgs[i].s32Seq = i;
+      adt_mpscq_push(&queue, &msgs[i].node);
+   }
+   pNode = adt_mpscq_pop(&queue);
+   CuAssertPtrEquals(tc, &msgs[0].node, pNode);
+   pNode = adt_mpscq_pop_all(&queue);
+   CuAssertTrue(tc, adt_mpscq_is_empty(&queue));
+   for (i = 1; i < NUM_ELEMENTS; i++)
+   {
+      CuAssertPtrNotNull(tc, pNode);
+      CuAssertIntEquals(tc, i, ADT_MPSCQ_ENTRY(pNode, msg_t, node)->s32Seq);
+      pNode = adt_mpscq_node_next(pNode);
+   }
+   CuAssertPtrEquals(tc, NULL, pNode);
+   //the queue keeps working after the batch has been taken
+   adt_mpscq_push(&queue, &msgs[5].node);
+   adt_mpscq_push(&queue, &msgs[7].node);
+   pNode = adt_mpscq_pop_all(&queue);
+   CuAssertPtrEquals(tc, &msgs[5].node, pNode);
+   CuAssertPtrEquals(tc, &msgs[7].node, adt_mpscq_node_next(pNode));
+   CuAssertPtrEquals(tc, NULL, adt_mpscq_node_next(adt_mpscq_node_next(pNode)));
+   CuAssertPtrEquals(tc, NULL, adt_mpscq_pop_all(&queue));
+   //drained by pop, the stub is the newest node
+   adt_mpscq_push(&queue, &msgs[3].node);
+   CuAssertPtrEquals(tc, &msgs[3].node, adt_mpscq_pop(&queue));
+   CuAssertPtrEquals(tc, NULL, adt_mpscq_pop_all(&queue));
+   adt_mpscq_push(&queue, &msgs[4].node);
+   pNode = adt_mpscq_pop_all(&queue);
+   CuAssertPtrEquals(tc, &msgs[4].node, pNode);
+   CuAssertPtrEquals(tc, NULL, adt_mpscq_node_next(pNode));
+   //a push lands after pop has found its node to be the last one: the stub ends up behind the new node.
+   //This is the state pop leaves when pushing the stub races with a producer (pTail != stub, pHead == stub)
+   adt_mpscq_push(&queue, &msgs[0].node);
+   adt_mpscq_push(&queue, &msgs[1].node);
+   CuAssertPtrEquals(tc, &msgs[0].node, adt_mpscq_pop(&queue));
+   adt_mpscq_push(&queue, &queue.stub);
+   CuAssertPtrEquals(tc, &msgs[1].node, queue.pTail);
+   CuAssertTrue(tc, !adt_mpscq_is_empty(&queue));
+   pNode = adt_mpscq_pop_all(&queue);
+   CuAssertPtrEquals(tc, &msgs[1].node, pNode);
+   CuAssertPtrEquals(tc, NULL, adt_mpscq_node_next(pNode));
+   CuAssertTrue(tc, adt_mpscq_is_empty(&queue));
+   adt_mpscq_push(&queue, &msgs[2].node);
+   pNode = adt_mpscq_pop_all(&queue);
+   CuAssertPtrEquals(tc, &msgs[2].node, pNode);
+   CuAssertPtrEquals(tc, NULL, adt_mpscq_node_next(pNode));
+   adt_mpscq_destroy(&queue);
+}
+
+#if (ADT_THREADS_ENABLE) && (ADT_ATOMICS_ENABLE)
+/**
+ * NUM_THREADS producers push NUM_THREAD_OPERATIONS messages each while the test thread consumes them with
+ * pop and pop_all. Every message must arrive exactly once and in order per producer.
+ */
+static void test_adt_mpscq_threads(CuTest* tc)
+{
+   adt_mpscq_t queue;
+   pthread_t threads[NUM_THREADS];
+   thread_arg_t args[NUM_THREADS];
+   int32_t nextSeq[NUM_THREADS];
+   msg_t *pMsgs;
+   int32_t s32NumReceived = 0;
+   int32_t s32NumErrors = 0;
+   int32_t i;
+
+   //no allocations in the worker threads
+   pMsgs = (msg_t*) malloc(sizeof(msg_t) * NUM_THREADS * NUM_THREAD_OPERATIONS);
+   CuAssertPtrNotNull(tc, pMsgs);
+   adt_mpscq_create(&queue);
+   for (i = 0; i < NUM_THREADS; i++)
+   {
+      nextSeq[i] = 0;
+      args[i].queue = &queue;
+      args[i].pMsgs = &pMsgs[i * NUM_THREAD_OPERATIONS];
+   }
+   for (i = 0; i < NUM_THREAD_OPERATIONS * NUM_THREADS; i++)
+   {
+      pMsgs[i].s32Producer = i / NUM_THREAD_OPERATIONS;
+      pMsgs[i].s32Seq = i % NUM_THREAD_OPERATIONS;
+   }
+   for (i = 0; i < NUM_THREADS; i++)
+   {
+      CuAssertIntEquals(tc, 0, pthread_create(&threads[i], NULL, thread_main, &args[i]));
+   }
+   while (s32NumReceived < (NUM_THREADS * NUM_THREAD_OPERATIONS))
+   {
+      //alternate between single pops and batches
+      bool isBatch = ((s32NumReceived & 1) == 0);
+      adt_mpscq_node_t *pNode = isBatch? adt_mpscq_pop_all(&queue) : adt_mpscq_pop(&queue);
+      while (pNode != 0)
+      {
+         msg_t *pMsg = ADT_MPSCQ_ENTRY(pNode, msg_t, node);
+         if (pMsg->s32Seq != nextSeq[pMsg->s32Producer]++)
+         {
+            s32NumErrors++;
+         }
+         s32NumReceived++;
+         pNode = isBatch? adt_mpscq_node_next(pNode) : (adt_mpscq_node_t*) 0;
+      }
+   }
+   for (i = 0; i < NUM_THREADS; i++)
+   {
+      pthread_join(threads[i], NULL);
+      CuAssertIntEquals(tc, NUM_THREAD_OPERATIONS, nextSeq[i]);
+   }
+   CuAssertIntEquals(tc, 0, s32NumErrors);
+   CuAssertTrue(tc, adt_mpscq_is_empty(&queue));
+   adt_mpscq_destroy(&queue);
+   free(pMsgs);
+}
+
+/**
+ * One producer keeps pushing while the test thread takes batches with pop_all only. The queue is empty most of the
+ * time the consumer calls pop_all, so many calls snapshot the stub while the producer is pushing.
+ */
+static void test_adt_mpscq_pop_all_threads(CuTest* tc)
+{
+   adt_mpscq_t queue;
+   pthread_t thread;
+   thread_arg_t arg;
+   msg_t *pMsgs;
+   int32_t s32NextSeq = 0;
+   int32_t s32NumErrors = 0;
+   int32_t i;
+
+   pMsgs = (msg_t*) malloc(sizeof(msg_t) * NUM_THREAD_OPERATIONS);
+   CuAssertPtrNotNull(tc, pMsgs);
+   adt_mpscq_create(&queue);
+   for (i = 0; i < NUM_THREAD_OPERATIONS; i++)
+   {
+      pMsgs[i].s32Producer = 0;
+      pMsgs[i].s32Seq = i;
+   }
+   arg.queue = &queue;
+   arg.pMsgs = pMsgs;
+   CuAssertIntEquals(tc, 0, pthread_create(&thread, NULL, thread_main, &arg));
+   while (s32NextSeq < NUM_THREAD_OPERATIONS)
+   {
+      adt_mpscq_node_t *pNode = adt_mpscq_pop_all(&queue);
+      while (pNode != 0)
+      {
+         if (ADT_MPSCQ_ENTRY(pNode, msg_t, node)->s32Seq != s32NextSeq++)
+         {
+            s32NumErrors++;
+         }
+         pNode = adt_mpscq_node_next(pNode);
+      }
+   }
+   pthread_join(thread, NULL);
+   CuAssertIntEquals(tc, 0, s32NumErrors);
+   CuAssertIntEquals(tc, NUM_THREAD_OPERATIONS, s32NextSeq);
+   CuAssertPtrEquals(tc, NULL, adt_mpscq_pop_all(&queue));
+   CuAssertTrue(tc, adt_mpscq_is_empty(&queue));
+   adt_mpscq_destroy(&queue);
+   free(pMsgs);
+}
+
+static void* thread_main(void *arg)
+{
+   thread_arg_t *pArg = (thread_arg_t*) arg;
+   int32_t i;
+   for (i = 0; i < NUM_THREAD_OPERATIONS; i++)
+   {
+      adt_mpscq_push(pArg->queue, &pArg->pMsgs[i].node);
+   }
+   return (void*) 0;
+}
+#endif
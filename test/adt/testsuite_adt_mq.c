@@ -0,0 +1,232 @@
+/*****************************************************************************
+* \file      testsuite_adt_mq.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for adt_mq
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <assert.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CuTest.h"
+#include "adt_mq.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define NUM_ELEMENTS 1000
+#define NUM_THREADS 4
+#define NUM_THREAD_OPERATIONS 20000
+
+#if (ADT_THREADS_ENABLE)
+typedef struct thread_arg_tag
+{
+   adt_mq_t *mq;
+   uint32_t u32Seed;
+   uint64_t u64PushSum;
+   uint64_t u64PopSum;
+   int32_t s32NumErrors;
+} thread_arg_t;
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_adt_mq_single_queue(CuTest* tc);
+static void test_adt_mq_relaxed(CuTest* tc);
+#if (ADT_THREADS_ENABLE)
+static void test_adt_mq_threads(CuTest* tc);
+static void* thread_main(void *arg);
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+CuSuite* testsuite_adt_mq(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_adt_mq_single_queue);
+   SUITE_ADD_TEST(suite, test_adt_mq_relaxed);
+#if (ADT_THREADS_ENABLE)
+   SUITE_ADD_TEST(suite, test_adt_mq_threads);
+#endif
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+static void test_adt_mq_single_queue(CuTest* tc)
+{
+   adt_mq_t *mq;
+   adt_pq_elem_t elem;
+   int values[4] = {0, 1, 2, 3};
+
+   CuAssertPtrEquals(tc, NULL, adt_mq_new(ADT_MIN_HEAP, 0));
+   mq = adt_mq_new(ADT_MIN_HEAP, 1);
+   CuAssertPtrNotNull(tc, mq);
+   CuAssertIntEquals(tc, 1, adt_mq_num_queues(mq));
+   CuAssertIntEquals(tc, ADT_LENGTH_ERROR, adt_mq_pop(mq, &elem));
+
+   //with one queue the order is exact
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mq_push(mq, &values[2], 20u));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mq_push(mq, &values[0], 5u));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mq_push(mq, &values[3], 30u));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mq_push(mq, &values[1], 10u));
+   CuAssertIntEquals(tc, 4, adt_mq_length(mq));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mq_pop(mq, &elem));
+   CuAssertPtrEquals(tc, &values[0], elem.pItem);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mq_pop(mq, &elem));
+   CuAssertPtrEquals(tc, &values[1], elem.pItem);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mq_pop(mq, &elem));
+   CuAssertTrue(tc, elem.u64Priority == 20u);
+   CuAssertIntEquals(tc, 1, adt_mq_length(mq));
+   adt_mq_clear(mq);
+   CuAssertIntEquals(tc, 0, adt_mq_length(mq));
+   CuAssertIntEquals(tc, ADT_LENGTH_ERROR, adt_mq_pop(mq, &elem));
+   adt_mq_delete(mq);
+}
+
+static void test_adt_mq_relaxed(CuTest* tc)
+{
+   adt_mq_t mq;
+   adt_pq_elem_t elem;
+   uint64_t u64PushSum = 0u;
+   uint64_t u64PopSum = 0u;
+   uint64_t u64RankSum = 0u;
+   int32_t s32Expected;
+   int32_t i;
+
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mq_create(&mq, ADT_MAX_HEAP, 8));
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_mq_set_samples(&mq, 0));
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_mq_set_samples(&mq, ADT_MQ_MAX_SAMPLES + 1));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mq_set_samples(&mq, 3));
+   for (i = 0; i < NUM_ELEMENTS; i++)
+   {
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mq_push(&mq, NULL, (uint64_t) i));
+      u64PushSum += (uint64_t) i;
+   }
+   CuAssertIntEquals(tc, NUM_ELEMENTS, adt_mq_length(&mq));
+   //every element comes out exactly once, roughly in order (highest priority first)
+   for (i = 0; i < NUM_ELEMENTS; i++)
+   {
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mq_pop(&mq, &elem));
+      u64PopSum += elem.u64Priority;
+      s32Expected = NUM_ELEMENTS - 1 - i;
+      u64RankSum += (uint64_t) abs((int32_t) elem.u64Priority - s32Expected);
+   }
+   CuAssertTrue(tc, u64PopSum == u64PushSum);
+   CuAssertTrue(tc, u64RankSum < (uint64_t) (NUM_ELEMENTS * 16)); //average distance from the exact position below 16
+   CuAssertIntEquals(tc, ADT_LENGTH_ERROR, adt_mq_pop(&mq, &elem));
+   adt_mq_destroy(&mq);
+}
+
+#if (ADT_THREADS_ENABLE)
+static void test_adt_mq_threads(CuTest* tc)
+{
+   adt_mq_t mq;
+   pthread_t threads[NUM_THREADS];
+   thread_arg_t args[NUM_THREADS];
+   uint64_t u64PushSum = 0u;
+   uint64_t u64PopSum = 0u;
+   int32_t i;
+
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mq_create(&mq, ADT_MIN_HEAP, NUM_THREADS * ADT_MQ_QUEUES_PER_THREAD));
+   //no allocations in the worker threads
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_mq_reserve(&mq, NUM_THREADS * NUM_THREAD_OPERATIONS));
+   for (i = 0; i < NUM_THREADS; i++)
+   {
+      args[i].mq = &mq;
+      args[i].u32Seed = (uint32_t) i + 1u;
+      args[i].u64PushSum = 0u;
+      args[i].u64PopSum = 0u;
+      args[i].s32NumErrors = 0;
+      CuAssertIntEquals(tc, 0, pthread_create(&threads[i], NULL, thread_main, &args[i]));
+   }
+   for (i = 0; i < NUM_THREADS; i++)
+   {
+      pthread_join(threads[i], NULL);
+      CuAssertIntEquals(tc, 0, args[i].s32NumErrors);
+      u64PushSum += args[i].u64PushSum;
+      u64PopSum += args[i].u64PopSum;
+   }
+   CuAssertIntEquals(tc, 0, adt_mq_length(&mq));
+   CuAssertTrue(tc, u64PopSum == u64PushSum);
+   adt_mq_destroy(&mq);
+}
+
+/**
+ * Each thread pushes NUM_THREAD_OPERATIONS elements and pops as many. A pop may find the queue empty while other
+ * threads still have elements to push, but all pushes complete before the last pop of any thread is retried.
+ */
+static void* thread_main(void *arg)
+{
+   thread_arg_t *pArg = (thread_arg_t*) arg;
+   int32_t s32NumPushed = 0;
+   int32_t s32NumPopped = 0;
+   while (s32NumPopped < NUM_THREAD_OPERATIONS)
+   {
+      pArg->u32Seed = (pArg->u32Seed * 1103515245u) + 12345u;
+      if ( (s32NumPushed < NUM_THREAD_OPERATIONS) && ( (s32NumPushed == s32NumPopped) || ((pArg->u32Seed >> 16) & 1u) ) )
+      {
+         uint64_t u64Priority = (pArg->u32Seed >> 8) % 100000u;
+         if (adt_mq_push(pArg->mq, NULL, u64Priority) != ADT_NO_ERROR)
+         {
+            pArg->s32NumErrors++;
+            break;
+         }
+         pArg->u64PushSum += u64Priority;
+         s32NumPushed++;
+      }
+      else
+      {
+         adt_pq_elem_t elem;
+         adt_error_t result = adt_mq_pop(pArg->mq, &elem);
+         if (result == ADT_NO_ERROR)
+         {
+            pArg->u64PopSum += elem.u64Priority;
+            s32NumPopped++;
+         }
+         else if (result != ADT_LENGTH_ERROR)
+         {
+            pArg->s32NumErrors++;
+            break;
+         }
+      }
+   }
+   return NULL;
+}
+#endif
@@ -0,0 +1,265 @@
+/*****************************************************************************
+* \file      testsuite_adt_pairheap.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for adt_pairheap
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <assert.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CuTest.h"
+#include "adt_pairheap.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define NUM_NODES 300
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_adt_pairheap_push_pop(CuTest* tc);
+static void test_adt_pairheap_decrease_key_remove(CuTest* tc);
+static void test_adt_pairheap_meld(CuTest* tc);
+static void test_adt_pairheap_random(CuTest* tc);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+CuSuite* testsuite_adt_pairheap(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_adt_pairheap_push_pop);
+   SUITE_ADD_TEST(suite, test_adt_pairheap_decrease_key_remove);
+   SUITE_ADD_TEST(suite, test_adt_pairheap_meld);
+   SUITE_ADD_TEST(suite, test_adt_pairheap_random);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+static void test_adt_pairheap_push_pop(CuTest* tc)
+{
+   adt_pairheap_t *heap;
+   adt_pq_elem_t elem;
+   int values[5] = {0, 1, 2, 3, 4};
+   const uint64_t priorities[5] = {50u, 10u, 40u, 20u, 30u};
+   int32_t i;
+
+   heap = adt_pairheap_new(ADT_MAX_HEAP);
+   CuAssertPtrNotNull(tc, heap);
+   CuAssertTrue(tc, adt_pairheap_is_empty(heap));
+   CuAssertPtrEquals(tc, NULL, (void*) adt_pairheap_peek(heap));
+   CuAssertIntEquals(tc, ADT_LENGTH_ERROR, adt_pairheap_pop(heap, &elem));
+   for (i = 0; i < 5; i++)
+   {
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_push(heap, &values[i], priorities[i], NULL));
+   }
+   CuAssertIntEquals(tc, 5, adt_pairheap_length(heap));
+   CuAssertPtrEquals(tc, &values[0], adt_pairheap_peek(heap)->pItem);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_pop(heap, &elem));
+   CuAssertPtrEquals(tc, &values[0], elem.pItem);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_pop(heap, &elem));
+   CuAssertPtrEquals(tc, &values[2], elem.pItem);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_pop(heap, &elem));
+   CuAssertTrue(tc, elem.u64Priority == 30u);
+   CuAssertIntEquals(tc, 2, adt_pairheap_length(heap));
+   adt_pairheap_clear(heap);
+   CuAssertTrue(tc, adt_pairheap_is_empty(heap));
+   CuAssertIntEquals(tc, 0, adt_pool_num_used(heap->pPool));
+   adt_pairheap_delete(heap);
+}
+
+static void test_adt_pairheap_decrease_key_remove(CuTest* tc)
+{
+   adt_pairheap_t heap;
+   adt_pairheap_node_t *nodes[6];
+   adt_pq_elem_t elem;
+   int32_t i;
+
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_create(&heap, ADT_MIN_HEAP));
+   for (i = 0; i < 6; i++)
+   {
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_push(&heap, NULL, (uint64_t) (i + 1) * 10u, &nodes[i]));
+   }
+   //build some structure below the root
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_pop(&heap, &elem));
+   CuAssertTrue(tc, elem.u64Priority == 10u);
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_pairheap_decrease_key(&heap, nodes[4], 51u));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_decrease_key(&heap, nodes[4], 5u));
+   CuAssertPtrEquals(tc, nodes[4], (void*) adt_pairheap_peek(&heap));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_remove(&heap, nodes[2], &elem));
+   CuAssertTrue(tc, elem.u64Priority == 30u);
+   CuAssertIntEquals(tc, 4, adt_pairheap_length(&heap));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_pop(&heap, &elem));
+   CuAssertTrue(tc, elem.u64Priority == 5u);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_pop(&heap, &elem));
+   CuAssertTrue(tc, elem.u64Priority == 20u);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_pop(&heap, &elem));
+   CuAssertTrue(tc, elem.u64Priority == 40u);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_pop(&heap, &elem));
+   CuAssertTrue(tc, elem.u64Priority == 60u);
+   CuAssertTrue(tc, adt_pairheap_is_empty(&heap));
+   adt_pairheap_destroy(&heap);
+}
+
+static void test_adt_pairheap_meld(CuTest* tc)
+{
+   adt_pairheap_t heap1;
+   adt_pairheap_t heap2;
+   adt_pairheap_t heap3;
+   adt_pairheap_t heap4;
+   adt_pool_t pool;
+   adt_pairheap_node_t *pNode;
+   adt_pq_elem_t elem;
+   uint64_t u64Prev = 0u;
+   int32_t i;
+
+   //heaps owning their pools
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_create(&heap1, ADT_MIN_HEAP));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_create(&heap2, ADT_MIN_HEAP));
+   for (i = 0; i < 100; i++)
+   {
+      adt_pairheap_push(&heap1, NULL, (uint64_t) (i * 2), NULL);
+      adt_pairheap_push(&heap2, NULL, (uint64_t) (i * 2 + 1), (i == 50) ? &pNode : NULL);
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_meld(&heap1, &heap2));
+   CuAssertIntEquals(tc, 200, adt_pairheap_length(&heap1));
+   CuAssertIntEquals(tc, 0, adt_pairheap_length(&heap2));
+   //handles from heap2 stay valid in heap1
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_remove(&heap1, pNode, NULL));
+   for (i = 0; i < 199; i++)
+   {
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_pop(&heap1, &elem));
+      CuAssertTrue(tc, (i == 0) || (elem.u64Priority > u64Prev));
+      CuAssertTrue(tc, elem.u64Priority != 101u);
+      u64Prev = elem.u64Priority;
+   }
+   CuAssertTrue(tc, adt_pairheap_is_empty(&heap1));
+
+   //heaps sharing one pool
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pool_create(&pool, (uint32_t) sizeof(adt_pairheap_node_t), 0));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_create_shared(&heap3, ADT_MIN_HEAP, &pool));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_create_shared(&heap4, ADT_MIN_HEAP, &pool));
+   adt_pairheap_push(&heap3, NULL, 7u, NULL);
+   adt_pairheap_push(&heap4, NULL, 3u, NULL);
+   adt_pairheap_push(&heap4, NULL, 9u, NULL);
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_pairheap_meld(&heap1, &heap3));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_meld(&heap3, &heap4));
+   CuAssertIntEquals(tc, 3, adt_pairheap_length(&heap3));
+   CuAssertTrue(tc, adt_pairheap_peek(&heap3)->u64Priority == 3u);
+   CuAssertIntEquals(tc, 3, adt_pool_num_used(&pool));
+   adt_pairheap_destroy(&heap3);
+   adt_pairheap_destroy(&heap4);
+   CuAssertIntEquals(tc, 0, adt_pool_num_used(&pool));
+   adt_pool_destroy(&pool);
+   adt_pairheap_destroy(&heap1);
+   adt_pairheap_destroy(&heap2);
+}
+
+static void test_adt_pairheap_random(CuTest* tc)
+{
+   adt_pairheap_t heap;
+   adt_pairheap_node_t *nodes[NUM_NODES];
+   uint64_t expected[NUM_NODES];
+   uint32_t state = 3u;
+   int32_t s32Len = 0;
+   int32_t i;
+
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_create(&heap, ADT_MIN_HEAP));
+   for (i = 0; i < NUM_NODES; i++)
+   {
+      nodes[i] = NULL;
+   }
+   for (i = 0; i < 20000; i++)
+   {
+      int32_t s32Index;
+      uint64_t u64Priority;
+      state = (state * 1103515245u) + 12345u;
+      s32Index = (int32_t) ((state >> 16) % NUM_NODES);
+      u64Priority = (state >> 4) % 5000u;
+      switch ((state >> 26) % 4u)
+      {
+      case 0:
+         if (nodes[s32Index] == NULL)
+         {
+            CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_push(&heap, &nodes[s32Index], u64Priority, &nodes[s32Index]));
+            expected[s32Index] = u64Priority;
+            s32Len++;
+         }
+         break;
+      case 1:
+         if ( (nodes[s32Index] != NULL) && (u64Priority <= expected[s32Index]) )
+         {
+            CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_decrease_key(&heap, nodes[s32Index], u64Priority));
+            expected[s32Index] = u64Priority;
+         }
+         break;
+      case 2:
+         if (nodes[s32Index] != NULL)
+         {
+            adt_pq_elem_t elem;
+            CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_remove(&heap, nodes[s32Index], &elem));
+            CuAssertTrue(tc, elem.u64Priority == expected[s32Index]);
+            nodes[s32Index] = NULL;
+            s32Len--;
+         }
+         break;
+      default:
+         if (s32Len > 0)
+         {
+            adt_pq_elem_t elem;
+            adt_pairheap_node_t **ppNode;
+            int32_t j;
+            CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pairheap_pop(&heap, &elem));
+            ppNode = (adt_pairheap_node_t**) elem.pItem;
+            s32Index = (int32_t) (ppNode - nodes);
+            CuAssertTrue(tc, elem.u64Priority == expected[s32Index]);
+            for (j = 0; j < NUM_NODES; j++)
+            {
+               CuAssertTrue(tc, (nodes[j] == NULL) || (expected[j] >= elem.u64Priority));
+            }
+            nodes[s32Index] = NULL;
+            s32Len--;
+         }
+         break;
+      }
+      CuAssertIntEquals(tc, s32Len, adt_pairheap_length(&heap));
+   }
+   adt_pairheap_destroy(&heap);
+}
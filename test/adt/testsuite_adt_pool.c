@@ -0,0 +1,144 @@
+/*****************************************************************************
+* \file      testsuite_adt_pool.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for adt_pool
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <assert.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CuTest.h"
+#include "adt_pool.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define NUM_ELEMS 100
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_adt_pool_alloc_free(CuTest* tc);
+static void test_adt_pool_merge(CuTest* tc);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+CuSuite* testsuite_adt_pool(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_adt_pool_alloc_free);
+   SUITE_ADD_TEST(suite, test_adt_pool_merge);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+static void test_adt_pool_alloc_free(CuTest* tc)
+{
+   adt_pool_t *pool;
+   uint8_t *elems[NUM_ELEMS];
+   void *pReused;
+   int32_t i;
+   int32_t j;
+
+   CuAssertPtrEquals(tc, NULL, adt_pool_new(0u, 0));
+   pool = adt_pool_new(20u, 16);
+   CuAssertPtrNotNull(tc, pool);
+   CuAssertUIntEquals(tc, 24u, adt_pool_elem_size(pool));
+   for (i = 0; i < NUM_ELEMS; i++)
+   {
+      elems[i] = (uint8_t*) adt_pool_alloc(pool);
+      CuAssertPtrNotNull(tc, elems[i]);
+      CuAssertTrue(tc, ((uintptr_t) elems[i] % 8u) == 0u);
+      memset(elems[i], i, 20);
+   }
+   CuAssertIntEquals(tc, NUM_ELEMS, adt_pool_num_used(pool));
+   //first element of each slab is cache aligned, elements within a slab are contiguous
+   CuAssertTrue(tc, ((uintptr_t) elems[0] % ADT_POOL_CACHE_LINE_SIZE) == 0u);
+   CuAssertTrue(tc, ((uintptr_t) elems[16] % ADT_POOL_CACHE_LINE_SIZE) == 0u);
+   CuAssertPtrEquals(tc, elems[0] + 24, elems[1]);
+   //no element overlaps another
+   for (i = 0; i < NUM_ELEMS; i++)
+   {
+      for (j = 0; j < 20; j++)
+      {
+         CuAssertIntEquals(tc, i, elems[i][j]);
+      }
+   }
+   adt_pool_free(pool, elems[50]);
+   adt_pool_free(pool, elems[10]);
+   CuAssertIntEquals(tc, NUM_ELEMS - 2, adt_pool_num_used(pool));
+   pReused = adt_pool_alloc(pool);
+   CuAssertPtrEquals(tc, elems[10], pReused);
+   pReused = adt_pool_alloc(pool);
+   CuAssertPtrEquals(tc, elems[50], pReused);
+   adt_pool_delete(pool);
+}
+
+static void test_adt_pool_merge(CuTest* tc)
+{
+   adt_pool_t pool1;
+   adt_pool_t pool2;
+   adt_pool_t pool3;
+   void *pElem1;
+   void *pElem2;
+
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pool_create(&pool1, 32u, 8));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pool_create(&pool2, 32u, 8));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pool_create(&pool3, 64u, 8));
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_pool_merge(&pool1, &pool3));
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_pool_merge(&pool1, &pool1));
+   //merge into an empty pool
+   pElem2 = adt_pool_alloc(&pool2);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pool_merge(&pool1, &pool2));
+   CuAssertIntEquals(tc, 1, adt_pool_num_used(&pool1));
+   CuAssertIntEquals(tc, 0, adt_pool_num_used(&pool2));
+   //merge a pool with slabs into a pool with slabs
+   pElem1 = adt_pool_alloc(&pool2);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_pool_merge(&pool1, &pool2));
+   CuAssertIntEquals(tc, 2, adt_pool_num_used(&pool1));
+   adt_pool_free(&pool1, pElem1);
+   adt_pool_free(&pool1, pElem2);
+   CuAssertIntEquals(tc, 0, adt_pool_num_used(&pool1));
+   CuAssertPtrNotNull(tc, adt_pool_alloc(&pool1));
+   //slabs of both pools are freed by destroy of pool1
+   adt_pool_destroy(&pool1);
+   adt_pool_destroy(&pool2);
+   adt_pool_destroy(&pool3);
+}
@@ -0,0 +1,191 @@
+/*****************************************************************************
+* \file      testsuite_adt_radix.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for adt_radix
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <assert.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CuTest.h"
+#include "adt_radix.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define NUM_KEYS 5000
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_adt_radix_sort_u32(CuTest* tc);
+static void test_adt_radix_sort_u32_with_values(CuTest* tc);
+static void test_adt_radix_sort_u64(CuTest* tc);
+static void test_adt_radix_sort_short(CuTest* tc);
+
+static uint32_t next_random(uint32_t *pSeed);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+CuSuite* testsuite_adt_radix(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_adt_radix_sort_u32);
+   SUITE_ADD_TEST(suite, test_adt_radix_sort_u32_with_values);
+   SUITE_ADD_TEST(suite, test_adt_radix_sort_u64);
+   SUITE_ADD_TEST(suite, test_adt_radix_sort_short);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void test_adt_radix_sort_u32(CuTest* tc)
+{
+   uint32_t *pKeys = (uint32_t*) malloc(sizeof(uint32_t) * NUM_KEYS);
+   uint32_t seed = 1u;
+   uint64_t sumBefore = 0u;
+   uint64_t sumAfter = 0u;
+   int32_t i;
+   CuAssertPtrNotNull(tc, pKeys);
+   for (i = 0; i < NUM_KEYS; i++)
+   {
+      pKeys[i] = next_random(&seed);
+      sumBefore += pKeys[i];
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_radix_sort_u32(pKeys, NULL, NUM_KEYS));
+   for (i = 0; i < NUM_KEYS; i++)
+   {
+      if (i > 0)
+      {
+         CuAssertTrue(tc, pKeys[i - 1] <= pKeys[i]);
+      }
+      sumAfter += pKeys[i];
+   }
+   CuAssertTrue(tc, sumBefore == sumAfter);
+   //already sorted input, upper digits are uniform after masking
+   for (i = 0; i < NUM_KEYS; i++)
+   {
+      pKeys[i] = ((uint32_t) (NUM_KEYS - i)) & 0xFFu;
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_radix_sort_u32(pKeys, NULL, NUM_KEYS));
+   for (i = 1; i < NUM_KEYS; i++)
+   {
+      CuAssertTrue(tc, pKeys[i - 1] <= pKeys[i]);
+   }
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_radix_sort_u32(NULL, NULL, 10));
+   free(pKeys);
+}
+
+static void test_adt_radix_sort_u32_with_values(CuTest* tc)
+{
+   uint32_t *pKeys = (uint32_t*) malloc(sizeof(uint32_t) * NUM_KEYS);
+   void **ppValues = (void**) malloc(sizeof(void*) * NUM_KEYS);
+   uint32_t *pOriginal = (uint32_t*) malloc(sizeof(uint32_t) * NUM_KEYS);
+   uint32_t seed = 7u;
+   int32_t i;
+   CuAssertPtrNotNull(tc, pKeys);
+   CuAssertPtrNotNull(tc, ppValues);
+   CuAssertPtrNotNull(tc, pOriginal);
+   for (i = 0; i < NUM_KEYS; i++)
+   {
+      pOriginal[i] = pKeys[i] = next_random(&seed) % 100u; //many duplicates
+      ppValues[i] = &pOriginal[i];
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_radix_sort_u32(pKeys, ppValues, NUM_KEYS));
+   for (i = 0; i < NUM_KEYS; i++)
+   {
+      CuAssertUIntEquals(tc, pKeys[i], *((uint32_t*) ppValues[i]));
+      if ( (i > 0) && (pKeys[i - 1] == pKeys[i]) )
+      {
+         CuAssertTrue(tc, ppValues[i - 1] < ppValues[i]); //stable
+      }
+   }
+   free(pKeys);
+   free(ppValues);
+   free(pOriginal);
+}
+
+static void test_adt_radix_sort_u64(CuTest* tc)
+{
+   uint64_t *pKeys = (uint64_t*) malloc(sizeof(uint64_t) * NUM_KEYS);
+   uint32_t seed = 3u;
+   int32_t i;
+   CuAssertPtrNotNull(tc, pKeys);
+   for (i = 0; i < NUM_KEYS; i++)
+   {
+      pKeys[i] = (((uint64_t) next_random(&seed)) << 32) | next_random(&seed);
+   }
+   pKeys[10] = UINT64_MAX;
+   pKeys[11] = 0u;
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_radix_sort_u64(pKeys, NULL, NUM_KEYS));
+   CuAssertTrue(tc, pKeys[0] == 0u);
+   CuAssertTrue(tc, pKeys[NUM_KEYS - 1] == UINT64_MAX);
+   for (i = 1; i < NUM_KEYS; i++)
+   {
+      CuAssertTrue(tc, pKeys[i - 1] <= pKeys[i]);
+   }
+   free(pKeys);
+}
+
+static void test_adt_radix_sort_short(CuTest* tc)
+{
+   uint32_t keys32[5] = {5, 3, 9, 3, 1};
+   uint64_t keys64[4] = {UINT64_MAX, 2, 1, 0x100000000ull};
+   int values[5] = {0, 1, 2, 3, 4};
+   void *ppValues[5] = {&values[0], &values[1], &values[2], &values[3], &values[4]};
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_radix_sort_u32(keys32, ppValues, 5));
+   CuAssertUIntEquals(tc, 1, keys32[0]);
+   CuAssertUIntEquals(tc, 3, keys32[1]);
+   CuAssertUIntEquals(tc, 3, keys32[2]);
+   CuAssertUIntEquals(tc, 5, keys32[3]);
+   CuAssertUIntEquals(tc, 9, keys32[4]);
+   CuAssertPtrEquals(tc, &values[4], ppValues[0]);
+   CuAssertPtrEquals(tc, &values[1], ppValues[1]);
+   CuAssertPtrEquals(tc, &values[3], ppValues[2]);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_radix_sort_u64(keys64, NULL, 4));
+   CuAssertTrue(tc, keys64[0] == 1u);
+   CuAssertTrue(tc, keys64[1] == 2u);
+   CuAssertTrue(tc, keys64[2] == 0x100000000ull);
+   CuAssertTrue(tc, keys64[3] == UINT64_MAX);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_radix_sort_u32(keys32, NULL, 0));
+}
+
+static uint32_t next_random(uint32_t *pSeed)
+{
+   *pSeed = (*pSeed * 1103515245u) + 12345u;
+   return (*pSeed << 16) ^ (*pSeed >> 8);
+}
@@ -0,0 +1,310 @@
+/*****************************************************************************
+* \file      testsuite_adt_template.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for adt_template.h
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <assert.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CuTest.h"
+#include "adt_template.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+typedef struct task_tag
+{
+   uint32_t priority;
+   uint32_t id;
+} task_t;
+
+#define I32_LESS(a, b) ((a) < (b))
+#define I32_GREATER(a, b) ((a) > (b))
+#define TASK_LESS(a, b) ( ((a).priority < (b).priority) || ( ((a).priority == (b).priority) && ((a).id < (b).id) ) )
+#define CSTR_EQ(a, b) (strcmp((a), (b)) == 0)
+
+static uint32_t cstr_hash(const char *str);
+
+ADT_VEC_DEFINE(i32vec, int32_t)
+ADT_VEC_DEFINE(taskvec, task_t)
+ADT_HEAP_DEFINE(i32minheap, int32_t, I32_LESS)
+ADT_HEAP_DEFINE(i32maxheap, int32_t, I32_GREATER)
+ADT_HEAP_DEFINE(taskheap, task_t, TASK_LESS)
+ADT_HASHMAP_DEFINE(u32map, uint32_t, int32_t, adt_hash_u32, ADT_EQ_VALUE)
+
+//extern variant, normally DECLARE is placed in a header and IMPLEMENT in a single source file
+ADT_HASHMAP_DECLARE(strmap, const char*, int32_t)
+ADT_HASHMAP_IMPLEMENT(strmap, const char*, int32_t, cstr_hash, CSTR_EQ)
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_adt_template_vec(CuTest* tc);
+static void test_adt_template_vec_struct(CuTest* tc);
+static void test_adt_template_min_heap(CuTest* tc);
+static void test_adt_template_max_heap(CuTest* tc);
+static void test_adt_template_heap_struct(CuTest* tc);
+static void test_adt_template_hashmap(CuTest* tc);
+static void test_adt_template_hashmap_remove_all(CuTest* tc);
+static void test_adt_template_hashmap_cstr(CuTest* tc);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+CuSuite* testsuite_adt_template(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_adt_template_vec);
+   SUITE_ADD_TEST(suite, test_adt_template_vec_struct);
+   SUITE_ADD_TEST(suite, test_adt_template_min_heap);
+   SUITE_ADD_TEST(suite, test_adt_template_max_heap);
+   SUITE_ADD_TEST(suite, test_adt_template_heap_struct);
+   SUITE_ADD_TEST(suite, test_adt_template_hashmap);
+   SUITE_ADD_TEST(suite, test_adt_template_hashmap_remove_all);
+   SUITE_ADD_TEST(suite, test_adt_template_hashmap_cstr);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void test_adt_template_vec(CuTest* tc)
+{
+   i32vec_t vec;
+   int32_t i;
+   int32_t value;
+   i32vec_create(&vec);
+   for (i = 0; i < 100; i++)
+   {
+      CuAssertIntEquals(tc, ADT_NO_ERROR, i32vec_push(&vec, i));
+   }
+   CuAssertIntEquals(tc, 100, i32vec_length(&vec));
+   CuAssertIntEquals(tc, 42, *i32vec_at(&vec, 42));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, i32vec_insert(&vec, 0, -1));
+   CuAssertIntEquals(tc, -1, *i32vec_at(&vec, 0));
+   CuAssertIntEquals(tc, 0, *i32vec_at(&vec, 1));
+   CuAssertIntEquals(tc, ADT_INDEX_OUT_OF_BOUNDS_ERROR, i32vec_insert(&vec, 102, 0));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, i32vec_erase(&vec, 0));
+   CuAssertIntEquals(tc, 0, *i32vec_at(&vec, 0));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, i32vec_pop(&vec, &value));
+   CuAssertIntEquals(tc, 99, value);
+   CuAssertIntEquals(tc, 99, i32vec_length(&vec));
+   i32vec_clear(&vec);
+   CuAssertIntEquals(tc, 0, i32vec_length(&vec));
+   CuAssertIntEquals(tc, ADT_LENGTH_ERROR, i32vec_pop(&vec, &value));
+   //a full vector of maximum length cannot grow, nothing may be written
+   i = vec.s32AllocLen;
+   vec.s32CurLen = INT32_MAX;
+   vec.s32AllocLen = INT32_MAX;
+   CuAssertIntEquals(tc, ADT_LENGTH_ERROR, i32vec_push(&vec, 0));
+   CuAssertIntEquals(tc, ADT_LENGTH_ERROR, i32vec_insert(&vec, 0, 0));
+   vec.s32CurLen = 0;
+   vec.s32AllocLen = i;
+   i32vec_destroy(&vec);
+}
+
+static void test_adt_template_vec_struct(CuTest* tc)
+{
+   taskvec_t vec;
+   task_t task;
+   taskvec_create(&vec);
+   task.priority = 3;
+   task.id = 1;
+   CuAssertIntEquals(tc, ADT_NO_ERROR, taskvec_push(&vec, task));
+   task.priority = 5;
+   task.id = 2;
+   CuAssertIntEquals(tc, ADT_NO_ERROR, taskvec_push(&vec, task));
+   CuAssertUIntEquals(tc, 3, taskvec_at(&vec, 0)->priority);
+   CuAssertUIntEquals(tc, 2, taskvec_at(&vec, 1)->id);
+   taskvec_destroy(&vec);
+}
+
+static void test_adt_template_min_heap(CuTest* tc)
+{
+   i32minheap_t heap;
+   int32_t i;
+   int32_t value;
+   i32minheap_create(&heap);
+   CuAssertPtrEquals(tc, 0, i32minheap_peek(&heap));
+   for (i = 0; i < 100; i++)
+   {
+      CuAssertIntEquals(tc, ADT_NO_ERROR, i32minheap_push(&heap, (i * 37) % 100));
+   }
+   CuAssertIntEquals(tc, 100, i32minheap_length(&heap));
+   CuAssertIntEquals(tc, 0, *i32minheap_peek(&heap));
+   for (i = 0; i < 100; i++)
+   {
+      CuAssertIntEquals(tc, ADT_NO_ERROR, i32minheap_pop(&heap, &value));
+      CuAssertIntEquals(tc, i, value);
+   }
+   CuAssertIntEquals(tc, ADT_LENGTH_ERROR, i32minheap_pop(&heap, &value));
+   i = heap.s32AllocLen;
+   heap.s32CurLen = INT32_MAX;
+   heap.s32AllocLen = INT32_MAX;
+   CuAssertIntEquals(tc, ADT_LENGTH_ERROR, i32minheap_push(&heap, 0));
+   heap.s32CurLen = 0;
+   heap.s32AllocLen = i;
+   i32minheap_destroy(&heap);
+}
+
+static void test_adt_template_max_heap(CuTest* tc)
+{
+   i32maxheap_t heap;
+   int32_t i;
+   int32_t value;
+   i32maxheap_create(&heap);
+   for (i = 0; i < 50; i++)
+   {
+      i32maxheap_push(&heap, (i * 13) % 50);
+   }
+   for (i = 49; i >= 0; i--)
+   {
+      CuAssertIntEquals(tc, ADT_NO_ERROR, i32maxheap_pop(&heap, &value));
+      CuAssertIntEquals(tc, i, value);
+   }
+   i32maxheap_destroy(&heap);
+}
+
+static void test_adt_template_heap_struct(CuTest* tc)
+{
+   taskheap_t heap;
+   task_t task;
+   uint32_t i;
+   taskheap_create(&heap);
+   for (i = 0; i < 20u; i++)
+   {
+      task.priority = i % 4u;
+      task.id = i;
+      taskheap_push(&heap, task);
+   }
+   taskheap_pop(&heap, &task);
+   CuAssertUIntEquals(tc, 0, task.priority);
+   CuAssertUIntEquals(tc, 0, task.id);
+   taskheap_pop(&heap, &task);
+   CuAssertUIntEquals(tc, 0, task.priority);
+   CuAssertUIntEquals(tc, 4, task.id);
+   CuAssertIntEquals(tc, 18, taskheap_length(&heap));
+   taskheap_destroy(&heap);
+}
+
+static void test_adt_template_hashmap(CuTest* tc)
+{
+   u32map_t map;
+   uint32_t i;
+   u32map_create(&map);
+   CuAssertPtrEquals(tc, 0, u32map_get(&map, 1u));
+   for (i = 0; i < 1000u; i++)
+   {
+      CuAssertIntEquals(tc, ADT_NO_ERROR, u32map_set(&map, i * 16u, (int32_t) i));
+   }
+   CuAssertUIntEquals(tc, 1000u, u32map_length(&map));
+   for (i = 0; i < 1000u; i++)
+   {
+      int32_t *pValue = u32map_get(&map, i * 16u);
+      CuAssertPtrNotNull(tc, pValue);
+      CuAssertIntEquals(tc, (int32_t) i, *pValue);
+   }
+   CuAssertPtrEquals(tc, 0, u32map_get(&map, 1u));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, u32map_set(&map, 16u, -1));
+   CuAssertUIntEquals(tc, 1000u, u32map_length(&map));
+   CuAssertIntEquals(tc, -1, *u32map_get(&map, 16u));
+   for (i = 0; i < 1000u; i += 2u)
+   {
+      CuAssertTrue(tc, u32map_remove(&map, i * 16u));
+   }
+   CuAssertTrue(tc, !u32map_remove(&map, 0u));
+   CuAssertUIntEquals(tc, 500u, u32map_length(&map));
+   for (i = 0; i < 1000u; i++)
+   {
+      int32_t *pValue = u32map_get(&map, i * 16u);
+      if ( (i % 2u) == 0u)
+      {
+         CuAssertPtrEquals(tc, 0, pValue);
+      }
+      else
+      {
+         CuAssertPtrNotNull(tc, pValue);
+      }
+   }
+   u32map_clear(&map);
+   CuAssertUIntEquals(tc, 0u, u32map_length(&map));
+   CuAssertPtrEquals(tc, 0, u32map_get(&map, 16u * 3u));
+   u32map_destroy(&map);
+}
+
+static void test_adt_template_hashmap_remove_all(CuTest* tc)
+{
+   u32map_t map;
+   uint32_t i;
+   u32map_create(&map);
+   for (i = 0; i < 300u; i++)
+   {
+      u32map_set(&map, i, (int32_t) i);
+   }
+   for (i = 0; i < 300u; i++)
+   {
+      uint32_t key = (i * 7u) % 300u;
+      CuAssertTrue(tc, u32map_remove(&map, key));
+      CuAssertPtrEquals(tc, 0, u32map_get(&map, key));
+   }
+   CuAssertUIntEquals(tc, 0u, u32map_length(&map));
+   u32map_destroy(&map);
+}
+
+static void test_adt_template_hashmap_cstr(CuTest* tc)
+{
+   strmap_t map;
+   strmap_create(&map);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, strmap_set(&map, "first", 1));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, strmap_set(&map, "second", 2));
+   CuAssertIntEquals(tc, 1, *strmap_get(&map, "first"));
+   CuAssertIntEquals(tc, 2, *strmap_get(&map, "second"));
+   CuAssertPtrEquals(tc, 0, strmap_get(&map, "third"));
+   CuAssertTrue(tc, strmap_remove(&map, "first"));
+   CuAssertPtrEquals(tc, 0, strmap_get(&map, "first"));
+   strmap_destroy(&map);
+}
+
+static uint32_t cstr_hash(const char *str)
+{
+   uint32_t hash = 2166136261u; //FNV-1a
+   while (*str != '\0')
+   {
+      hash ^= (uint8_t) *str++;
+      hash *= 16777619u;
+   }
+   return hash;
+}
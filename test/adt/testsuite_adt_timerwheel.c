@@ -0,0 +1,270 @@
+/*****************************************************************************
+* \file      testsuite_adt_timerwheel.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for adt_timerwheel
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <assert.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CuTest.h"
+#include "adt_timerwheel.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define NUM_TIMERS 2000
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_adt_timerwheel_schedule_cancel(CuTest* tc);
+static void test_adt_timerwheel_cascade(CuTest* tc);
+static void test_adt_timerwheel_past_expiry(CuTest* tc);
+static void test_adt_timerwheel_random(CuTest* tc);
+
+static uint32_t next_random(uint32_t *pSeed);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+CuSuite* testsuite_adt_timerwheel(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_adt_timerwheel_schedule_cancel);
+   SUITE_ADD_TEST(suite, test_adt_timerwheel_cascade);
+   SUITE_ADD_TEST(suite, test_adt_timerwheel_past_expiry);
+   SUITE_ADD_TEST(suite, test_adt_timerwheel_random);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+static void test_adt_timerwheel_schedule_cancel(CuTest* tc)
+{
+   adt_timerwheel_t *wheel;
+   adt_timer_t timers[3];
+   adt_ary_t expired;
+   int32_t values[3] = {0, 1, 2};
+   int32_t i;
+
+   wheel = adt_timerwheel_new(0u);
+   CuAssertPtrNotNull(tc, wheel);
+   adt_ary_create(&expired, (void (*)(void*)) 0);
+   for (i = 0; i < 3; i++)
+   {
+      adt_timer_create(&timers[i], &values[i]);
+      CuAssertTrue(tc, !adt_timer_is_scheduled(&timers[i]));
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_timerwheel_schedule(wheel, &timers[0], 5u));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_timerwheel_schedule(wheel, &timers[1], 3u));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_timerwheel_schedule(wheel, &timers[2], 300u));
+   CuAssertIntEquals(tc, 3, adt_timerwheel_length(wheel));
+   CuAssertTrue(tc, adt_timer_is_scheduled(&timers[2]));
+
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_timerwheel_advance(wheel, 2u, &expired));
+   CuAssertIntEquals(tc, 0, adt_ary_length(&expired));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_timerwheel_advance(wheel, 3u, &expired));
+   CuAssertIntEquals(tc, 1, adt_ary_length(&expired));
+   CuAssertPtrEquals(tc, &timers[1], *adt_ary_get(&expired, 0));
+   CuAssertTrue(tc, !adt_timer_is_scheduled(&timers[1]));
+   CuAssertIntEquals(tc, 2, adt_timerwheel_length(wheel));
+
+   //reschedule a pending timer, then cancel it
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_timerwheel_schedule(wheel, &timers[0], 400u));
+   CuAssertIntEquals(tc, 2, adt_timerwheel_length(wheel));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_timerwheel_advance(wheel, 10u, &expired));
+   CuAssertIntEquals(tc, 1, adt_ary_length(&expired));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_timerwheel_cancel(wheel, &timers[0]));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_timerwheel_cancel(wheel, &timers[0]));
+   CuAssertTrue(tc, !adt_timer_is_scheduled(&timers[0]));
+   CuAssertIntEquals(tc, 1, adt_timerwheel_length(wheel));
+
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_timerwheel_advance(wheel, 1000u, &expired));
+   CuAssertIntEquals(tc, 2, adt_ary_length(&expired));
+   CuAssertPtrEquals(tc, &timers[2], *adt_ary_get(&expired, 1));
+   CuAssertPtrEquals(tc, &values[2], timers[2].pItem);
+   CuAssertIntEquals(tc, 0, adt_timerwheel_length(wheel));
+
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_timerwheel_advance(wheel, 2000u, (adt_ary_t*) 0));
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_timerwheel_schedule(wheel, (adt_timer_t*) 0, 1u));
+
+   adt_timerwheel_delete(wheel);
+   adt_ary_destroy(&expired);
+}
+
+static void test_adt_timerwheel_cascade(CuTest* tc)
+{
+   adt_timerwheel_t wheel;
+   adt_timer_t timers[9];
+   adt_ary_t expired;
+   const uint64_t start = 1000u;
+   const uint64_t delays[9] = {0u, 1u, 255u, 256u, 65535u, 65536u, 0x1000007ull, 0xFFFFFFFFull, 0x300000005ull};
+   int32_t i;
+
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_timerwheel_create(&wheel, start));
+   adt_ary_create(&expired, (void (*)(void*)) 0);
+   for (i = 0; i < 9; i++)
+   {
+      adt_timer_create(&timers[i], (void*) 0);
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_timerwheel_schedule(&wheel, &timers[i], start + delays[i]));
+   }
+   //each timer must fire exactly at its expiry tick, not one tick earlier
+   for (i = 0; i < 9; i++)
+   {
+      uint64_t expires = start + delays[i];
+      if (expires > start)
+      {
+         CuAssertIntEquals(tc, ADT_NO_ERROR, adt_timerwheel_advance(&wheel, expires - 1u, &expired));
+         CuAssertIntEquals(tc, i, adt_ary_length(&expired));
+      }
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_timerwheel_advance(&wheel, expires, &expired));
+      CuAssertIntEquals(tc, i + 1, adt_ary_length(&expired));
+      CuAssertPtrEquals(tc, &timers[i], *adt_ary_get(&expired, i));
+      CuAssertIntEquals(tc, 8 - i, adt_timerwheel_length(&wheel));
+   }
+   //timers left in the wheel are unscheduled by destroy
+   adt_timerwheel_schedule(&wheel, &timers[0], 0xFFFFFFFFFFull);
+   adt_timerwheel_destroy(&wheel);
+   CuAssertTrue(tc, !adt_timer_is_scheduled(&timers[0]));
+   adt_ary_destroy(&expired);
+}
+
+static void test_adt_timerwheel_past_expiry(CuTest* tc)
+{
+   adt_timerwheel_t wheel;
+   adt_timer_t timers[2];
+   adt_ary_t expired;
+
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_timerwheel_create(&wheel, 0u));
+   adt_ary_create(&expired, (void (*)(void*)) 0);
+   adt_timer_create(&timers[0], (void*) 0);
+   adt_timer_create(&timers[1], (void*) 0);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_timerwheel_advance(&wheel, 100u, &expired));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_timerwheel_schedule(&wheel, &timers[0], 50u));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_timerwheel_schedule(&wheel, &timers[1], 101u));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_timerwheel_advance(&wheel, 100u, &expired));
+   CuAssertIntEquals(tc, 1, adt_ary_length(&expired));
+   CuAssertPtrEquals(tc, &timers[0], *adt_ary_get(&expired, 0));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_timerwheel_advance(&wheel, 101u, &expired));
+   CuAssertIntEquals(tc, 2, adt_ary_length(&expired));
+   CuAssertPtrEquals(tc, &timers[1], *adt_ary_get(&expired, 1));
+   adt_timerwheel_destroy(&wheel);
+   adt_ary_destroy(&expired);
+}
+
+static void test_adt_timerwheel_random(CuTest* tc)
+{
+   adt_timerwheel_t wheel;
+   adt_timer_t *timers;
+   adt_ary_t expired;
+   uint64_t now = 12345u;
+   uint64_t prev;
+   uint32_t seed = 42u;
+   int32_t round;
+   int32_t i;
+   int32_t s32NumScheduled = 0;
+
+   timers = (adt_timer_t*) malloc(sizeof(adt_timer_t) * NUM_TIMERS);
+   CuAssertPtrNotNull(tc, timers);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_timerwheel_create(&wheel, now));
+   adt_ary_create(&expired, (void (*)(void*)) 0);
+   for (i = 0; i < NUM_TIMERS; i++)
+   {
+      adt_timer_create(&timers[i], (void*) 0);
+   }
+   for (round = 0; round < 200; round++)
+   {
+      //schedule, reschedule or cancel some timers
+      for (i = 0; i < 100; i++)
+      {
+         adt_timer_t *pTimer = &timers[next_random(&seed) % NUM_TIMERS];
+         uint32_t r = next_random(&seed);
+         if ( (r % 8u) == 0u )
+         {
+            adt_timerwheel_cancel(&wheel, pTimer);
+         }
+         else
+         {
+            uint64_t delay = next_random(&seed) >> (r % 32u);
+            adt_timerwheel_schedule(&wheel, pTimer, now + delay);
+         }
+      }
+      s32NumScheduled = 0;
+      for (i = 0; i < NUM_TIMERS; i++)
+      {
+         if (adt_timer_is_scheduled(&timers[i]))
+         {
+            s32NumScheduled++;
+         }
+      }
+      CuAssertIntEquals(tc, s32NumScheduled, adt_timerwheel_length(&wheel));
+      prev = now;
+      now += (uint64_t) (next_random(&seed) >> (next_random(&seed) % 32u));
+      adt_ary_clear(&expired);
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_timerwheel_advance(&wheel, now, &expired));
+      for (i = 0; i < adt_ary_length(&expired); i++)
+      {
+         adt_timer_t *pTimer = (adt_timer_t*) *adt_ary_get(&expired, i);
+         CuAssertTrue(tc, pTimer->u64Expires <= now);
+         CuAssertTrue(tc, pTimer->u64Expires >= prev);
+         CuAssertTrue(tc, !adt_timer_is_scheduled(pTimer));
+         if (i > 0)
+         {
+            CuAssertTrue(tc, ((adt_timer_t*) *adt_ary_get(&expired, i - 1))->u64Expires <= pTimer->u64Expires);
+         }
+      }
+      //no timer due by now may remain in the wheel
+      for (i = 0; i < NUM_TIMERS; i++)
+      {
+         if (adt_timer_is_scheduled(&timers[i]))
+         {
+            CuAssertTrue(tc, timers[i].u64Expires > now);
+         }
+      }
+   }
+   adt_timerwheel_destroy(&wheel);
+   adt_ary_destroy(&expired);
+   free(timers);
+}
+
+static uint32_t next_random(uint32_t *pSeed)
+{
+   *pSeed = (*pSeed * 1103515245u) + 12345u;
+   return (*pSeed << 16) ^ (*pSeed >> 8);
+}
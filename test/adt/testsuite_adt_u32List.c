@@ -16,6 +16,7 @@ static void test_adt_u32List_erase(CuTest* tc);
 static void test_adt_u32List_insert_before(CuTest* tc);
 static void test_adt_u32List_insert_after(CuTest* tc);
 static void test_adt_u32List_find(CuTest* tc);
+static void test_adt_u32List_pooled(CuTest* tc);
 
 
 /**************** Private Variable Declarations *******************/
@@ -33,6 +34,7 @@ CuSuite* testsuite_adt_u32List(void)
    SUITE_ADD_TEST(suite, test_adt_u32List_insert_before);
    SUITE_ADD_TEST(suite, test_adt_u32List_insert_after);
    SUITE_ADD_TEST(suite, test_adt_u32List_find);
+   SUITE_ADD_TEST(suite, test_adt_u32List_pooled);
 
    return suite;
 }
@@ -275,3 +277,35 @@ static void test_adt_u32List_find(CuTest* tc)
    CuAssertUIntEquals(tc, 1, iter->item);
    adt_u32List_delete(list);
 }
+
+static void test_adt_u32List_pooled(CuTest* tc)
+{
+   adt_u32List_t list;
+   adt_u32List_elem_t *iter;
+   uint32_t i;
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_u32List_create_pooled(&list, -1));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_u32List_create_pooled(&list, 8));
+   //queue pattern: nodes are recycled through the free list
+   for (i = 0; i < 100; i++)
+   {
+      adt_u32List_insert(&list, i);
+      if (i >= 5)
+      {
+         iter = adt_u32List_iter_first(&list);
+         CuAssertUIntEquals(tc, i - 5, iter->item);
+         adt_u32List_erase(&list, iter);
+      }
+   }
+   CuAssertIntEquals(tc, 5, adt_u32List_length(&list));
+   CuAssertIntEquals(tc, 5, adt_pool_num_used(list.pPool));
+   iter = adt_u32List_find(&list, 97);
+   CuAssertPtrNotNull(tc, iter);
+   adt_u32List_insert_after(&list, iter, 1000);
+   CuAssertUIntEquals(tc, 1000, adt_u32List_iter_next(iter)->item);
+   adt_u32List_clear(&list);
+   CuAssertTrue(tc, adt_u32List_is_empty(&list));
+   CuAssertIntEquals(tc, 0, adt_pool_num_used(list.pPool));
+   adt_u32List_insert(&list, 1);
+   adt_u32List_destroy(&list);
+   CuAssertPtrEquals(tc, 0, list.pPool);
+}
@@ -0,0 +1,301 @@
+/*****************************************************************************
+* \file      testsuite_adt_ulist.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for adt_ulist
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <assert.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CuTest.h"
+#include "adt_ulist.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+#define NUM_ITEMS 1000
+#define MAX_LEN   2000
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_adt_ulist_insert_iterate(CuTest* tc);
+static void test_adt_ulist_erase(CuTest* tc);
+static void test_adt_ulist_random(CuTest* tc);
+static void test_adt_ulist_destructor(CuTest* tc);
+static bool ulist_is_valid(const adt_ulist_t *list);
+static void vfree(void *arg);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+static int32_t m_items[MAX_LEN];
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+
+CuSuite* testsuite_adt_ulist(void)
+{
+   CuSuite* suite = CuSuiteNew();
+   int32_t i;
+   for (i = 0; i < MAX_LEN; i++)
+   {
+      m_items[i] = i;
+   }
+
+   SUITE_ADD_TEST(suite, test_adt_ulist_insert_iterate);
+   SUITE_ADD_TEST(suite, test_adt_ulist_erase);
+   SUITE_ADD_TEST(suite, test_adt_ulist_random);
+   SUITE_ADD_TEST(suite, test_adt_ulist_destructor);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void test_adt_ulist_insert_iterate(CuTest* tc)
+{
+   adt_ulist_t list;
+   adt_ulist_iter_t iter;
+   adt_ulist_iter_t *pIter;
+   int32_t i;
+   adt_ulist_create(&list, NULL);
+   CuAssertTrue(tc, adt_ulist_is_empty(&list));
+   CuAssertPtrEquals(tc, NULL, adt_ulist_iter_first(&list, &iter));
+   CuAssertPtrEquals(tc, NULL, adt_ulist_first(&list));
+   for (i = 0; i < NUM_ITEMS; i++)
+   {
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ulist_insert(&list, &m_items[i]));
+   }
+   CuAssertIntEquals(tc, NUM_ITEMS, adt_ulist_length(&list));
+   CuAssertTrue(tc, ulist_is_valid(&list));
+   //appending in order keeps all nodes except the last one full
+   CuAssertIntEquals(tc, ADT_ULIST_NODE_LEN, list.pFirst->s32Len);
+   i = 0;
+   for (pIter = adt_ulist_iter_first(&list, &iter); pIter != 0; pIter = adt_ulist_iter_next(pIter))
+   {
+      CuAssertPtrEquals(tc, &m_items[i++], pIter->pItem);
+   }
+   CuAssertIntEquals(tc, NUM_ITEMS, i);
+   for (pIter = adt_ulist_iter_last(&list, &iter); pIter != 0; pIter = adt_ulist_iter_prev(pIter))
+   {
+      CuAssertPtrEquals(tc, &m_items[--i], pIter->pItem);
+   }
+   CuAssertIntEquals(tc, 0, i);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ulist_insert_front(&list, &m_items[NUM_ITEMS]));
+   CuAssertPtrEquals(tc, &m_items[NUM_ITEMS], adt_ulist_first(&list));
+   CuAssertPtrEquals(tc, &m_items[NUM_ITEMS - 1], adt_ulist_last(&list));
+   //insert before and after an item in the middle of a full node
+   CuAssertPtrNotNull(tc, adt_ulist_find(&list, &m_items[10], &iter));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ulist_insert_before(&list, &iter, &m_items[NUM_ITEMS + 1]));
+   CuAssertPtrEquals(tc, &m_items[10], iter.pItem);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ulist_insert_after(&list, &iter, &m_items[NUM_ITEMS + 2]));
+   CuAssertPtrEquals(tc, &m_items[10], iter.pItem);
+   CuAssertPtrEquals(tc, &m_items[NUM_ITEMS + 2], adt_ulist_iter_next(&iter)->pItem);
+   CuAssertPtrEquals(tc, &m_items[10], adt_ulist_iter_prev(&iter)->pItem);
+   CuAssertPtrEquals(tc, &m_items[NUM_ITEMS + 1], adt_ulist_iter_prev(&iter)->pItem);
+   CuAssertPtrEquals(tc, &m_items[9], adt_ulist_iter_prev(&iter)->pItem);
+   CuAssertIntEquals(tc, NUM_ITEMS + 3, adt_ulist_length(&list));
+   CuAssertTrue(tc, ulist_is_valid(&list));
+   CuAssertPtrEquals(tc, NULL, adt_ulist_find(&list, &m_items[NUM_ITEMS + 3], &iter));
+   adt_ulist_clear(&list);
+   CuAssertTrue(tc, adt_ulist_is_empty(&list));
+   adt_ulist_destroy(&list);
+}
+
+static void test_adt_ulist_erase(CuTest* tc)
+{
+   adt_ulist_t list;
+   adt_ulist_iter_t iter;
+   adt_ulist_iter_t *pIter;
+   int32_t i;
+   adt_ulist_create(&list, NULL);
+   for (i = 0; i < NUM_ITEMS; i++)
+   {
+      adt_ulist_insert(&list, &m_items[i]);
+   }
+   //erase every item not divisible by 3 while iterating
+   pIter = adt_ulist_iter_first(&list, &iter);
+   while (pIter != 0)
+   {
+      if ((*(int32_t*) pIter->pItem % 3) != 0)
+      {
+         pIter = adt_ulist_erase(&list, pIter);
+      }
+      else
+      {
+         pIter = adt_ulist_iter_next(pIter);
+      }
+   }
+   CuAssertIntEquals(tc, (NUM_ITEMS + 2) / 3, adt_ulist_length(&list));
+   CuAssertTrue(tc, ulist_is_valid(&list));
+   i = 0;
+   for (pIter = adt_ulist_iter_first(&list, &iter); pIter != 0; pIter = adt_ulist_iter_next(pIter))
+   {
+      CuAssertPtrEquals(tc, &m_items[i], pIter->pItem);
+      i += 3;
+   }
+   CuAssertTrue(tc, adt_ulist_remove(&list, &m_items[0]));
+   CuAssertTrue(tc, !adt_ulist_remove(&list, &m_items[0]));
+   CuAssertTrue(tc, adt_ulist_remove(&list, &m_items[999]));
+   CuAssertPtrEquals(tc, &m_items[3], adt_ulist_first(&list));
+   CuAssertPtrEquals(tc, &m_items[996], adt_ulist_last(&list));
+   while (adt_ulist_iter_first(&list, &iter) != 0)
+   {
+      adt_ulist_erase(&list, &iter);
+   }
+   CuAssertTrue(tc, adt_ulist_is_empty(&list));
+   CuAssertPtrEquals(tc, NULL, list.pFirst);
+   CuAssertPtrEquals(tc, NULL, list.pLast);
+   adt_ulist_destroy(&list);
+}
+
+static void test_adt_ulist_random(CuTest* tc)
+{
+   static int32_t expected[MAX_LEN];
+   int32_t s32Len = 0;
+   uint32_t state = 11u;
+   adt_ulist_t list;
+   adt_ulist_iter_t iter;
+   int32_t i;
+   adt_ulist_create(&list, NULL);
+   for (i = 0; i < 20000; i++)
+   {
+      int32_t s32Pos;
+      int32_t j;
+      uint32_t u32Op;
+      state = (state * 1103515245u) + 12345u;
+      u32Op = (state >> 16) % 4u;
+      if (s32Len == 0)
+      {
+         u32Op = 0u;
+      }
+      else if (s32Len == MAX_LEN)
+      {
+         u32Op = 3u;
+      }
+      s32Pos = (s32Len > 0)? (int32_t) ((state >> 4) % (uint32_t) s32Len) : 0;
+      if (s32Len > 0)
+      {
+         //position the iterator at s32Pos
+         adt_ulist_iter_first(&list, &iter);
+         for (j = 0; j < s32Pos; j++)
+         {
+            adt_ulist_iter_next(&iter);
+         }
+         CuAssertPtrEquals(tc, &m_items[expected[s32Pos]], iter.pItem);
+      }
+      switch (u32Op)
+      {
+      case 0:
+         CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ulist_insert(&list, &m_items[i % MAX_LEN]));
+         expected[s32Len++] = i % MAX_LEN;
+         break;
+      case 1:
+         CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ulist_insert_before(&list, &iter, &m_items[i % MAX_LEN]));
+         memmove(&expected[s32Pos + 1], &expected[s32Pos], sizeof(int32_t) * (size_t) (s32Len - s32Pos));
+         expected[s32Pos] = i % MAX_LEN;
+         s32Len++;
+         CuAssertPtrEquals(tc, &m_items[expected[s32Pos + 1]], iter.pItem);
+         break;
+      case 2:
+         CuAssertIntEquals(tc, ADT_NO_ERROR, adt_ulist_insert_after(&list, &iter, &m_items[i % MAX_LEN]));
+         memmove(&expected[s32Pos + 2], &expected[s32Pos + 1], sizeof(int32_t) * (size_t) (s32Len - s32Pos - 1));
+         expected[s32Pos + 1] = i % MAX_LEN;
+         s32Len++;
+         CuAssertPtrEquals(tc, &m_items[expected[s32Pos]], iter.pItem);
+         break;
+      default:
+         if (adt_ulist_erase(&list, &iter) != 0)
+         {
+            CuAssertPtrEquals(tc, &m_items[expected[s32Pos + 1]], iter.pItem);
+         }
+         else
+         {
+            CuAssertIntEquals(tc, s32Len - 1, s32Pos);
+         }
+         memmove(&expected[s32Pos], &expected[s32Pos + 1], sizeof(int32_t) * (size_t) (s32Len - s32Pos - 1));
+         s32Len--;
+         break;
+      }
+      CuAssertIntEquals(tc, s32Len, adt_ulist_length(&list));
+      CuAssertTrue(tc, ulist_is_valid(&list));
+   }
+   i = 0;
+   for (adt_ulist_iter_first(&list, &iter); iter.pNode != 0; adt_ulist_iter_next(&iter))
+   {
+      CuAssertPtrEquals(tc, &m_items[expected[i++]], iter.pItem);
+   }
+   adt_ulist_destroy(&list);
+}
+
+static void test_adt_ulist_destructor(CuTest* tc)
+{
+   adt_ulist_t *list = adt_ulist_new(vfree);
+   int32_t i;
+   CuAssertPtrNotNull(tc, list);
+   for (i = 0; i < 100; i++)
+   {
+      adt_ulist_insert(list, malloc(16));
+   }
+   adt_ulist_clear(list);
+   CuAssertIntEquals(tc, 0, adt_ulist_length(list));
+   for (i = 0; i < 100; i++)
+   {
+      adt_ulist_insert_front(list, malloc(16));
+   }
+   adt_ulist_delete(list);
+}
+
+/**
+ * Checks links, node lengths and the cached length
+ */
+static bool ulist_is_valid(const adt_ulist_t *list)
+{
+   adt_ulist_node_t *pNode;
+   adt_ulist_node_t *pPrev = 0;
+   int32_t s32Len = 0;
+   for (pNode = list->pFirst; pNode != 0; pNode = pNode->pNext)
+   {
+      if ( (pNode->pPrev != pPrev) || (pNode->s32Len < 1) || (pNode->s32Len > ADT_ULIST_NODE_LEN) )
+      {
+         return false;
+      }
+      s32Len += pNode->s32Len;
+      pPrev = pNode;
+   }
+   return (pPrev == list->pLast) && (s32Len == adt_ulist_length(list));
+}
+
+static void vfree(void *arg)
+{
+   free(arg);
+}
@@ -0,0 +1,353 @@
+/*****************************************************************************
+* \file      testsuite_adt_vec.c
+* \author    Conny Gustafsson
+* \date      2026-10-19
+* \brief     Unit tests for adt_vec_t
+*
+* Copyright (c) 2026 Conny Gustafsson
+* Permission is hereby granted, free of charge, to any person obtaining a copy of
+* this software and associated documentation files (the "Software"), to deal in
+* the Software without restriction, including without limitation the rights to
+* use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+* the Software, and to permit persons to whom the Software is furnished to do so,
+* subject to the following conditions:
+
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+* FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+* COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+* IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+* CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*
+******************************************************************************/
+//////////////////////////////////////////////////////////////////////////////
+// INCLUDES
+//////////////////////////////////////////////////////////////////////////////
+#include <assert.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "CuTest.h"
+#include "adt_vec.h"
+#ifdef MEM_LEAK_CHECK
+#include "CMemLeak.h"
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE CONSTANTS AND DATA TYPES
+//////////////////////////////////////////////////////////////////////////////
+typedef struct record_tag
+{
+   uint32_t id;
+   uint32_t group;
+   uint64_t timestamp;
+} record_t;
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTION PROTOTYPES
+//////////////////////////////////////////////////////////////////////////////
+static void test_adt_vec_create(CuTest* tc);
+static void test_adt_vec_push_pop(CuTest* tc);
+static void test_adt_vec_push_many_records(CuTest* tc);
+static void test_adt_vec_insert_erase(CuTest* tc);
+static void test_adt_vec_splice(CuTest* tc);
+static void test_adt_vec_resize(CuTest* tc);
+static void test_adt_vec_sort_i32(CuTest* tc);
+static void test_adt_vec_sort_is_stable(CuTest* tc);
+static void test_adt_vec_bsearch(CuTest* tc);
+static void test_adt_vec_radix_sort(CuTest* tc);
+
+static int record_group_vlt(const void *a, const void *b);
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE VARIABLES
+//////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////
+// PUBLIC FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+CuSuite* testsuite_adt_vec(void)
+{
+   CuSuite* suite = CuSuiteNew();
+
+   SUITE_ADD_TEST(suite, test_adt_vec_create);
+   SUITE_ADD_TEST(suite, test_adt_vec_push_pop);
+   SUITE_ADD_TEST(suite, test_adt_vec_push_many_records);
+   SUITE_ADD_TEST(suite, test_adt_vec_insert_erase);
+   SUITE_ADD_TEST(suite, test_adt_vec_splice);
+   SUITE_ADD_TEST(suite, test_adt_vec_resize);
+   SUITE_ADD_TEST(suite, test_adt_vec_sort_i32);
+   SUITE_ADD_TEST(suite, test_adt_vec_sort_is_stable);
+   SUITE_ADD_TEST(suite, test_adt_vec_bsearch);
+   SUITE_ADD_TEST(suite, test_adt_vec_radix_sort);
+
+   return suite;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+// PRIVATE FUNCTIONS
+//////////////////////////////////////////////////////////////////////////////
+static void test_adt_vec_create(CuTest* tc)
+{
+   adt_vec_t vec;
+   adt_vec_t *pVec;
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_vec_create(&vec, 0u, NULL));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_create(&vec, sizeof(int32_t), NULL));
+   CuAssertPtrEquals(tc, 0, vec.pAlloc);
+   CuAssertIntEquals(tc, 0, adt_vec_length(&vec));
+   CuAssertUIntEquals(tc, sizeof(int32_t), adt_vec_elem_size(&vec));
+   CuAssertTrue(tc, adt_vec_is_empty(&vec));
+   adt_vec_destroy(&vec);
+
+   pVec = adt_vec_new(sizeof(record_t), NULL);
+   CuAssertPtrNotNull(tc, pVec);
+   CuAssertUIntEquals(tc, sizeof(record_t), adt_vec_elem_size(pVec));
+   adt_vec_delete(pVec);
+   CuAssertPtrEquals(tc, 0, adt_vec_new(0u, NULL));
+}
+
+static void test_adt_vec_push_pop(CuTest* tc)
+{
+   adt_vec_t vec;
+   int32_t value;
+   adt_vec_create(&vec, sizeof(int32_t), NULL);
+   value = 10;
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_push(&vec, &value));
+   value = 20;
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_push(&vec, &value));
+   value = 30;
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_push(&vec, &value));
+   CuAssertIntEquals(tc, 3, adt_vec_length(&vec));
+   CuAssertIntEquals(tc, 10, *(int32_t*) adt_vec_get(&vec, 0));
+   CuAssertIntEquals(tc, 30, *(int32_t*) adt_vec_get(&vec, -1));
+   CuAssertPtrEquals(tc, 0, adt_vec_get(&vec, 3));
+   CuAssertPtrEquals(tc, 0, adt_vec_get(&vec, -4));
+   CuAssertIntEquals(tc, 20, ((int32_t*) adt_vec_data(&vec))[1]);
+
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_pop(&vec, &value));
+   CuAssertIntEquals(tc, 30, value);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_pop(&vec, &value));
+   CuAssertIntEquals(tc, 20, value);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_pop(&vec, NULL));
+   CuAssertIntEquals(tc, 0, adt_vec_length(&vec));
+   CuAssertIntEquals(tc, ADT_LENGTH_ERROR, adt_vec_pop(&vec, &value));
+   adt_vec_destroy(&vec);
+}
+
+static void test_adt_vec_push_many_records(CuTest* tc)
+{
+   adt_vec_t vec;
+   uint32_t i;
+   adt_vec_create(&vec, sizeof(record_t), NULL);
+   for (i = 0; i < 1000u; i++)
+   {
+      record_t record;
+      record.id = i;
+      record.group = i % 7u;
+      record.timestamp = ((uint64_t) i) << 32;
+      CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_push(&vec, &record));
+   }
+   CuAssertIntEquals(tc, 1000, adt_vec_length(&vec));
+   CuAssertTrue(tc, vec.s32AllocLen >= 1000);
+   for (i = 0; i < 1000u; i++)
+   {
+      record_t *pRecord = (record_t*) adt_vec_get(&vec, (int32_t) i);
+      CuAssertUIntEquals(tc, i, pRecord->id);
+      CuAssertULIntEquals(tc, ((uint64_t) i) << 32, pRecord->timestamp);
+   }
+   adt_vec_clear(&vec);
+   CuAssertIntEquals(tc, 0, adt_vec_length(&vec));
+   CuAssertTrue(tc, vec.s32AllocLen >= 1000);
+   adt_vec_destroy(&vec);
+}
+
+static void test_adt_vec_insert_erase(CuTest* tc)
+{
+   adt_vec_t vec;
+   int32_t values[] = {1, 2, 3};
+   int32_t value;
+   adt_vec_create(&vec, sizeof(int32_t), NULL);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_insert(&vec, 0, &values[2]));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_insert(&vec, 0, &values[0]));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_insert(&vec, 1, &values[1]));
+   value = 4;
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_insert(&vec, 3, &value));
+   CuAssertIntEquals(tc, ADT_INDEX_OUT_OF_BOUNDS_ERROR, adt_vec_insert(&vec, 5, &value));
+   CuAssertIntEquals(tc, 4, adt_vec_length(&vec));
+   CuAssertIntEquals(tc, 1, *(int32_t*) adt_vec_get(&vec, 0));
+   CuAssertIntEquals(tc, 2, *(int32_t*) adt_vec_get(&vec, 1));
+   CuAssertIntEquals(tc, 3, *(int32_t*) adt_vec_get(&vec, 2));
+   CuAssertIntEquals(tc, 4, *(int32_t*) adt_vec_get(&vec, 3));
+
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_erase(&vec, 1));
+   CuAssertIntEquals(tc, 3, adt_vec_length(&vec));
+   CuAssertIntEquals(tc, 1, *(int32_t*) adt_vec_get(&vec, 0));
+   CuAssertIntEquals(tc, 3, *(int32_t*) adt_vec_get(&vec, 1));
+   CuAssertIntEquals(tc, 4, *(int32_t*) adt_vec_get(&vec, 2));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_erase(&vec, -1));
+   CuAssertIntEquals(tc, 2, adt_vec_length(&vec));
+   CuAssertIntEquals(tc, ADT_INDEX_OUT_OF_BOUNDS_ERROR, adt_vec_erase(&vec, 2));
+   adt_vec_destroy(&vec);
+}
+
+static void test_adt_vec_splice(CuTest* tc)
+{
+   adt_vec_t vec;
+   int32_t i;
+   adt_vec_create(&vec, sizeof(int32_t), NULL);
+   for (i = 0; i < 10; i++)
+   {
+      adt_vec_push(&vec, &i);
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_splice(&vec, 2, 3));
+   CuAssertIntEquals(tc, 7, adt_vec_length(&vec));
+   CuAssertIntEquals(tc, 1, *(int32_t*) adt_vec_get(&vec, 1));
+   CuAssertIntEquals(tc, 5, *(int32_t*) adt_vec_get(&vec, 2));
+   CuAssertIntEquals(tc, ADT_LENGTH_ERROR, adt_vec_splice(&vec, 5, 3));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_splice(&vec, -2, 2));
+   CuAssertIntEquals(tc, 5, adt_vec_length(&vec));
+   CuAssertIntEquals(tc, 7, *(int32_t*) adt_vec_get(&vec, -1));
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_vec_splice(&vec, 0, 0));
+   adt_vec_destroy(&vec);
+}
+
+static void test_adt_vec_resize(CuTest* tc)
+{
+   adt_vec_t vec;
+   int32_t value = 7;
+   adt_vec_create(&vec, sizeof(int32_t), NULL);
+   adt_vec_push(&vec, &value);
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_resize(&vec, 4));
+   CuAssertIntEquals(tc, 4, adt_vec_length(&vec));
+   CuAssertIntEquals(tc, 7, *(int32_t*) adt_vec_get(&vec, 0));
+   CuAssertIntEquals(tc, 0, *(int32_t*) adt_vec_get(&vec, 3));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_resize(&vec, 1));
+   CuAssertIntEquals(tc, 1, adt_vec_length(&vec));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_reserve(&vec, 100));
+   CuAssertIntEquals(tc, 100, vec.s32AllocLen);
+   CuAssertIntEquals(tc, 7, *(int32_t*) adt_vec_get(&vec, 0));
+   adt_vec_destroy(&vec);
+}
+
+static void test_adt_vec_sort_i32(CuTest* tc)
+{
+   adt_vec_t vec;
+   int32_t i;
+   adt_vec_create(&vec, sizeof(int32_t), NULL);
+   for (i = 0; i < 100; i++)
+   {
+      int32_t value = (i * 37) % 101 - 50;
+      adt_vec_push(&vec, &value);
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_sort(&vec, adt_i32_vlt, false));
+   for (i = 1; i < 100; i++)
+   {
+      CuAssertTrue(tc, *(int32_t*) adt_vec_get(&vec, i-1) <= *(int32_t*) adt_vec_get(&vec, i));
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_sort(&vec, adt_i32_vlt, true));
+   for (i = 1; i < 100; i++)
+   {
+      CuAssertTrue(tc, *(int32_t*) adt_vec_get(&vec, i-1) >= *(int32_t*) adt_vec_get(&vec, i));
+   }
+   adt_vec_destroy(&vec);
+}
+
+static void test_adt_vec_sort_is_stable(CuTest* tc)
+{
+   adt_vec_t vec;
+   uint32_t i;
+   adt_vec_create(&vec, sizeof(record_t), NULL);
+   for (i = 0; i < 200u; i++)
+   {
+      record_t record;
+      record.id = i;
+      record.group = (i * 13u) % 5u;
+      record.timestamp = 0u;
+      adt_vec_push(&vec, &record);
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_sort(&vec, record_group_vlt, false));
+   for (i = 1; i < 200u; i++)
+   {
+      record_t *pPrev = (record_t*) adt_vec_get(&vec, (int32_t) i - 1);
+      record_t *pCur = (record_t*) adt_vec_get(&vec, (int32_t) i);
+      CuAssertTrue(tc, pPrev->group <= pCur->group);
+      if (pPrev->group == pCur->group)
+      {
+         CuAssertTrue(tc, pPrev->id < pCur->id);
+      }
+   }
+   adt_vec_destroy(&vec);
+}
+
+static void test_adt_vec_bsearch(CuTest* tc)
+{
+   adt_vec_t vec;
+   int32_t i;
+   int32_t key;
+   adt_vec_create(&vec, sizeof(int32_t), NULL);
+   for (i = 0; i < 50; i++)
+   {
+      int32_t value = i * 2;
+      adt_vec_push(&vec, &value);
+   }
+   key = 0;
+   CuAssertIntEquals(tc, 0, adt_vec_bsearch(&vec, &key, adt_i32_vlt));
+   key = 42;
+   CuAssertIntEquals(tc, 21, adt_vec_bsearch(&vec, &key, adt_i32_vlt));
+   key = 98;
+   CuAssertIntEquals(tc, 49, adt_vec_bsearch(&vec, &key, adt_i32_vlt));
+   key = 43;
+   CuAssertIntEquals(tc, -1, adt_vec_bsearch(&vec, &key, adt_i32_vlt));
+   key = 100;
+   CuAssertIntEquals(tc, -1, adt_vec_bsearch(&vec, &key, adt_i32_vlt));
+   key = -1;
+   CuAssertIntEquals(tc, -1, adt_vec_bsearch(&vec, &key, adt_i32_vlt));
+   adt_vec_destroy(&vec);
+}
+
+static void test_adt_vec_radix_sort(CuTest* tc)
+{
+   adt_vec_t vec;
+   int32_t i;
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_create(&vec, sizeof(int32_t), NULL));
+   for (i = 0; i < 1000; i++)
+   {
+      int32_t value = ((i * 7919) % 1000) - 500;
+      adt_vec_push(&vec, &value);
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_sort_i32(&vec, false));
+   for (i = 0; i < 1000; i++)
+   {
+      CuAssertIntEquals(tc, i - 500, *((int32_t*) adt_vec_get(&vec, i)));
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_sort_i32(&vec, true));
+   CuAssertIntEquals(tc, 499, *((int32_t*) adt_vec_get(&vec, 0)));
+   CuAssertIntEquals(tc, -500, *((int32_t*) adt_vec_get(&vec, -1)));
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_sort_u32(&vec, false));
+   CuAssertIntEquals(tc, 0, *((int32_t*) adt_vec_get(&vec, 0)));
+   CuAssertIntEquals(tc, -1, *((int32_t*) adt_vec_get(&vec, -1)));
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_vec_sort_u64(&vec, false));
+   adt_vec_destroy(&vec);
+
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_create(&vec, sizeof(uint64_t), NULL));
+   for (i = 0; i < 100; i++)
+   {
+      uint64_t value = ((uint64_t) (i % 10)) << 40 | (uint64_t) i;
+      adt_vec_push(&vec, &value);
+   }
+   CuAssertIntEquals(tc, ADT_NO_ERROR, adt_vec_sort_u64(&vec, false));
+   for (i = 1; i < 100; i++)
+   {
+      CuAssertTrue(tc, *((uint64_t*) adt_vec_get(&vec, i - 1)) < *((uint64_t*) adt_vec_get(&vec, i)));
+   }
+   CuAssertIntEquals(tc, ADT_INVALID_ARGUMENT_ERROR, adt_vec_sort_i32(&vec, false));
+   adt_vec_destroy(&vec);
+}
+
+static int record_group_vlt(const void *a, const void *b)
+{
+   return ((const record_t*) a)->group < ((const record_t*) b)->group;
+}